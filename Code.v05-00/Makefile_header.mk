@@ -132,7 +132,7 @@ LINK := $(LINK) $(LDLIBS) -lstdc++
 
 LINK_FFTW := -lfftw3 -lfftw3f -lfftw3l
 ifeq ($(shell [[ "$(OMP)" =~ $(REGEXP) ]] && echo true),true)
-	LINK_FFTW += -lfftw3_omp
+	LINK_FFTW += -lfftw3_omp -lfftw3f_omp
 endif
 
 
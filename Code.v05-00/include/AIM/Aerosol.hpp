@@ -130,14 +130,48 @@ class AIM::Grid_Aerosol
         Grid_Aerosol operator+( const Grid_Aerosol &rhs ) const;
         Grid_Aerosol operator-( const Grid_Aerosol &rhs ) const;
 
-        /* Coagulation */
-        void Coagulate( const RealDouble dt, Coagulation &kernel, const UInt N = 2, const UInt SYM = 0 );
+        /* Coagulation. Returns the number of cells skipped for lack of
+         * aerosol volume */
+        UInt Coagulate( const RealDouble dt, Coagulation &kernel, const UInt N = 2, const UInt SYM = 0 );
 
-        /* Ice crystal growth */
-        void Grow( const RealDouble dt, Vector_2D &H2O, const Vector_2D &T, const Vector_1D &P, const UInt N = 2, const UInt SYM = 0 );
+        /* Ice crystal growth. Returns the number of ice-free cells
+         * skipped */
+        UInt Grow( const RealDouble dt, Field2D &H2O, const Vector_2D &T, const Vector_1D &P, const UInt N = 2, const UInt SYM = 0 );
     
         /* Update bin centers - Used after aerosol transport */
-        void UpdateCenters( const Vector_3D &iceV, const Vector_3D &PDF );
+        void UpdateCenters( const FieldStack &iceV, const FieldStack &PDF );
+
+        /* Two-moment form of bin iBin for transport: CentersToVolume
+         * replaces bin_VCenters[iBin] with the volume in the bin, in
+         * [m^3/cm^3], so that number and volume can be transported in
+         * place. VolumeToCenters recomputes the centers from the
+         * transported volume and number, as in UpdateCenters */
+        void CentersToVolume( const UInt iBin );
+        void VolumeToCenters( const UInt iBin );
+
+        /* Removes all particles from cell (iNx, jNy) and resets its bin
+         * centers to the middle of the bins. Distinct cells can be
+         * cleared concurrently, so the moment cache is left as is: call
+         * InvalidateMoments once done */
+        void ClearCell( const UInt iNx, const UInt jNy );
+
+        /* Grow the grid, keeping the current pdf as the block starting at
+         * (j0, i0). New cells get the pdf pdfFill and nominal bin volumes */
+        void Regrid( const UInt Nx_, const UInt Ny_, const UInt i0, const UInt j0, \
+                     const Vector_1D &pdfFill );
+
+        /* Moment cache: moments M0 to M3 of all cells and the quantities
+         * derived from them, computed in one pass by ComputeMoments and
+         * kept until pdf or bin_VCenters change. Methods of this class
+         * that change them invalidate the cache; code that changes them
+         * directly must call InvalidateMoments. The cache is filled on
+         * demand by the const accessors below, which is not thread-safe:
+         * call ComputeMoments before reading it from parallel regions */
+        enum MomentField { MOM_M0 = 0, MOM_M1, MOM_M2, MOM_M3, MOM_RMEAN, \
+                           MOM_REFF, MOM_SAD, MOM_IWC, MOM_EXT, MOM_N };
+        void ComputeMoments( ) const;
+        void InvalidateMoments( ) { momentsValid = false; }
+        const Field2D& CachedMoment( const MomentField field ) const;
 
         /* Moments */
         Vector_2D Moment( UInt n ) const;
@@ -145,11 +179,11 @@ class AIM::Grid_Aerosol
         RealDouble Moment( UInt n, UInt iNx, UInt jNy ) const;
 
         /* Extra utils */
-        Vector_3D Number( ) const;
+        FieldStack Number( ) const;
         Vector_2D TotalNumber( ) const;
         RealDouble TotalNumber_sum( const Vector_2D cellAreas ) const;
         Vector_1D Overall_Size_Dist( const Vector_2D cellAreas ) const;
-        Vector_3D Volume( ) const;
+        FieldStack Volume( ) const;
         Vector_2D TotalVolume( ) const;
         RealDouble TotalIceMass_sum( const Vector_2D cellAreas ) const;
         Vector_2D IWC( ) const;
@@ -177,16 +211,16 @@ class AIM::Grid_Aerosol
         /* gets */
         Vector_1D getBinCenters() const;
         Vector_1D binCenters() const { return bin_Centers; };
-        Vector_3D getBinVCenters() const;
+        FieldStack getBinVCenters() const;
         Vector_1D getBinEdges() const;
         Vector_1D binEdges() const { return bin_Edges; };
         Vector_1D getBinSizes() const;
         Vector_1D binSizes() const { return bin_Sizes; };
         UInt getNBin() const;
-        Vector_3D getPDF() const;
+        FieldStack getPDF() const;
 
-        Vector_3D pdf;
-        Vector_3D bin_VCenters;
+        FieldStack pdf;
+        FieldStack bin_VCenters;
 
     protected:
 
@@ -202,6 +236,9 @@ class AIM::Grid_Aerosol
         RealDouble sigma;
         RealDouble alpha;
 
+        mutable FieldStack moments;
+        mutable bool momentsValid;
+
     private:
 
 };
@@ -17,9 +17,11 @@
 #include <iostream>
 #include <algorithm>
 #include <vector>
+#include <map>
 #include <cstring>
 
 #include "Util/ForwardDecl.hpp"
+#include "Util/Field.hpp"
 #include "Util/PhysConstant.hpp"
 #include "Util/PhysFunction.hpp"
 #include "AIM/buildKernel.hpp"
@@ -32,9 +34,30 @@ namespace AIM
     class Grid_Aerosol;
 
     class Coagulation;
+    struct CoagMap;
 
 }
 
+/* Bin-pair to target-bin mapping of one grid cell, in compressed sparse
+ * rows. Volume of bin i is produced by the pairs ( k[e], j[e] ), with
+ * k < i and j <= i, for ptr[i] <= e < ptr[i+1], with the rate
+ * coef[e] * v[k] * n[j], coef being the fraction of the pair going to i
+ * times beta[k][j], in order of increasing j then k. Volume of bin i is
+ * lost at the rate loss[i*nBin+j] * v[i] * n[j].
+ * Built by Coagulation::buildMap, each thread holding its own map */
+struct AIM::CoagMap
+{
+
+    std::vector<UInt> ptr, k, j;
+    Vector_1D coef;
+    Vector_1D loss;
+
+    /* Scratch: target bins and coefficients before sorting */
+    std::vector<UInt> target, kTmp, jTmp, count;
+    Vector_1D coefTmp;
+
+};
+
 class AIM::Coagulation
 {
 
@@ -53,13 +76,21 @@ class AIM::Coagulation
         Coagulation& operator=( const Coagulation& k );
         void buildBeta( const Vector_1D &bin_Centers );
         void buildF( Vector_1D &bin_VCenters );
-        void buildF( Vector_3D &bin_VCenters, const UInt jNy, const UInt iNx );
+        void buildF( const FieldStack &bin_VCenters, const UInt jNy, const UInt iNx );
+        void buildMap( const Vector_1D &bin_VCenters, CoagMap &map ) const;
+        void ClearMaps( );
         Vector_2D getKernel() const;
         Vector_1D getKernel_1D() const;
         Vector_2D getBeta() const;
         Vector_3D getF() const;
         void printKernel_1D( const char* fileName ) const;
         void printKernel_2D( const char* fileName ) const;
+
+        /* Mapping statistics of Grid_Aerosol::Coagulate: cells run with
+         * the nominal mapping, with a cached mapping, and mappings built */
+        unsigned long MapNominal( ) const { return nMapNominal; }
+        unsigned long MapHits( ) const { return nMapHit; }
+        unsigned long MapMisses( ) const { return nMapMiss; }
         
         Vector_3D f;
         std::vector<std::vector<std::vector<UInt> > > indices;
@@ -70,6 +101,16 @@ class AIM::Coagulation
         Vector_1D Kernel_1D;
         Vector_2D beta;
 
+        /* Nominal bin volume centers and their mapping, used by
+         * Grid_Aerosol::Coagulate for cells that have not drifted away
+         * from them. Other mappings are cached by quantized drift */
+        Vector_1D vNominal;
+        CoagMap nominalMap;
+        std::map<std::vector<long>, CoagMap> mapCache;
+        unsigned long nMapNominal = 0;
+        unsigned long nMapHit = 0;
+        unsigned long nMapMiss = 0;
+
     private:
 
         const RealDouble A0 = 5.07;
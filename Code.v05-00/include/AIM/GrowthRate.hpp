@@ -0,0 +1,73 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*                        AIrcraft Microphysics                     */
+/*                              (AIM)                               */
+/*                                                                  */
+/* GrowthRate Header File                                           */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : GrowthRate.hpp                            */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef GROWTHRATE_H_INCLUDED
+#define GROWTHRATE_H_INCLUDED
+
+#include <iostream>
+#include <vector>
+
+#include "Util/ForwardDecl.hpp"
+#include "Util/PhysConstant.hpp"
+#include "Util/PhysFunction.hpp"
+#include "Util/MolarWeights.hpp"
+
+namespace AIM
+{
+
+    class GrowthRate;
+
+}
+
+/* Ice deposition growth rates of a set of bins, as given by
+ * physFunc::growthRate. The factors that only depend on the radius are
+ * computed once, and the rates of all bins are only recomputed when the
+ * temperature or pressure changes. Not thread-safe: each thread holds
+ * its own copy. */
+
+class AIM::GrowthRate
+{
+
+    public:
+
+        GrowthRate( );
+        GrowthRate( const Vector_1D &bin_Centers );
+
+        /* Sets the temperature [K] and pressure [Pa] of the rates */
+        void SetState( const RealDouble T, const RealDouble P );
+
+        /* Growth rates [cm^3 ice/s/part] at the last state */
+        const RealDouble* Rates( ) const { return kGrowth.data(); }
+
+        /* Kelvin factors [-] */
+        const RealDouble* Kelvin( ) const { return kelvin.data(); }
+
+        /* Saturation pressure w.r.t. ice at the last state [Pa] */
+        RealDouble pSat( ) const { return pSat_; }
+
+    private:
+
+        UInt nBin;
+
+        /* Radius factors: 4*pi*r [cm^3/m^2], 1/r [1/m], Kelvin factor and
+         * free-molecular weight of the thermal conductivity */
+        Vector_1D r, fourPiR, invR, kelvin, rCond;
+
+        /* Growth rates at the last state */
+        Vector_1D kGrowth;
+
+        RealDouble lastT, lastP, pSat_;
+
+};
+
+#endif /* GROWTHRATE_H_INCLUDED */
@@ -18,7 +18,7 @@
 #include <vector>
 
 #include "KPP/KPP_Parameters.h"
-#include "KPP/KPP_Global.h"
+#include "KPP/KPP_Context.hpp"
 #include "Util/ForwardDecl.hpp"
 #include "Core/Parameters.hpp"
 
@@ -32,8 +32,9 @@ class Ambient
         ~Ambient( );
         Ambient( const Ambient &a );
         Ambient& operator=( const Ambient &a );
-        void getData(  RealDouble aerArray[][2], UInt iTime ) const;
-        void FillIn( UInt iTime );
+        void getData( KppContext &ctx, RealDouble aerArray[][2], \
+                      UInt iTime ) const;
+        void FillIn( KppContext &ctx, UInt iTime );
         UInt getnTime() const;
 
         Vector_2D Species;
@@ -159,6 +159,14 @@ class OptInput
         bool        TRANSPORT_UPDRAFT;
         RealDouble  TRANSPORT_UPDRAFT_TIMESCALE;
         RealDouble  TRANSPORT_UPDRAFT_VELOCITY;
+        bool        TRANSPORT_SINGLE_SPECIES;
+        bool        TRANSPORT_SINGLE_AEROSOL;
+        bool        TRANSPORT_SINGLE_RINGS;
+        int         TRANSPORT_NX;
+        int         TRANSPORT_NY;
+        bool        TRANSPORT_GROW_DOMAIN;
+        int         TRANSPORT_NX_INIT;
+        int         TRANSPORT_NY_INIT;
 
         /* ========================================== */
         /* ---- CHEMISTRY MENU ---------------------- */
@@ -166,6 +174,11 @@ class OptInput
 
         bool        CHEMISTRY_CHEMISTRY;
         bool        CHEMISTRY_HETCHEM;
+        bool        CHEMISTRY_SKIP_BACKG;
+        bool        CHEMISTRY_LU_SCHED;
+        RealDouble  CHEMISTRY_JAC_THETAMIN;
+        RealDouble  CHEMISTRY_CLUSTER_TOL;
+        RealDouble  CHEMISTRY_REDUCED_TOL;
         std::string CHEMISTRY_JRATE_FOLDER;
         RealDouble  CHEMISTRY_TIMESTEP;
 
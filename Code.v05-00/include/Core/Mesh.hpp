@@ -24,12 +24,33 @@
 #include "Core/Cluster.hpp"
 #include "Core/Ring.hpp"
 #include "Util/PhysConstant.hpp"
+#include "Util/Field.hpp"
 
 class Mesh
 {
     public:
 
         Mesh( );
+
+        /**
+         * Window of a runtime-sized grid spanning the full domain
+         *
+         * @param nxFull (UInt) : number of cells of the full grid in the x-direction
+         * @param nyFull (UInt) : number of cells of the full grid in the y-direction
+         * @param nx_ (UInt)    : number of cells of the window in the x-direction
+         * @param ny_ (UInt)    : number of cells of the window in the y-direction
+         * @param i0 (UInt)     : first column of the window in the full grid
+         * @param j0 (UInt)     : first row of the window in the full grid
+         *
+         * Without i0 and j0, the window is centered on the emission point
+         * and clamped to the domain.
+         */
+
+        Mesh( const UInt nxFull, const UInt nyFull, \
+              const UInt nx_, const UInt ny_ );
+        Mesh( const UInt nxFull, const UInt nyFull, \
+              const UInt nx_, const UInt ny_,       \
+              const UInt i0, const UInt j0 );
         ~Mesh( );
         Mesh( const Mesh &m );
         Mesh& operator=( const Mesh &m );
@@ -50,12 +71,60 @@ class Mesh
         const Vector_3D& map( ) const { return weights; }
         const Vector_1Dui& nMap( ) const { return nCellMap; }
         const Vector_2Dui& mapIndex( ) const { return mapIndex_; }
+
+        /* Cells mapped to each ring, as flat indices jNy * Nx() + iNx in
+         * increasing order. Kept consistent with mapIndex(). */
+        const Vector_2Dui& ringCells( ) const { return ringCells_; }
         void Debug() const;
 
+        /* Window position in the full grid */
+        UInt NxFull() const { return nxFull_; }
+        UInt NyFull() const { return nyFull_; }
+        UInt i0() const { return i0_; }
+        UInt j0() const { return j0_; }
+        RealDouble xlimLeft() const { return xlim_left; }
+        RealDouble xlimRight() const { return xlim_right; }
+        RealDouble ylimDown() const { return ylim_down; }
+        RealDouble ylimUp() const { return ylim_up; }
+
+        /**
+         * Flags the sides of the window (left, right, down, up) through which
+         * a tracer is about to leave, i.e. for which more than GRID_EDGE_FRAC
+         * of its total lies within the outer GRID_EDGE_WIDTH of the window.
+         * Sides that are already on the domain boundary are never flagged.
+         * Flags are only ever set, so that several tracers can be checked.
+         *
+         * @param F (2D)       : tracer (Field2D or Vector_2D)
+         * @param edge (bool*) : side flags, 4 elements
+         */
+
+        template <class Field>
+        void EdgeCheck( const Field &F, bool edge[4] ) const;
+
+        /**
+         * Builds the window grown twofold towards the flagged sides, clamped
+         * to the domain. Ring weights are extended with the values of the
+         * closest cell. Returns false if the window cannot grow.
+         *
+         * @param edge (bool*) : side flags from EdgeCheck
+         * @param grown (Mesh) : grown mesh
+         */
+
+        bool Grow( const bool edge[4], Mesh &grown ) const;
+
         Vector_3D weights;
 
     private:
 
+        /* Sets the window limits */
+        void SetWindow( const UInt i0, const UInt j0 );
+
+        /* Computes coordinates and areas */
+        void Build( );
+
+        /* Rebuilds the per-ring cell lists from mapIndex_ */
+        void BuildRingCells( );
+
         /* Cell center coordinates */
         Vector_1D x_, y_;
 
@@ -76,8 +145,11 @@ class Mesh
         RealDouble xlim_right, xlim_left, ylim_up, ylim_down;
         RealDouble hx_, hy_;
         UInt nx, ny;
+        UInt nxFull_, nyFull_;
+        UInt i0_, j0_;
         Vector_1Dui nCellMap;
         Vector_2Dui mapIndex_;
+        Vector_2Dui ringCells_;
 
 };
 
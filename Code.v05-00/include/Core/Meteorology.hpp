@@ -46,6 +46,8 @@ class Meteorology
         Meteorology( const Meteorology &met );
         ~Meteorology( );
 
+        Meteorology& operator=( const Meteorology &met );
+
         void Update( const RealDouble solarTime_h, const Mesh &m, \
                      const RealDouble dTrav_x, const RealDouble dTrav_y );
 
@@ -74,9 +76,9 @@ class Meteorology
         UInt TYPE;
 
         /* Ambient parameters */
-        const RealDouble TEMPERATURE;
-        const RealDouble PRESSURE;
-        const RealDouble RHI;
+        RealDouble TEMPERATURE;
+        RealDouble PRESSURE;
+        RealDouble RHI;
         RealDouble ALTITUDE;
 
         /* Temperature lapse rate */
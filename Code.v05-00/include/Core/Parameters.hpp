@@ -67,6 +67,21 @@ extern int PARALLEL_CASES;
 #define NYH               NY/2 + 1
 #define NCELL             NX*NY       /* Number of grid cells */
 
+/* Domain growth */
+#define GRID_EDGE_WIDTH   1.25E-01    /* Width of the boundary band, as a fraction of the grid size [-] */
+#define GRID_EDGE_FRAC    1.00E-04    /* Fraction of a tracer in the boundary band that triggers growth [-] */
+
+/* Transport parameters */
+#define SANDS_NBATCH      8           /* Max. number of fields per batched FFT */
+#define SANDS_NSETTLING   64          /* Max. number of cached vertical propagators */
+#define SANDS_NTIMESTEP   4           /* Max. number of time steps with cached propagators */
+#define SETTLING_MAXDIST  1.00E+02    /* Max. settling distance per transport sub-step [m] */
+#define SANDS_UNIFORM_TOL 1.00E-12    /* Relative departure below which a field is considered uniform and not transported [-] */
+
+/* Time stepping */
+#define NIGHT_DT_FACTOR   6           /* Max. night-time step, in dynamic time steps */
+#define NIGHT_DT_DELAY    3.60E+03    /* Plume age after which night-time steps can be stretched [s] */
+
 
 /* Coarse aerosol representation */
 //#define LA_VRAT               1.50E+00 // 1.80E+00    /* Size ratio between two consecutive bins */
@@ -115,6 +130,20 @@ extern int PARALLEL_CASES;
 #define KPP_ATOLS             1.00E-03    /* Absolute tolerances in KPP */
 #define KPPADJ_RTOLS          1.00E-05    /* Relative tolerances in KPP_Adjoint */
 #define KPPADJ_ATOLS          1.00E-04    /* Absolute tolerances in KPP_Adjoint */
+#define CHEM_WARM_START       1           /* Start each chemistry step from the last accepted step size of the cell/ring [0,1] */
+#define CHEM_LOAD_BALANCE     1           /* Integrate grid cells by decreasing step count over the last chemistry step [0,1] */
+
+/* Active region */
+#define ACTIVE_RTOL           1.00E-03    /* Relative departure from ambient below which a cell is background [-] */
+#define ACTIVE_ATOL           1.00E+00    /* Absolute departure from ambient below which a cell is background [molec/cm^3] */
+#define ACTIVE_ICE_NUM        1.00E-06    /* Ice crystal number below which a cell is considered ice-free [#/cm^3] */
+
+/* Reduced far-field chemistry */
+#define REDUCED_NCHECK        8           /* Far-field cells also integrated with the full mechanism at each step, to measure the error [-] */
+
+/* Chemistry cell clustering */
+#define CLUSTER_SPC_FLOOR     1.00E+00    /* Concentration below which species are not told apart [molec/cm^3] */
+#define CLUSTER_AER_FLOOR     1.00E-20    /* Aerosol area and volume below which they are not told apart [cm^2/cm^3, cm^3/cm^3] */
 
 /* Aerosol parameters */
 #define N_AER                 3           /* Number of aerosols considered */
@@ -128,6 +157,8 @@ extern int PARALLEL_CASES;
 #define LA_R_HIG              5.00E-07    /* Sulfates' larger bin radius [m] */
 #define PA_R_LOW              5.00E-08    /* Ice/NAT lower bin radius [m] */
 #define PA_R_HIG              8.00E-05    /* Ice/NAT larger bin radius [m] */
+#define COAG_MAP_TOL          1.00E-03    /* Drift of the bin volume centers below which coagulation mappings are reused [-] */
+#define COAG_MAP_MAX          256         /* Maximum number of coagulation mappings cached by a kernel */
 
 /* Early plume integration */
 #define VORTEX_SINKING        1           /* Consider vortex sinking? */
@@ -45,9 +45,9 @@ class SpeciesArray
                      const Vector_3D &weights,   \
                      UInt nCounter );
 
-        void FillIn( UInt iTime, UInt iRing );
+        void FillIn( KppContext &ctx, UInt iTime, UInt iRing );
 
-        void getData( UInt iTime, UInt iRing );
+        void getData( KppContext &ctx, UInt iTime, UInt iRing );
 
         Vector_1D RingAverage( const Vector_1D ringArea, \
                                const RealDouble totArea, \
@@ -63,6 +63,10 @@ class SpeciesArray
         /* Reactive species */
         Vector_3D Species;
 
+        /* Last accepted chemistry step size in each ring, in [s].
+         * Zero until the ring has been integrated */
+        Vector_1D chemStep;
+
         /* Aerosols */
         Vector_2D sootDens, sootRadi, sootArea, \
                   iceDens , iceRadi , iceArea,  \
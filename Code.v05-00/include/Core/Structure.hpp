@@ -21,10 +21,12 @@
 #include <fstream>
 #include <sstream>
 #include <cmath> 
+#include <map>
 
 #include "Core/Interface.hpp"
 #include "Core/Parameters.hpp"
 #include "Util/ForwardDecl.hpp"
+#include "Util/Field.hpp"
 #include "Core/Input.hpp"
 #include "Core/Input_Mod.hpp"
 #include "KPP/KPP_Parameters.h"
@@ -56,9 +58,17 @@ class Solution
                        const UInt n_y,       \
                        const RealDouble value = 0.0 );
 
+        void SetShape( Field2D& field,  \
+                       const UInt n_x,  \
+                       const UInt n_y,  \
+                       const RealDouble value = 0.0 );
+
         void SetToValue( Vector_2D& vector_2D, \
                          const RealDouble value = 0.0 );
 
+        void SetToValue( Field2D& field, \
+                         const RealDouble value = 0.0 );
+
         void Print( const Vector_2D& vector_2D, \
                     const UInt i_max = 1,       \
                     const UInt j_max = 1 ) const;
@@ -70,18 +80,91 @@ class Solution
                          const OptInput &Input_Opt, \
                          const bool DBG );
 
-        void getData( const UInt i = 0, \
+        /* Copies the species of cell (j,i) into ctx.VAR and ctx.FIX.
+         * Species are stored one plane each, so this gathers NSPEC
+         * values one plane apart (see FieldStack::getCell) */
+        void getData( KppContext &ctx,  \
+                      const UInt i = 0, \
                       const UInt j = 0 );
 
-        void applyData( const UInt i = 0, \
+        /* Copies ctx.VAR into the species of cell (j,i), scattering
+         * NVAR values one plane apart */
+        void applyData( const KppContext &ctx, \
+                        const UInt i = 0,      \
                         const UInt j = 0 );
 
-        void applyRing( RealDouble tempArray[],        \
-                        const Vector_2Dui &mapIndices, \
-                        const UInt iRing );
-
-        void applyAmbient( const Vector_2Dui &mapIndices, \
-                           const UInt iRing );
+        /* Scales the species in the given cells by the ratio of the ring
+         * solution after (ctx.VAR) and before (tempArray) chemistry. Cells
+         * are flat indices, e.g. from Mesh::ringCells. */
+        void applyRing( const KppContext &ctx,  \
+                        RealDouble tempArray[], \
+                        const Vector_1Dui &cells );
+
+        /* Sets the species in the given cells to the solution in ctx.VAR */
+        void applyAmbient( const KppContext &ctx, \
+                           const Vector_1Dui &cells );
+
+        /**
+         * Groups cells of near-identical chemical state, so that one
+         * representative per cluster is integrated. Cells share a cluster
+         * when the logarithms of temperature, pressure, key species and,
+         * with heterogeneous chemistry, aerosol areas and ice volume fall
+         * in the same bins of width log(1+tol), i.e. they agree to within
+         * a factor 1+tol. Photolysis rates are uniform across the grid.
+         *
+         * @param cells (1D)       : flat indices of the cells to cluster
+         * @param met              : meteorology
+         * @param tol              : relative tolerance [-]
+         * @param hetChem          : account for aerosols
+         * @param clusterPtr (1D)  : cluster c holds clusterCell[clusterPtr[c]:clusterPtr[c+1]]
+         * @param clusterCell (1D) : flat indices, the first of each cluster being its representative
+         * @return number of clusters
+         */
+
+        UInt ClusterCells( const Vector_1Dui &cells,   \
+                           const Meteorology &met,     \
+                           const RealDouble tol,       \
+                           const bool hetChem,         \
+                           Vector_1Dui &clusterPtr,    \
+                           Vector_1Dui &clusterCell ) const;
+
+        /* Scales the species in cells[iBegin:iEnd] by the ratio of the
+         * representative solution after (ctx.VAR) and before (tempArray)
+         * chemistry, as applyRing does. Species that vanished in the
+         * representative are set to its solution. */
+        void applyCluster( const KppContext &ctx,       \
+                           const RealDouble tempArray[], \
+                           const Vector_1Dui &cells,     \
+                           const UInt iBegin,            \
+                           const UInt iEnd );
+
+        /**
+         * Flags the cells that belong to the plume: cells where a
+         * reactive species departs from its ambient value by more than
+         * ACTIVE_ATOL + rtol * |ambient|, or that hold more than
+         * ACTIVE_ICE_NUM ice crystals. Water vapor is not considered,
+         * since it follows the meteorology.
+         *
+         * @param ambient (1D) : ambient reactive species (NVAR)
+         * @param active (2D)  : 1 if the cell is active, 0 otherwise
+         * @param rtol         : relative departure [-]
+         * @return number of active cells
+         */
+
+        UInt ActiveCells( const Vector_1D &ambient, \
+                          Vector_2Dui &active,      \
+                          const RealDouble rtol = ACTIVE_RTOL ) const;
+
+        /**
+         * Sets the reactive species, water vapor excepted, to their
+         * ambient values in all inactive cells
+         *
+         * @param ambient (1D) : ambient reactive species (NVAR)
+         * @param active (2D)  : activity flags, from ActiveCells
+         */
+
+        void applyBackground( const Vector_1D &ambient, \
+                              const Vector_2Dui &active );
         
         void addEmission( const Emission &EI, const Aircraft &AC,            \
                           const Mesh &m,                                     \
@@ -109,15 +192,48 @@ class Solution
                     const RealDouble startTime, \
                     const bool DGB = 0 );
 
+        /**
+         * Grows the grid to n_x by n_y cells, keeping the current fields as
+         * the block starting at (j0, i0). New cells get far-field values:
+         * ambient for reactive species, the background at initialization
+         * for other species and aerosols, no plume water and the
+         * meteorological water vapor, which must be on the new grid.
+         * New cells have no chemistry step size yet.
+         *
+         * @param n_x (UInt)       : new number of cells in the x-direction
+         * @param n_y (UInt)       : new number of cells in the y-direction
+         * @param i0 (UInt)        : column offset of the current fields
+         * @param j0 (UInt)        : row offset of the current fields
+         * @param ambient (1D)     : far-field reactive species (NSPECREACT)
+         * @param met (Meteorology): meteorology on the new grid
+         */
+
+        void Regrid( const UInt n_x, const UInt n_y,   \
+                     const UInt i0, const UInt j0,     \
+                     const Vector_1D &ambient,         \
+                     const Meteorology &met );
+
         UInt Nx() const { return size_x; };
         UInt Ny() const { return size_y; };
         void Debug( const RealDouble airDens );
 
         /* Species */
-        Vector_3D Species;
+        FieldStack Species;
+
+        /* Last accepted chemistry step size in each cell, in [s].
+         * Zero until the cell has been integrated */
+        Field2D chemStep;
+
+        /* Rosenbrock steps taken by each cell over the last chemistry
+         * step, used as the predicted cost of the next one */
+        Field2D chemCost;
+
+        /* Number of chemistry steps whose first integration failed in
+         * each cell, recovered or not */
+        Field2D chemFail;
 
         /* Aerosols */
-        Vector_2D sootDens, sootRadi, sootArea;
+        Field2D sootDens, sootRadi, sootArea;
 
         AIM::Grid_Aerosol liquidAerosol, solidAerosol;
 
@@ -145,11 +261,16 @@ class Solution
 
         const UInt nVariables;
         const UInt nAer;
-        const UInt size_x;
-        const UInt size_y;
+        UInt size_x;
+        UInt size_y;
 
         bool reducedSize;
 
+        /* Background values at initialization, used to fill new cells */
+        Vector_1D backgSpecies;
+        Vector_1D backgSoot;
+        Vector_1D backgLA, backgPA;
+
 };
 
 #endif /* STRUCTURE_H_INCLUDED */
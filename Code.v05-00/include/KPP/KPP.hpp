@@ -17,12 +17,48 @@
 
 #include "KPP/KPP_Parameters.h"
 
+/* Number of cells integrated in lockstep by INTEGRATE_BATCH */
+#define KPP_NBATCH 8
+
+/* LU decomposition used by INTEGRATE: the generated KppDecomp, or
+ * KppDecompScheduled, which precomputes the elimination once */
+#define KPP_DECOMP_GENERATED 0
+#define KPP_DECOMP_SCHEDULED 1
+
+/* Maximum number of consecutive steps of INTEGRATE taken with the same
+ * Jacobian, when Jacobian reuse is enabled (KppContext::THETAMIN > 0) */
+#define KPP_JAC_MAXAGE 10
+
+/* Integration statistics, in the order of IPAR[10:19] of INTEGRATE:
+ * function and Jacobian evaluations, steps, accepted and rejected steps,
+ * LU decompositions, solves, singular and reused decompositions, and
+ * steps taken with a previous Jacobian */
+enum { KPP_NFUN = 0, KPP_NJAC, KPP_NSTP, KPP_NACC, KPP_NREJ, KPP_NDEC, \
+       KPP_NSOL, KPP_NSNG, KPP_NREU, KPP_NFRZ, KPP_NSTAT };
+
+/* Rosenbrock methods of INTEGRATE (KppContext::METHOD). Zero selects
+ * KPP_RODAS4 */
+#define KPP_ROS2   1
+#define KPP_RODAS4 5
+
+/* Failed integrations are retried by INTEGRATE_FALLBACK from a starting
+ * step of KPP_FALLBACK_STEP [s], the last rung being sub-cycled over
+ * KPP_FALLBACK_NSUB intervals */
+#define KPP_FALLBACK_STEP 1.0E-10
+#define KPP_FALLBACK_NSUB 10
+
+/* Quasi-steady state iterations of REDUCED_ADVANCE */
+#define KPP_QSSA_ITER 2
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
-int INTEGRATE( double VAR[] , double TIN   , double TOUT, \
-               double ATOL[], double RTOL[], double STEPMIN );
+int INTEGRATE_BATCH( double VARB[], const double FIXB[], const double RCTB[], \
+                     const int nLane, double TIN, double TOUT,               \
+                     double ATOL[], double RTOL[], double STEPMIN,           \
+                     double THETAMIN, double HB[], int IERRB[],              \
+                     int ISTATB[] );
 int KPP_Main_ADJ( const double finalPlume[], const double initBackg[],  \
                   const double temperature_K, const double pressure_Pa, \
                   const double airDens, const double timeArray[],       \
@@ -38,11 +74,6 @@ int INTEGRATE_ADJ( int NADJ, double Y[], double Lambda[][NVAR],        \
                    double RSTATUS_U[], double STEPMIN );
 void Update_RCONST( const double TEMP, const double PRESS,  \
                     const double AIRDENS, const double H2O );
-void GC_SETHET( const double TEMP, const double PATM, const double AIRDENS, \
-                const double RELHUM, const unsigned int STATE_PSC,          \
-                const double SPC[], const double AREA[NAERO],               \
-                const double RADI[NAERO], const double IWC,                 \
-                const double KHETI_SLA[11] );
 void Update_JRates ( double JRates[], const double CSZA );
 void ComputeFamilies( const double V[], const double F[], const double RCT[], \
                       double familyRates[] );
@@ -55,4 +86,47 @@ static int KPPADJ_FAIL = -5;
 }
 #endif /* __cplusplus */
 
+#ifdef __cplusplus
+
+#include "KPP/KPP_Context.hpp"
+
+/* Reentrant interface: each routine only reads and writes the context it
+ * is given. Update_RCONST above works on the threadprivate globals and is
+ * only kept for the adjoint driver. */
+
+int INTEGRATE( KppContext &ctx, double TIN, double TOUT );
+int INTEGRATE_FALLBACK( KppContext &ctx, const double VAR0[], \
+                        double TIN, double TOUT, int *RUNG );
+void Update_RCONST( KppContext &ctx,                            \
+                    const double TEMP, const double PRESS,      \
+                    const double AIRDENS, const double H2O );
+
+/* Same as above, with the thermal rates at (TEMP, PRESS, AIRDENS) taken
+ * from RCT_T, as tabulated by KppRateCache. The remaining rates do not
+ * depend on pressure */
+void Update_RCONST( KppContext &ctx, const double RCT_T[],      \
+                    const double TEMP, const double AIRDENS,    \
+                    const double H2O );
+
+/* Rate constants that only depend on TEMP, PRESS and AIRDENS. All other
+ * entries of RCT are left untouched */
+void Update_RCONST_Thermal( double RCT[],                           \
+                            const double TEMP, const double PRESS,  \
+                            const double AIRDENS );
+void GC_SETHET( KppContext &ctx,                                    \
+                const double TEMP, const double PATM,               \
+                const double AIRDENS, const double RELHUM,          \
+                const unsigned int STATE_PSC,                       \
+                const double AREA[NAERO], const double RADI[NAERO], \
+                const double IWC, const double KHETI_SLA[11] );
+void Fun( KppContext &ctx, double Y[], double Ydot[] );
+void Jac_SP( KppContext &ctx, double Y[], double JVS[] );
+
+/* Reduced chemistry of cells close to the ambient, see KPP_Reduced.cpp */
+int REDUCED_PREPARE( KppContext &ctx, double DT, double JVS[] );
+void REDUCED_ADVANCE( KppContext &ctx, double JVS[],                 \
+                      const double VAR0[], const double VAR1[] );
+
+#endif /* __cplusplus */
+
 #endif /* KPP_H_INCLUDED */
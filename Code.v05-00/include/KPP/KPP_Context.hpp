@@ -0,0 +1,112 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* KPP_Context Header File                                          */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : KPP_Context.hpp                           */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef KPP_CONTEXT_H_INCLUDED
+#define KPP_CONTEXT_H_INCLUDED
+
+#include "KPP/KPP_Parameters.h"
+
+/* Complete state of one chemistry integration: concentrations, rate
+ * constants, photolysis and heterogeneous rates, tolerances, integrator
+ * parameters and statistics.
+ *
+ * The context versions of Update_RCONST, GC_SETHET, Fun, Jac_SP and
+ * INTEGRATE only read and write the context they are given, so that
+ * any number of contexts can be integrated concurrently, from any kind
+ * of thread or task. A context is a plain value: copying it copies the
+ * whole state, with VAR and FIX pointing into the copy. */
+
+struct KppContext
+{
+
+    KppContext( );
+    KppContext( const KppContext &ctx );
+    KppContext& operator=( const KppContext &ctx );
+
+    /* Sets vector tolerances and the starting step */
+    void SetTolerances( const double RTOLS, const double ATOLS, \
+                        const double STEPMIN_ );
+
+    /* Resets the integration statistics */
+    void ResetStats( );
+
+    /* Returns the statistics accumulated so far (Ns, Na, ... NfrzTot),
+     * in the KPP_NSTAT layout of KPP.hpp */
+    void GetStats( unsigned long ISTAT[] ) const;
+
+    /* Accumulates statistics in the KPP_NSTAT layout, e.g. those of
+     * INTEGRATE_BATCH or of another context */
+    void AddStats( const unsigned long ISTAT[] );
+
+    /* Prints the cost breakdown accumulated by INTEGRATE, and the
+     * statistics added through AddStats */
+    void PrintCost( ) const;
+
+    /* Concentration of all species, in [molec/cm^3].
+     * VAR points to C, FIX to C + NVAR */
+    double C[NSPEC];
+    double *VAR;
+    double *FIX;
+
+    /* Rate constants */
+    double RCONST[NREACT];
+
+    /* Photolysis rates */
+    double PHOTOL[NPHOTOL];
+
+    /* Heterogeneous reaction rates */
+    double HET[NSPEC][3];
+
+    /* Current integration time and constants to compute cosSZA */
+    double TIME;
+    double SZA_CST[3];
+
+    /* Tolerances and starting step */
+    double ATOL[NVAR];
+    double RTOL[NVAR];
+    double STEPMIN;
+
+    /* LU decomposition used by INTEGRATE, KPP_DECOMP_* */
+    int DECOMP;
+
+    /* Rosenbrock method used by INTEGRATE, KPP_ROS2 or KPP_RODAS4 */
+    int METHOD;
+
+    /* Jacobian reuse threshold of INTEGRATE: the Jacobian is kept while
+     * it linearizes F over the last step to within THETAMIN. Zero
+     * recomputes it at every step */
+    double THETAMIN;
+
+    /* Integrator parameters, in the layout of Rosenbrock.
+     * Outputs of the last call are in IPAR[10:17] and RPAR[10:11] */
+    int    IPAR[20];
+    double RPAR[20];
+
+    /* Statistics of the current call to INTEGRATE: function and
+     * Jacobian evaluations, steps, accepted and rejected steps, LU
+     * decompositions, solves, singular and reused decompositions, and
+     * steps taken with a previous Jacobian */
+    int Nfun, Njac, Nstp, Nacc, Nrej, Ndec, Nsol, Nsng, Nreu, Nfrz;
+
+    /* Steps, accepted, rejected steps and singular decompositions,
+     * accumulated over all calls to INTEGRATE */
+    unsigned long Ns, Na, Nr, Ng;
+
+    /* Cost breakdown, accumulated over all calls to INTEGRATE: function
+     * and Jacobian evaluations, LU decompositions and solves, reused
+     * decompositions and steps taken with a previous Jacobian */
+    unsigned long NfunTot, NjacTot, NdecTot, NsolTot, NreuTot, NfrzTot;
+
+};
+
+#endif /* KPP_CONTEXT_H_INCLUDED */
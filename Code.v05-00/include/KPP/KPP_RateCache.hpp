@@ -0,0 +1,78 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* KPP_RateCache Header File                                        */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : KPP_RateCache.hpp                         */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef KPP_RATECACHE_H_INCLUDED
+#define KPP_RATECACHE_H_INCLUDED
+
+#include <map>
+#include <vector>
+
+#include "KPP/KPP_Parameters.h"
+
+/* Maximum number of meteorological states held by a KppRateCache before
+ * it is cleared */
+#define KPP_RATECACHE_MAX 4096
+
+/* Memoized thermal rate constants.
+ *
+ * Most rate constants only depend on temperature, pressure and air
+ * density (see Update_RCONST_Thermal), which only take a handful of
+ * distinct values across a grid. The cache tabulates them once for each
+ * exact (TEMP, PRESS, AIRDENS) state; the water vapour, heterogeneous
+ * and photolysis rates are then filled in for each cell by
+ * Update_RCONST( ctx, RCT_T, ... ).
+ *
+ * Lookup may tabulate a new state and is not thread-safe. Rates only
+ * reads the tables and can be called concurrently. */
+
+class KppRateCache
+{
+
+    public:
+
+        KppRateCache( );
+        ~KppRateCache( );
+
+        /* Returns the index of the tables for (TEMP, PRESS, AIRDENS),
+         * tabulating them on a miss */
+        unsigned int Lookup( const double TEMP, const double PRESS, \
+                             const double AIRDENS );
+
+        /* Thermal rate constants of entry iEntry, zero for all other
+         * reactions */
+        const double* Rates( const unsigned int iEntry ) const
+        { return &table[iEntry * NREACT]; }
+
+        /* Drops all tables. Indices returned by Lookup are invalidated */
+        void Clear( );
+
+        unsigned int Size( ) const { return index.size(); }
+        unsigned long Hits( ) const { return nHit; }
+        unsigned long Misses( ) const { return nMiss; }
+
+    private:
+
+        struct Key
+        {
+            double TEMP, PRESS, AIRDENS;
+            bool operator<( const Key &k ) const;
+        };
+
+        std::map<Key, unsigned int> index;
+        std::vector<double> table;
+
+        unsigned long nHit, nMiss;
+
+};
+
+#endif /* KPP_RATECACHE_H_INCLUDED */
@@ -16,6 +16,8 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <vector>
+#include <algorithm>
 #ifdef OMP
     #include "omp.h"
 #endif /* OMP */
@@ -24,7 +26,9 @@
 #include <Core/Parameters.hpp>
 
 #include <Util/ForwardDecl.hpp>
+#include <Util/Field.hpp>
 #include <fftw3.h>
+#include <SANDS/PlanRegistry.hpp>
 
 #define REAL      0
 #define IMAG      1
@@ -291,10 +295,26 @@ class FourierTransform_1D<double>
 //         *
 //         * @param in (2D complex) : Advection array corresponding to shear
 //         * @param V  (2D scalar)  : vector to be "sheared"
+//         *
+//         * Field can either be a Vector_2D or a Field2D
 //         */
 
-        virtual void ApplyShear( const Vector_2Dc &shearFactor, \
-                                 Vector_2D &V ) const;
+        template <class Field>
+        void ApplyShear( const Vector_2Dc &shearFactor, \
+                         Field &V ) const;
+
+        /**
+         * Same as above, for several fields at once. All layers of a
+         * field are transformed with a single batched plan and fields
+         * are spread over threads.
+         *
+         * @param in (2D complex) : Advection array corresponding to shear
+         * @param V  (2D scalar*) : fields to be "sheared"
+         */
+
+        template <class Field>
+        void ApplyShear( const Vector_2Dc &shearFactor, \
+                         std::vector<Field*> &V ) const;
 
         /* Rows of real and complex data */
         const UInt rows;
@@ -309,6 +329,10 @@ class FourierTransform_1D<double>
         /* Switch for threaded FFT? */
         const bool THREADED_FFT;
 
+        /* Planner options, kept to get the batched plans */
+        const bool WISDOM_;
+        const std::string FFTW_DIR_;
+
         /* Pointer to arrays for fftw_plans */
         scalar_type  *in_FFT , *out_IFFT;
         complex_type *in_IFFT, *out_FFT;
@@ -464,123 +488,107 @@ class FourierTransform_2D<float>
         /** 
          * Constructor
          *
+         * Transforms are computed in single precision. Fields are still
+         * stored in double precision and are converted when staged.
+         *
          * @param MULTITHREAD_FFT  : Use threaded FFT?
          * @param WISDOM (bool)    : Use FFTW_WISDOM?
          * @param FFTW_DIR (char*) : Path to storage for FFTW plans?
          * @param rows_ (UInt)     : number of rows 
          * @param cols_ (UInt)     : number of columns 
+         * @param nBatch_ (UInt)   : max. number of fields per batched
+         *                           transform (default = 1, no batch plans)
          */
 
         FourierTransform_2D( const bool MULTITHREADED_FFT, \
                              const bool WISDOM,            \
                              const char* FFTW_DIR,         \
                              const UInt rows_,             \
-                             const UInt cols_ );
+                             const UInt cols_,             \
+                             const UInt nBatch_ = 1 );
 
         /**
          * Destructor 
          *
-         * Destroy the FFT and IFFT plans 
+         * Frees the work arrays. Plans are owned by FFT_PlanRegistry.
          */
 
         ~FourierTransform_2D();
 
         /**
-         * Performs forward 2D Fourier transform of real-valued data
-         * Takes scalar array as an input and outputs a complex array
+         * Sets the propagators used by SANDS, rounded to single precision.
+         * See FourierTransform_2D<double>::SetFactors.
          *
-         * Reuses the FFT plan.
+         * @param PropX (1D complex) : x-propagator, size >= rows
+         * @param PropY (1D complex) : y-propagator, size >= cols
+         */
+
+        void SetFactors( const Vector_1Dc &PropX, \
+                         const Vector_1Dc &PropY );
+
+        /** 
+         * Solves the 2D diffusion-advection equation with the factors set
+         * through SetFactors. Fields are staged into a single precision
+         * buffer, transformed and converted back.
          *
-         * @param in  (1D scalar)  : input to the FFT
-         * @param out (1D complex) : output to the FFT
+         * @param V (2D scalar) : field to be transported
          */
 
-//        virtual void Forward( scalar_type* in, complex_type* out ) const;
-//
-//        /**
-//         * Performs forward 2D Fourier transform of real-valued data
-//         * Takes scalar 2D vector as an input and outputs a complex array
-//         *
-//         * Reuses the FFT plan.
-//         *
-//         * @param V   (2D scalar)  : input to the FFT
-//         * @param out (1D complex) : output to the FFT
-//         */
-//
-//        virtual void Forward( const Vector_2Df &V, complex_type* out ) const;
-//
-//        /**
-//         * Performs backward 2D Fourier transform of real-valued data
-//         * Takes complex array as an input and outputs a real-valued array
-//         *
-//         * Reuses the IFFT plan.
-//         *
-//         * Results are scaled by rows * cols
-//         *
-//         * @param in  (1D complex) : input to the IFFT
-//         * @param out (1D scalar)  : output to the IFFT
-//         */
-//
-//        virtual void Backward( complex_type* in, scalar_type* out ) const;
-//
-//        /**
-//         * Performs backward 2D Fourier transform of real-valued data
-//         * Takes complex array as an input and outputs a 2D real-valued vector
-//         *
-//         * Reuses the IFFT plan.
-//         *
-//         * Results are scaled by rows * cols
-//         *
-//         * @param in (1D complex) : input to the IFFT
-//         * @param V  (2D scalar)  : output to the IFFT
-//         */
-//
-//        virtual void Backward( complex_type* in, Vector_2Df &V ) const;
-//
-//        /** 
-//         * Scales the input array by 1 / (rows * cols) 
-//         *
-//         * @param in (1D scalar) : array to be scaled
-//         */
-//
-//        virtual void Scale( scalar_type* in ) const;
-//
-//        /** 
-//         * Solves the 2D diffusion-advection equation
-//         *
-//         * @param DiffFactor (2D scalar)  : diffusion factor for the 2D spectral solver 
-//         * @param AdvFactor  (2D complex) : advection factor for the 2D spectral solver 
-//         * @param V          (2D scalar)  : vector to be transported
-//         */
+        template <class Field>
+        void SANDS( Field &V ) const;
+
+        /** 
+         * Solves the 2D diffusion-advection equation for a stack of fields
+         * sharing the same diffusion and advection factors, nBatch at a
+         * time.
+         *
+         * @param V (2D scalar*) : fields to be transported
+         */
 
-        void SANDS( const Vector_2Df &DiffFactor, \
-                    const Vector_2Dcf &AdvFactor, \
-                    Vector_2Df &V ) const;
+        template <class Field>
+        void SANDS( std::vector<Field*> &V ) const;
 
-        /* Rows of real and complex data */
+        /* Number of points in x (fastest varying) */
         const UInt rows;
-        /* Columns of real data only */
+        /* Number of points in y */
         const UInt cols;
-        /* Columns in the complex spectrum */
-        const UInt colsC;
+        /* Number of x-frequencies in the complex half spectrum */
+        const UInt rowsC;
 
         /* Scaling factor */
         const UInt fftScaling;
 
+        /* Max. number of fields per batched transform */
+        const UInt nBatch;
+
     private:
 
+        /* Multiplies a half spectrum by the fused factor, in place */
+        void Convolve( complex_type* spectrum ) const;
+
         /* Switch for threaded FFT? */
         const bool THREADED_FFT;
 
-        /* Pointer to arrays for fftw_plans */
-        scalar_type  *in_FFT , *out_IFFT;
-        complex_type *in_IFFT, *out_FFT;
+        /* Staging buffer and spectrum */
+        scalar_type  *in_FFT;
+        complex_type *out_FFT;
+
+        /* Per-axis advection/diffusion propagators */
+        complex_type *factorX, *factorY;
 
         /* Reusable plan for forward transformation */
         fftwf_plan plan_FFT;
         /* Reusable plan for backward transformation */
         fftwf_plan plan_IFFT;
 
+        /* Pointer to arrays for batched fftw_plans */
+        scalar_type  *in_FFT_many;
+        complex_type *out_FFT_many;
+
+        /* Reusable batched plans for forward and backward transformations */
+        fftwf_plan plan_FFT_many;
+        fftwf_plan plan_IFFT_many;
+
 };
 
 template <>
@@ -601,13 +609,16 @@ class FourierTransform_2D<double>
          * @param FFTW_DIR (char*) : Path to storage for FFTW plans?
          * @param rows_ (UInt)     : number of rows 
          * @param cols_ (UInt)     : number of columns 
+         * @param nBatch_ (UInt)   : max. number of fields per batched
+         *                           transform (default = 1, no batch plans)
          */
 
         FourierTransform_2D( const bool MULTITHREADED_FFT, \
                              const bool WISDOM,            \
                              const char* FFTW_DIR,         \
                              const UInt rows_,             \
-                             const UInt cols_ );
+                             const UInt cols_,             \
+                             const UInt nBatch_ = 1 );
 
         /**
          * Destructor 
@@ -618,101 +629,88 @@ class FourierTransform_2D<double>
         ~FourierTransform_2D();
 
         /**
-         * Performs forward 2D Fourier transform of real-valued data
-         * Takes scalar array as an input and outputs a complex array
+         * Sets the propagators used by SANDS. The advection-diffusion
+         * factor is separable in kx and ky and is applied as the outer
+         * product PropY[jNy] * PropX[iNx] inside the spectral multiply.
+         * The normalization of the backward transform is folded into
+         * PropX. Only needs to be called when either propagator changes.
          *
-         * Reuses the FFT plan.
+         * @param PropX (1D complex) : x-propagator, size >= rows
+         * @param PropY (1D complex) : y-propagator, size >= cols
+         */
+
+        void SetFactors( const Vector_1Dc &PropX, \
+                         const Vector_1Dc &PropY );
+
+        /** 
+         * Solves the 2D diffusion-advection equation with the factors set
+         * through SetFactors.
          *
-         * @param in  (1D scalar)  : input to the FFT
-         * @param out (1D complex) : output to the FFT
+         * Transforms act directly on the row-major layout V[jNy][iNx].
+         * Contiguous fields (Field2D) are passed to FFTW without any copy,
+         * nested vectors are staged row by row.
+         *
+         * @param V (2D scalar) : field to be transported
          */
 
-//        virtual void Forward( scalar_type* in, complex_type* out ) const;
-//
-//        /**
-//         * Performs forward 2D Fourier transform of real-valued data
-//         * Takes scalar 2D vector as an input and outputs a complex array
-//         *
-//         * Reuses the FFT plan.
-//         *
-//         * @param V   (2D scalar)  : input to the FFT
-//         * @param out (1D complex) : output to the FFT
-//         */
-//
-//        virtual void Forward( const Vector_2D &V, complex_type* out ) const;
-//
-//        /**
-//         * Performs backward 2D Fourier transform of real-valued data
-//         * Takes complex array as an input and outputs a real-valued array
-//         *
-//         * Reuses the IFFT plan.
-//         *
-//         * Results are scaled by rows * cols
-//         *
-//         * @param in  (1D complex) : input to the IFFT
-//         * @param out (1D scalar)  : output to the IFFT
-//         */
-//
-//        virtual void Backward( complex_type* in, scalar_type* out ) const;
-//
-//        /**
-//         * Performs backward 2D Fourier transform of real-valued data
-//         * Takes complex array as an input and outputs a 2D real-valued vector
-//         *
-//         * Reuses the IFFT plan.
-//         *
-//         * Results are scaled by rows * cols
-//         *
-//         * @param in (1D complex) : input to the IFFT
-//         * @param V  (2D scalar)  : output to the IFFT
-//         */
-//
-//        virtual void Backward( complex_type* in, Vector_2D &V ) const;
-//
-//        /** 
-//         * Scales the input array by 1 / (rows * cols) 
-//         *
-//         * @param in (1D scalar) : array to be scaled
-//         */
-//
-//        virtual void Scale( scalar_type* in ) const;
-//
-//        /** 
-//         * Solves the 2D diffusion-advection equation
-//         *
-//         * @param DiffFactor (2D scalar)  : diffusion factor for the 2D spectral solver 
-//         * @param AdvFactor  (2D complex) : advection factor for the 2D spectral solver 
-//         * @param V          (2D scalar)  : vector to be transported
-//         */
+        template <class Field>
+        void SANDS( Field &V ) const;
 
-        void SANDS( const Vector_2D &DiffFactor, \
-                    const Vector_2Dc &AdvFactor, \
-                    Vector_2D &V ) const;
+        /** 
+         * Solves the 2D diffusion-advection equation for a stack of fields
+         * sharing the same diffusion and advection factors.
+         *
+         * Fields are transformed nBatch at a time through a single
+         * fftw_plan_many_dft_r2c/c2r pair. Falls back to the single-field
+         * solver if no batch plans were created.
+         *
+         * @param V (2D scalar*) : fields to be transported
+         */
 
-        /* Rows of real and complex data */
+        template <class Field>
+        void SANDS( std::vector<Field*> &V ) const;
+
+        /* Number of points in x (fastest varying) */
         const UInt rows;
-        /* Columns of real data only */
+        /* Number of points in y */
         const UInt cols;
-        /* Columns in the complex spectrum */
-        const UInt colsC;
+        /* Number of x-frequencies in the complex half spectrum */
+        const UInt rowsC;
 
         /* Scaling factor */
         const UInt fftScaling;
 
+        /* Max. number of fields per batched transform */
+        const UInt nBatch;
+
     private:
 
+        /* Multiplies a half spectrum by the fused factor, in place */
+        void Convolve( complex_type* spectrum ) const;
+
         /* Switch for threaded FFT? */
         const bool THREADED_FFT;
 
-        /* Pointer to arrays for fftw_plans */
-        scalar_type  *in_FFT , *out_IFFT;
-        complex_type *in_IFFT, *out_FFT;
+        /* Staging buffer for non-contiguous fields and spectrum */
+        scalar_type  *in_FFT;
+        complex_type *out_FFT;
+
+        /* Per-axis advection/diffusion propagators */
+        complex_type *factorX, *factorY;
 
         /* Reusable plan for forward transformation */
         fftw_plan plan_FFT;
         /* Reusable plan for backward transformation */
         fftw_plan plan_IFFT;
 
+        /* Pointer to arrays for batched fftw_plans */
+        scalar_type  *in_FFT_many;
+        complex_type *out_FFT_many;
+
+        /* Reusable batched plans for forward and backward transformations */
+        fftw_plan plan_FFT_many;
+        fftw_plan plan_IFFT_many;
+
 
 };
 
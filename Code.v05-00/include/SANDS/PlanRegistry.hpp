@@ -0,0 +1,88 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*              Spectral Advection aNd Diffusion Solver             */
+/*                             (SANDS)                              */
+/*                                                                  */
+/* PlanRegistry Header File                                         */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : PlanRegistry.hpp                          */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef PLANREGISTRY_H_INCLUDED
+#define PLANREGISTRY_H_INCLUDED
+
+#include <iostream>
+#include <string>
+#include <fftw3.h>
+
+#include "Util/ForwardDecl.hpp"
+
+/* Name of the wisdom files, stored in the FFTW directory. FFTW keeps
+ * separate wisdom for each precision. */
+#define FFTW_WISDOM_FILE   "FFTW_wisdom.pl"
+#define FFTW_WISDOM_FILE_F "FFTW_wisdomf.pl"
+
+/* Process-wide registry of double and single precision FFTW plans.
+ *
+ * Plans are created once, on first request, and shared by all solver
+ * instances (i.e. all cases running in parallel). They are only executed
+ * through the new-array interface (fftw_execute_dft_r2c/c2r) on buffers
+ * owned by each instance, which is thread-safe. All calls to the FFTW
+ * planner are serialized here, since the planner itself is not.
+ *
+ * Plans are out-of-place, with contiguous fields stored one after the
+ * other, and are keyed by (type, dimensions, number of fields, number of
+ * threads), separately for each precision. Planning buffers are allocated
+ * with fftw_malloc, so any fftw_malloc'd or FIELD_ALIGN-aligned array can
+ * be used at execution. */
+
+class FFT_PlanRegistry
+{
+
+    public:
+
+        enum PlanType { R2C = 0, C2R = 1 };
+
+        /**
+         * Returns a plan, creating it if needed. When WISDOM is set, the
+         * wisdom file in FFTW_DIR is imported once and any newly created
+         * plan is merged back into it atomically.
+         *
+         * @param type (PlanType)         : forward (R2C) or backward (C2R)
+         * @param n0 (UInt)               : slowest varying dimension
+         * @param n1 (UInt)               : fastest varying dimension (0 for 1D)
+         * @param howMany (UInt)          : number of fields per transform
+         * @param MULTITHREADED_FFT (bool): use threaded FFT?
+         * @param WISDOM (bool)           : use FFTW wisdom?
+         * @param FFTW_DIR (char*)        : path to storage for FFTW wisdom
+         */
+
+        static fftw_plan Get( const PlanType type,             \
+                              const UInt n0,                   \
+                              const UInt n1,                   \
+                              const UInt howMany,              \
+                              const bool MULTITHREADED_FFT,    \
+                              const bool WISDOM,               \
+                              const char* FFTW_DIR );
+
+        /* Same as above, for single precision plans */
+        static fftwf_plan GetSingle( const PlanType type,             \
+                                     const UInt n0,                   \
+                                     const UInt n1,                   \
+                                     const UInt howMany,              \
+                                     const bool MULTITHREADED_FFT,    \
+                                     const bool WISDOM,               \
+                                     const char* FFTW_DIR );
+
+        /* Number of plans in the registry */
+        static UInt Size( );
+
+        /* Destroys all plans. Only call once no solver is left. */
+        static void Clear( );
+
+};
+
+#endif /* PLANREGISTRY_H_INCLUDED */
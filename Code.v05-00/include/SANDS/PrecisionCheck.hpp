@@ -0,0 +1,45 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*              Spectral Advection aNd Diffusion Solver             */
+/*                             (SANDS)                              */
+/*                                                                  */
+/* PrecisionCheck Header File                                       */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : PrecisionCheck.hpp                        */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef PRECISIONCHECK_H_INCLUDED
+#define PRECISIONCHECK_H_INCLUDED
+
+#include "Util/ForwardDecl.hpp"
+
+namespace SANDS
+{
+
+    /**
+     * Regression check of the single precision transport against the
+     * double precision path, on the compiled grid.
+     *
+     * A plume-like field is transported for each class of fields that
+     * can run in single precision (species, aerosols, ring weights),
+     * with representative diffusion, settling and shear. For each class
+     * and output step, prints the relative mass change of both paths and
+     * the relative L2 and max. errors of the single precision result.
+     *
+     * @param MULTITHREADED_FFT (bool): Use threaded FFT?
+     * @param WISDOM (bool)           : Use FFTW wisdom?
+     * @param FFTW_DIR (char*)        : Path to storage for FFTW wisdom
+     *
+     * Returns the largest relative L2 error over all classes
+     */
+
+    RealDouble PrecisionCheck( const bool MULTITHREADED_FFT, \
+                               const bool WISDOM,            \
+                               const char* FFTW_DIR );
+
+} /* SANDS */
+
+#endif /* PRECISIONCHECK_H_INCLUDED */
@@ -16,9 +16,11 @@
 
 #include <iostream>
 #include <vector>
+#include <map>
 #include <complex>
 #include <fftw3.h>
 #include <fstream>
+#include <string>
 #ifdef OMP
     #include "omp.h"
 #endif /* OMP */
@@ -27,6 +29,8 @@
 #include "Core/Interface.hpp"
 #include "Util/PhysConstant.hpp"
 #include "Util/ForwardDecl.hpp"
+#include "Util/Field.hpp"
+#include "Core/Mesh.hpp"
 #include "SANDS/FFT.hpp"
 
 namespace SANDS 
@@ -56,6 +60,8 @@ namespace SANDS
              * @param fill (bool)      : Fill negative values? (default = 1)
              * @param fillVal (double) : Fill with? (default = 0.0E+00) 
              * @param fillOpt (int)    : Fill option
+             * @param singlePrecision (bool): Set up single precision
+             *                          transforms? (default = 0)
              */
 
             void Initialize( const bool MULTITHREADED_FFT,         \
@@ -63,7 +69,8 @@ namespace SANDS
                              const char* FFTW_DIR = "",            \
                              const bool fill = 1,                  \
                              const RealDouble fillValue = 0.0E+00, \
-                             const UInt fillOpt_ = 1 );
+                             const UInt fillOpt_ = 1,              \
+                             const bool singlePrecision = 0 );
 
             /**
              * Destructor 
@@ -73,6 +80,16 @@ namespace SANDS
 
             ~Solver( );
 
+            /**
+             * Moves the solver to another grid, e.g. after the domain has
+             * grown. Transforms are rebuilt and all propagators are
+             * recomputed on their next update.
+             *
+             * @param m (Mesh) : new grid
+             */
+
+            void Regrid( const Mesh &m );
+
             /**
              * Assign frequencies 
              */
@@ -85,6 +102,10 @@ namespace SANDS
              * @param T (double) : New timestep [s]
              *
              * Returns an error if T <= 0.0
+             * Propagators are kept for the last SANDS_NTIMESTEP time
+             * steps, so that alternating between a few time steps (e.g.
+             * transport sub-steps) does not recompute them. Propagators
+             * for a new time step are recomputed on their next update.
              */
 
             void UpdateTimeStep( const RealDouble T );
@@ -103,6 +124,10 @@ namespace SANDS
             /**
              * Update advection field 
              *
+             * Vertical propagators are cached per velocity, so that
+             * alternating between settling velocities (one per particle
+             * bin) does not recompute them.
+             *
              * @param vH (double) : Horizontal advection velocity [m/s]
              * @param vV (double) : Vertical advection velocity [m/s]
              */
@@ -122,13 +147,55 @@ namespace SANDS
              * Solves the 2D advection-diffusion equation over dt using
              * the diffusion and advection fields 
              *
-             * @param V (2D vector)         : Field to be diffused 
+             * Only the departure from the far-field value (the corner
+             * cell) is transformed. Fields that are uniform to within
+             * SANDS_UNIFORM_TOL are not transformed at all, since
+             * transport leaves them unchanged.
+             *
+             * @param V (2D field)          : Field to be diffused 
+             *                               (Vector_2D or Field2D)
              * @param cellAreas (2D vector) : Cell areas in m^2
              * @param fillOpt_ (int)        : Fill option
+             * @param singlePrecision (bool): Transform in single precision?
+             *                                Requires the solver to be
+             *                                initialized accordingly.
+             */
+
+            template <class Field>
+            void Run( Field &V, const Vector_2D &cellAreas, \
+                      const int fillOpt_ = 0,               \
+                      const bool singlePrecision = 0 );
+
+            /**
+             * Solves the 2D advection-diffusion equation over dt for a
+             * stack of fields sharing the same diffusion and advection
+             * fields. Fields are transformed in batches of SANDS_NBATCH.
+             *
+             * @param V (2D field*)         : Fields to be diffused
+             * @param cellAreas (2D vector) : Cell areas in m^2
+             * @param fillOpt_ (int)        : Fill option, applied to each field
+             * @param singlePrecision (bool): Transform in single precision?
              */
 
-            void Run( Vector_2D &V, const Vector_2D &cellAreas, \
-                      const int fillOpt_ = 0 );
+            template <class Field>
+            void RunMany( std::vector<Field*> &V, const Vector_2D &cellAreas, \
+                          const int fillOpt_ = 0,                             \
+                          const bool singlePrecision = 0 );
+
+            /**
+             * Same as above, for all fields of a 3D vector or field stack
+             *
+             * @param V (3D vector)         : Fields to be diffused
+             * @param cellAreas (2D vector) : Cell areas in m^2
+             * @param fillOpt_ (int)        : Fill option, applied to each field
+             */
+
+            void RunMany( Vector_3D &V, const Vector_2D &cellAreas, \
+                          const int fillOpt_ = 0,                   \
+                          const bool singlePrecision = 0 );
+            void RunMany( FieldStack &V, const Vector_2D &cellAreas, \
+                          const int fillOpt_ = 0,                    \
+                          const bool singlePrecision = 0 );
 
             /**
              * Fill value below threshold with value
@@ -138,7 +205,8 @@ namespace SANDS
              * @param threshold (double) : Threshold (default = 0.0)
              */
 
-            void Fill( Vector_2D &V, const RealDouble val, \
+            template <class Field>
+            void Fill( Field &V, const RealDouble val, \
                        const RealDouble threshold = 0.0 );
             
             /**
@@ -149,7 +217,8 @@ namespace SANDS
              * @param cellAreas (2D vector) : Cell areas in m^2
              */
     
-            void ScinoccaCorr( Vector_2D &V, const RealDouble mass0, \
+            template <class Field>
+            void ScinoccaCorr( Field &V, const RealDouble mass0, \
                                const Vector_2D &cellAreas );
 
             /** 
@@ -164,6 +233,14 @@ namespace SANDS
 
             Vector_2Dc getAdvFactor( ) const;
 
+            /**
+             * Returns the number of fields transported and the number of
+             * uniform fields that were skipped since construction
+             */
+
+            unsigned long nFieldsRun( ) const { return nRun; };
+            unsigned long nFieldsSkipped( ) const { return nSkipped; };
+
         protected:
 
             unsigned int n_x, n_y;
@@ -178,11 +255,65 @@ namespace SANDS
 
         private:
 
-            /* Diffusion and advection field */
-            Vector_2D DiffFactor;
-            Vector_2Dc AdvFactor;
+            /* Allocates the transforms for the current grid */
+            void CreateTransforms( const bool singlePrecision );
+
+            /* Passes the per-axis propagators to FFT_2D if needed */
+            void SetFactors( );
+
+            /* Without diffusion nor advection, only shear moves the
+             * fields (e.g. ring weights) */
+            bool Stationary( ) const
+            { return ( dH == 0.0E+00 ) && ( dV == 0.0E+00 ) && \
+                     ( vH == 0.0E+00 ) && ( vV == 0.0E+00 ); };
+
+            /* Returns FFT_2Df, exits if it was not initialized */
+            FourierTransform_2D<float>* getFFT_2Df( ) const;
+
+            /* Subtracts the far-field value from V and returns it in
+             * backg. Returns 0 and leaves V untouched if the field is
+             * uniform. */
+            template <class Field>
+            bool Perturbation( Field &V, RealDouble &backg ) const;
+
+            /* Adds the far-field value back to V */
+            template <class Field>
+            void AddBackground( Field &V, const RealDouble backg ) const;
+
+            /* Diffusion and advection propagators are separable:
+             * DiffFactor[jNy][iNx] = DiffX[iNx] * DiffY[jNy]
+             * AdvFactor [jNy][iNx] = AdvX [iNx] * AdvY [jNy] */
+            Vector_1D  DiffX, DiffY;
+            Vector_1Dc AdvX, AdvY;
             Vector_2Dc ShearFactor;
 
+            /* Vertical advection propagators for each velocity */
+            std::map<RealDouble, Vector_1Dc> AdvYCache;
+
+            /* Propagators and the parameters they were computed for, for
+             * time steps other than the current one */
+            struct StepPropagators
+            {
+                RealDouble dH, dV;
+                RealDouble vH, vV;
+                RealDouble shear;
+                Vector_1D  DiffX, DiffY;
+                Vector_1Dc AdvX, AdvY;
+                Vector_2Dc ShearFactor;
+                std::map<RealDouble, Vector_1Dc> AdvYCache;
+            };
+
+            std::map<RealDouble, StepPropagators> StepCache;
+
+            /* Have the diffusion or advection factors changed since they
+             * were last passed to FFT_2D? */
+            bool factorsChanged;
+
+            /* Transform options, kept to rebuild the transforms */
+            bool multiThreadedFFT;
+            bool useWisdom;
+            std::string wisdomDir;
+
             /* Frequencies */
             Vector_1D kx, ky;
             Vector_1D kxx, kyy;
@@ -191,6 +322,12 @@ namespace SANDS
             FourierTransform_1D<RealDouble> *FFT_1D;
             FourierTransform_2D<RealDouble> *FFT_2D;
 
+            /* Single precision solver, only used for the fields that
+             * request it (NULL otherwise) */
+            FourierTransform_2D<float> *FFT_2Df;
+
+            /* Number of fields transported and skipped */
+            unsigned long nRun, nSkipped;
 
 
     };
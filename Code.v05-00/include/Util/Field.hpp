@@ -0,0 +1,224 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* Field Header File                                                */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : Field.hpp                                 */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef FIELD_H_INCLUDED
+#define FIELD_H_INCLUDED
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+#include "Util/ForwardDecl.hpp"
+
+/* Alignment of field storage in bytes. Covers AVX-512 and is a multiple
+ * of what FFTW expects for SIMD transforms */
+#define FIELD_ALIGN       64
+
+class FieldStack;
+
+/* Contiguous 2D field stored row-major, i.e. F[jNy][iNx] is located at
+ * data()[jNy * Nx() + iNx]. A Field2D either owns its storage or is a view
+ * into a FieldStack. */
+
+class Field2D
+{
+
+    public:
+
+        /**
+         * Constructors
+         *
+         * @param ny_ (UInt)     : number of rows (y-direction)
+         * @param nx_ (UInt)     : number of columns (x-direction)
+         * @param value (double) : initial value (default = 0.0)
+         */
+
+        Field2D( );
+        Field2D( const UInt ny_, const UInt nx_, \
+                 const RealDouble value = 0.0E+00 );
+        Field2D( const Vector_2D &V );
+
+        /* Copies are always deep and owning, even when copying a view */
+        Field2D( const Field2D &F );
+
+        ~Field2D( );
+
+        /* Assigning to a view requires matching shapes */
+        Field2D& operator=( const Field2D &F );
+        Field2D& operator=( const Vector_2D &V );
+
+        /**
+         * Reallocate field. Only valid for owning fields.
+         *
+         * @param ny_ (UInt)     : number of rows (y-direction)
+         * @param nx_ (UInt)     : number of columns (x-direction)
+         * @param value (double) : fill value (default = 0.0)
+         */
+
+        void Resize( const UInt ny_, const UInt nx_, \
+                     const RealDouble value = 0.0E+00 );
+
+        void SetToValue( const RealDouble value );
+
+        /**
+         * Grows the field, keeping the current values as the block starting
+         * at (j0, i0). Only valid for owning fields.
+         *
+         * @param ny_ (UInt)     : new number of rows
+         * @param nx_ (UInt)     : new number of columns
+         * @param j0 (UInt)      : row offset of the current values
+         * @param i0 (UInt)      : column offset of the current values
+         * @param fill (double)  : value of the new cells
+         */
+
+        void Embed( const UInt ny_, const UInt nx_, \
+                    const UInt j0, const UInt i0,   \
+                    const RealDouble fill );
+
+        /* Row access, so that F[jNy][iNx] works as with Vector_2D */
+        inline RealDouble* operator[]( const UInt j ) { return data_ + j * nx; }
+        inline const RealDouble* operator[]( const UInt j ) const { return data_ + j * nx; }
+
+        inline RealDouble* data( ) { return data_; }
+        inline const RealDouble* data( ) const { return data_; }
+
+        inline UInt Nx( ) const { return nx; }
+        inline UInt Ny( ) const { return ny; }
+
+        /* Number of rows, same meaning as Vector_2D::size() */
+        inline UInt size( ) const { return ny; }
+
+        /* Total number of elements */
+        inline UInt nElem( ) const { return nx * ny; }
+
+        bool isView( ) const { return !owner; }
+
+        Vector_2D toVector( ) const;
+
+    private:
+
+        friend class FieldStack;
+
+        /* Turns this field into a view of external storage */
+        void Attach( RealDouble* ptr, const UInt ny_, const UInt nx_ );
+        void Release( );
+
+        UInt ny, nx;
+        RealDouble* data_;
+        bool owner;
+
+};
+
+/* Stack of 2D fields sharing one contiguous, aligned allocation.
+ * Field k is S[k] and element (k, jNy, iNx) is S[k][jNy][iNx]. Fields
+ * may have different shapes (e.g. reduced 1x1 species when chemistry is
+ * turned off). Each field starts on a FIELD_ALIGN boundary. */
+
+class FieldStack
+{
+
+    public:
+
+        FieldStack( );
+        FieldStack( const UInt n, const UInt ny_, const UInt nx_, \
+                    const RealDouble value = 0.0E+00 );
+        FieldStack( const Vector_3D &V );
+        FieldStack( const FieldStack &S );
+
+        ~FieldStack( );
+
+        FieldStack& operator=( const FieldStack &S );
+        FieldStack& operator=( const Vector_3D &V );
+
+        /**
+         * Allocate n fields of identical shape
+         *
+         * @param n (UInt)       : number of fields
+         * @param ny_ (UInt)     : number of rows (y-direction)
+         * @param nx_ (UInt)     : number of columns (x-direction)
+         * @param value (double) : fill value (default = 0.0)
+         */
+
+        void Resize( const UInt n, const UInt ny_, const UInt nx_, \
+                     const RealDouble value = 0.0E+00 );
+
+        /**
+         * Allocate fields of different shapes
+         *
+         * @param nys (1D UInt) : number of rows of each field
+         * @param nxs (1D UInt) : number of columns of each field
+         */
+
+        void Resize( const Vector_1Dui &nys, const Vector_1Dui &nxs );
+
+        /**
+         * Grows all fields that have the largest shape in the stack (i.e.
+         * the full grid), see Field2D::Embed. Other fields (e.g. reduced
+         * 1x1 species) are left untouched.
+         *
+         * @param ny_ (UInt)     : new number of rows
+         * @param nx_ (UInt)     : new number of columns
+         * @param j0 (UInt)      : row offset of the current values
+         * @param i0 (UInt)      : column offset of the current values
+         * @param fill (1D)      : value of the new cells, for each field
+         */
+
+        void Embed( const UInt ny_, const UInt nx_, \
+                    const UInt j0, const UInt i0,   \
+                    const Vector_1D &fill );
+
+        inline Field2D& operator[]( const UInt k ) { return fields[k]; }
+        inline const Field2D& operator[]( const UInt k ) const { return fields[k]; }
+
+        /* Number of fields */
+        inline UInt size( ) const { return fields.size(); }
+
+        /* True if all fields share the same shape */
+        inline bool isUniform( ) const { return uniform; }
+
+        inline RealDouble* data( ) { return data_; }
+        inline const RealDouble* data( ) const { return data_; }
+
+        /**
+         * Copies the values of count consecutive fields, starting at first,
+         * for cell (jNy, iNx) into/from a species-innermost buffer. This is
+         * a gather/scatter, not a view: storage stays one plane per field,
+         * as transport requires, so each value comes from a different plane
+         * (count accesses, nElem apart, each touching its own cache line).
+         *
+         * @param j (UInt)         : row index
+         * @param i (UInt)         : column index
+         * @param buffer (double*) : cell values, at least count long
+         * @param first (UInt)     : first field
+         * @param count (UInt)     : number of fields
+         */
+
+        void getCell( const UInt j, const UInt i, RealDouble* buffer, \
+                      const UInt first, const UInt count ) const;
+        void setCell( const UInt j, const UInt i, const RealDouble* buffer, \
+                      const UInt first, const UInt count );
+
+        Vector_3D toVector( ) const;
+
+    private:
+
+        void Allocate( const Vector_1Dui &nys, const Vector_1Dui &nxs );
+        void Free( );
+
+        RealDouble* data_;
+        std::vector<Field2D> fields;
+        bool uniform;
+
+};
+
+#endif /* FIELD_H_INCLUDED */
@@ -80,6 +80,23 @@ namespace physConst
     static const RealDouble RHO_SOOT = 2.000E+03;
 
 
+    /* ICE GROWTH PARAMETERS */
+
+    /* Deposition coefficient of H2O molecules on ice, experimentally
+     * derived, Unit : [ - ] */
+    static const RealDouble ALPHA_H2O = 0.5;
+
+    /* Thermal accommodation coefficient, experimentally derived,
+     * Unit : [ - ] */
+    static const RealDouble ALPHA_T = 0.7;
+
+    /* Thermal conductivity of dry air, Unit : [ J / ( m s K ) ] */
+    static const RealDouble K_AIR = 2.50E-02;
+
+    /* Thermal jump length, Unit : [ m ] */
+    static const RealDouble L_T = 2.16E-07;
+
+
     /* EARTH'S PHYSICAL PARAMETERS */
 
     /* Acceleration due to gravity at the surface, Unit : [ m / s^2 ] */
@@ -12,6 +12,7 @@
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 #include "AIM/Aerosol.hpp"
+#include "AIM/GrowthRate.hpp"
 
 namespace AIM
 {
@@ -623,7 +624,8 @@ namespace AIM
         bin_Edges( 3 ),
         bin_VEdges( 3 ),
         bin_Sizes( 2 ),
-        nBin( 2 )
+        nBin( 2 ),
+        momentsValid( false )
     {
 
         /* Default constructor */
@@ -639,7 +641,7 @@ namespace AIM
             bin_Sizes[iBin] = bin_Edges[iBin+1] - bin_Edges[iBin];
         }
 
-        bin_VCenters.resize( nBin, Vector_2D( Ny, Vector_1D( Nx, 0.0 ) ) );
+        bin_VCenters.Resize( nBin, Ny, Nx, 0.0E+00 );
 
         RealDouble vol = 0.0E+00;
         for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
@@ -659,7 +661,7 @@ namespace AIM
         sigma = 0;
         alpha = 0;
 
-        pdf.resize( nBin, Vector_2D( Ny, Vector_1D( Nx, 0.0E+00 ) ) );
+        pdf.Resize( nBin, Ny, Nx, 0.0E+00 );
 
         for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
             for ( UInt jNy = 0; jNy < Ny; jNy++ ) {
@@ -677,7 +679,8 @@ namespace AIM
         Ny( Ny_ ),
         bin_VEdges( bin_Centers_.size() + 1 ),
         bin_Sizes( bin_Centers_.size() ),
-        type( distType )
+        type( distType ),
+        momentsValid( false )
     {
 
         /* Constructor */
@@ -709,7 +712,7 @@ namespace AIM
         bin_VEdges[nBin] = 4.0 / (RealDouble) 3.0 * physConst::PI * bin_Edges[nBin] * \
                            bin_Edges[nBin] * bin_Edges[nBin];
 
-        bin_VCenters.resize( nBin, Vector_2D( Ny, Vector_1D( Nx, 0.0E+00 ) ) );
+        bin_VCenters.Resize( nBin, Ny, Nx, 0.0E+00 );
 
         RealDouble vol = 0.0E+00;
         for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
@@ -720,7 +723,7 @@ namespace AIM
             }
         }
 
-        pdf.resize( nBin, Vector_2D( Ny, Vector_1D( Nx, 0.0E+00 ) ) );
+        pdf.Resize( nBin, Ny, Nx, 0.0E+00 );
 
         /* Allocate number of particles */
         nPart = nPart_;
@@ -836,6 +839,8 @@ namespace AIM
     Grid_Aerosol::Grid_Aerosol( const Grid_Aerosol &rhs )
     {
 
+        Nx = rhs.Nx;
+        Ny = rhs.Ny;
         bin_Centers = rhs.bin_Centers;
         bin_VCenters = rhs.bin_VCenters;
         bin_Edges = rhs.bin_Edges;
@@ -848,6 +853,7 @@ namespace AIM
         sigma = rhs.sigma;
         alpha = rhs.alpha;
         pdf = rhs.pdf;
+        momentsValid = false;
 
     } /* End of Grid_Aerosol::Grid_Aerosol */
 
@@ -878,6 +884,7 @@ namespace AIM
         sigma = rhs.sigma;
         alpha = rhs.alpha;
         pdf = rhs.pdf;
+        momentsValid = false;
         return *this;
 
     } /* End of Grid_Aerosol::operator= */
@@ -898,7 +905,7 @@ namespace AIM
             }
         }
 
-        Vector_3D pdf_rhs = rhs.getPDF();
+        const FieldStack pdf_rhs = rhs.getPDF();
         for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
             for ( UInt jNy = 0; jNy < Ny; jNy++ ) {
                 for ( UInt iNx = 0; iNx < Nx; iNx++ ) {
@@ -907,6 +914,8 @@ namespace AIM
             }
         }
 
+        momentsValid = false;
+
         return *this;
 
     } /* End of Grid_Aerosol::operator+= */
@@ -927,7 +936,7 @@ namespace AIM
             }
         }
 
-        Vector_3D pdf_rhs = rhs.getPDF();
+        const FieldStack pdf_rhs = rhs.getPDF();
         for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
             for ( UInt jNy = 0; jNy < Ny; jNy++ ) {
                 for ( UInt iNx = 0; iNx < Nx; iNx++ ) {
@@ -936,6 +945,8 @@ namespace AIM
             }
         }
 
+        momentsValid = false;
+
         return *this;
 
     } /* End of Grid_Aerosol::operator-= */
@@ -958,7 +969,7 @@ namespace AIM
             }
         }
 
-        Vector_3D pdf_rhs = rhs.getPDF();
+        const FieldStack pdf_rhs = rhs.getPDF();
         for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
             for ( UInt jNy = 0; jNy < Ny; jNy++ ) {
                 for ( UInt iNx = 0; iNx < Nx; iNx++ ) {
@@ -989,7 +1000,7 @@ namespace AIM
             }
         }
 
-        Vector_3D pdf_rhs = rhs.getPDF();
+        const FieldStack pdf_rhs = rhs.getPDF();
         for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
             for ( UInt jNy = 0; jNy < Ny; jNy++ ) {
                 for ( UInt iNx = 0; iNx < Nx; iNx++ ) {
@@ -1002,7 +1013,7 @@ namespace AIM
 
     } /* End of Grid_Aerosol::operator- */
 
-    void Grid_Aerosol::Coagulate( const RealDouble dt, Coagulation &kernel, const UInt N, const UInt SYM )
+    UInt Grid_Aerosol::Coagulate( const RealDouble dt, Coagulation &kernel, const UInt N, const UInt SYM )
     {
 
         /* DESCRIPTION:
@@ -1031,7 +1042,7 @@ namespace AIM
 
         if ( N == 0 ) {
             /* No coagulation is performed */
-            return;
+            return 0;
         } else if ( N == 1 ) {
             /* No emitted aerosols -> Aerosol is a uniform field */
             /* Perform coagulation only once */
@@ -1054,35 +1065,36 @@ namespace AIM
             } else {
                 std::cout << " In Grid_Aerosol::Coagulate: Wrong input for SYM\n";
                 std::cout << " SYM = " << SYM << "\n";
-                return;
+                return 0;
             }
         } else {
             std::cout << " In Grid_Aerosol::Coagulate: Wrong input for N\n";
             std::cout << " N = " << N << "\n";
-            return;
+            return 0;
         }
 
         /* Grid indices */
         UInt iNx  = 0;
         UInt jNy  = 0;
+        UInt iCell= 0;
 
         /* Bin indices */
         UInt iBin = 0;
         UInt jBin = 0;
-        UInt kBin = 0;
-        UInt kBin_= 0;
+        UInt e    = 0;
 
         /* Particle volume in each bin */
-        Vector_3D v = Volume( ); /* Expressed in [m^3/cm^3] */
+        FieldStack v = Volume( ); /* Expressed in [m^3/cm^3] */
         /* Copy v into v_new */
-        Vector_3D v_new = v;
+        FieldStack v_new = v;
 
-        /* Allocate variables */
-        RealDouble P[nBin];
-        RealDouble L[nBin];
+        /* Bin widths in log space */
+        Vector_1D dLog( nBin );
+        for ( iBin = 0; iBin < nBin; iBin++ )
+            dLog[iBin] = log( bin_Edges[iBin+1] / bin_Edges[iBin] );
 
-        /* Total volume and number per grid cell */
-        RealDouble totVol, nPart;
+        /* Number of cells without enough aerosol to coagulate */
+        UInt nSkipped = 0;
 
         /* Description of the algorithm:
          * \frac{dv}{dt}[iBin] = P - L * v[iBin] 
@@ -1095,90 +1107,162 @@ namespace AIM
          * Scheme 2:
          * v_new - v = ( P - L * v_new ) * dt
          * v_new = ( v + P * dt ) / ( 1.0 + L ) 
-         * The latter is mass-conserving */
+         * The latter is mass-conserving.
+         *
+         * Bins are solved in increasing order: the production of iBin
+         * uses the updated volumes and number of the smaller bins.
+         * Cells are independent and spread over the threads. */
+
+        /* Bin mapping of each cell. Cells whose bin volume centers are
+         * within COAG_MAP_TOL of the nominal ones use the nominal mapping
+         * of the kernel. Others are keyed by their drift, quantized in
+         * steps of COAG_MAP_TOL, and share the mapping cached for that
+         * key, built from the first cell that needed it. Once the cache
+         * is full, mappings are built by each thread in its own scratch.
+         * The lookup is serial, so that the cache is only modified here */
+        const UInt nCell = Nx_max * Ny_max;
+        const RealDouble logTol = log1p( COAG_MAP_TOL );
+        const bool hasNominal = ( kernel.vNominal.size() == nBin );
+
+        std::vector<bool> isActive( nCell, false );
+        std::vector<const CoagMap*> cellMap( nCell, NULL );
+        std::vector<std::pair<UInt, CoagMap*> > newMaps;
+        std::vector<long> key( nBin );
+        bool isNominal;
+
+        if ( kernel.mapCache.size() >= COAG_MAP_MAX )
+            kernel.ClearMaps();
+
+        for ( iCell = 0; iCell < nCell; iCell++ ) {
+
+            jNy = iCell / Nx_max;
+            iNx = iCell % Nx_max;
+
+            /* Total aerosol volume */
+            RealDouble totVol = 0.0E+00;
+
+            for ( iBin = 0; iBin < nBin; iBin++ )
+                totVol += v[iBin][jNy][iNx]; /* [m^3/cm^3] */
+
+            if ( totVol * 1E18 <= 0.1 ) {
+                /* Only run coagulation where aerosol volume is greater
+                 * than 0.1 um^3/cm^3 */
+                nSkipped++;
+                continue;
+            }
 
-        for ( jNy = 0; jNy < Ny_max; jNy++ ) {
+            isActive[iCell] = true;
 
-            for ( iNx = 0; iNx < Nx_max; iNx++ ) {
+            if ( !hasNominal )
+                continue;
 
-                /* Total aerosol volume */
-                totVol = 0.0E+00;
+            isNominal = true;
+            for ( iBin = 0; iBin < nBin; iBin++ ) {
+                key[iBin] = lround( log( bin_VCenters[iBin][jNy][iNx] / kernel.vNominal[iBin] ) / logTol );
+                isNominal = isNominal && ( key[iBin] == 0 );
+            }
 
-                for ( iBin = 0; iBin < nBin; iBin++ )
-                    totVol += v[iBin][jNy][iNx]; /* [m^3/cm^3] */
-
-                if ( totVol * 1E18 > 0.1 ) {
-                    /* Only run coagulation where aerosol volume is greater
-                     * than 0.1 um^3/cm^3 */
-
-#pragma omp master
-                    {
-                    /* Update kernel (updates kernel.f and kernel.indices).
-                     * This needs to be performed in serial as the class
-                     * kernel is specific to the grid cell (jNy, iNx) */
-                    kernel.buildF( bin_VCenters, jNy, iNx );
-                    }
+            if ( isNominal ) {
+                cellMap[iCell] = &kernel.nominalMap;
+                kernel.nMapNominal++;
+                continue;
+            }
 
-#pragma omp barrier
+            std::map<std::vector<long>, CoagMap>::iterator it = kernel.mapCache.find( key );
+            if ( it != kernel.mapCache.end() ) {
+                cellMap[iCell] = &( it->second );
+                kernel.nMapHit++;
+            } else {
+                kernel.nMapMiss++;
+                if ( kernel.mapCache.size() < COAG_MAP_MAX ) {
+                    CoagMap *map = &kernel.mapCache[key];
+                    cellMap[iCell] = map;
+                    newMaps.push_back( std::make_pair( iCell, map ) );
+                }
+            }
+        }
 
-#pragma omp parallel for                                                      \
-                    default ( shared                                        ) \
-                    private ( iBin, jBin, kBin, kBin_, nPart                ) \
-                    schedule( dynamic, 1                                    ) \
-                    if      ( !PARALLEL_CASES                               )
-                    for ( iBin = 0; iBin < nBin; iBin++ ) {
+#pragma omp parallel                                                          \
+        default ( shared                                                    ) \
+        private ( iNx, jNy, iCell, iBin, jBin, e                            ) \
+        if      ( !PARALLEL_CASES                                           )
+        {
 
-                        /* Reset P and L values */
-                        P[iBin] = 0.0E+00;
-                        L[iBin] = 0.0E+00;
-
-                        /* Build production and loss terms */
-                        for ( jBin = 0; jBin < nBin; jBin++ ) {
-
-                            nPart = pdf[jBin][jNy][iNx] * log( bin_Edges[jBin+1] / bin_Edges[jBin] );
-
-                            if ( jBin <= iBin ) {
-                                for ( kBin_ = 0; kBin_ < kernel.indices[jBin][iBin].size(); kBin_++ ) {
-                                    kBin = kernel.indices[jBin][iBin][kBin_];
-                                    /* k coagulating with j to form i */
-                                    if ( kBin < iBin ) {
-                                        P[iBin] += kernel.f[kBin][jBin][iBin] * kernel.beta[kBin][jBin] * v_new[kBin][jNy][iNx] * nPart;
-                                        /* [cm^3/#/s] * [m^3/cm^3] * [#/cm^3] = [m^3/cm^3/s] */
-                                    }
-                                }
-
-                                /* The following lines perform slightly slower than the for loop above */
-                                //for ( kBin = 0; kBin < iBin ; kBin++ ) {
-                                //    /* k coagulating with j to form i */
-                                //    if ( kernel.f[kBin][jBin][iBin] != 0.0 ) { /* f is a somewhat sparse 3D tensor */
-                                //        P[iBin] += kernel.f[kBin][jBin][iBin] * kernel.beta[kBin][jBin] * v_new[kBin][jNy][iNx] * nPart;
-                                //        /* [cm^3/#/s] * [m^3/cm^3] * [#/cm^3] = [m^3/cm^3/s] */
-                                //    }
-                                //}
-                            }
-
-                            /* i coagulating with j to deplete i */
-                            if ( kernel.f[iBin][jBin][iBin] != 1.0 )
-                                L[iBin] += ( 1.0 - kernel.f[iBin][jBin][iBin] ) * kernel.beta[iBin][jBin] * nPart;
+        CoagMap localMap;
+        Vector_1D vCenters( nBin ), vCell( nBin ), vNew( nBin ), nPart( nBin );
+        RealDouble P, L;
+        UInt iMap;
 
-                        }
+        /* Build the mappings added to the cache */
+#pragma omp for schedule( dynamic, 1 )
+        for ( iMap = 0; iMap < newMaps.size(); iMap++ ) {
 
-                        /* Non-mass conserving scheme: */
-                        //  v_new[iBin][jNy][iNx] = v[iBin][jNy][iNx] + ( P[iBin] - L[iBin] * v[iBin][jNy][iNx] ) * dt;
+            jNy = newMaps[iMap].first / Nx_max;
+            iNx = newMaps[iMap].first % Nx_max;
 
-                        /* Mass conserving scheme: */
-                        v_new[iBin][jNy][iNx] = ( v[iBin][jNy][iNx] + dt * P[iBin] ) / ( 1.0 + dt * L[iBin] );
+            for ( iBin = 0; iBin < nBin; iBin++ )
+                vCenters[iBin] = bin_VCenters[iBin][jNy][iNx];
 
-                        if ( v[iBin][jNy][iNx] > 0.0E+00 )
-                            pdf[iBin][jNy][iNx] *= v_new[iBin][jNy][iNx] / v[iBin][jNy][iNx];
+            kernel.buildMap( vCenters, *newMaps[iMap].second );
+        }
 
+#pragma omp for schedule( dynamic, 1 )
+        for ( iCell = 0; iCell < nCell; iCell++ ) {
 
-                    }
+            if ( !isActive[iCell] )
+                continue;
+
+            jNy = iCell / Nx_max;
+            iNx = iCell % Nx_max;
+
+            for ( iBin = 0; iBin < nBin; iBin++ ) {
+                vCell[iBin] = v[iBin][jNy][iNx];
+                nPart[iBin] = pdf[iBin][jNy][iNx] * dLog[iBin];
+            }
+
+            const CoagMap *map = cellMap[iCell];
+            if ( map == NULL ) {
+                for ( iBin = 0; iBin < nBin; iBin++ )
+                    vCenters[iBin] = bin_VCenters[iBin][jNy][iNx];
+                kernel.buildMap( vCenters, localMap );
+                map = &localMap;
+            }
+
+            const UInt * const mapK = map->k.data();
+            const UInt * const mapJ = map->j.data();
+            const RealDouble * const coef = map->coef.data();
+
+            for ( iBin = 0; iBin < nBin; iBin++ ) {
+
+                /* k coagulating with j to form i */
+                P = 0.0E+00;
+                for ( e = map->ptr[iBin]; e < map->ptr[iBin+1]; e++ )
+                    P += coef[e] * vNew[mapK[e]] * nPart[mapJ[e]];
+                /* [cm^3/#/s] * [m^3/cm^3] * [#/cm^3] = [m^3/cm^3/s] */
+
+                /* i coagulating with j to deplete i */
+                const RealDouble * const loss = &map->loss[iBin*nBin];
+                L = 0.0E+00;
+#pragma omp simd reduction( +:L )
+                for ( jBin = 0; jBin < nBin; jBin++ )
+                    L += loss[jBin] * nPart[jBin];
+
+                /* Mass conserving scheme: */
+                vNew[iBin] = ( vCell[iBin] + dt * P ) / ( 1.0 + dt * L );
+
+                if ( vCell[iBin] > 0.0E+00 ) {
+                    pdf[iBin][jNy][iNx] *= vNew[iBin] / vCell[iBin];
+                    nPart[iBin] = pdf[iBin][jNy][iNx] * dLog[iBin];
                 }
+
+                v_new[iBin][jNy][iNx] = vNew[iBin];
+
             }
         }
 
-        /* Update bin centers */
+        } /* End of parallel region */
+
+        /* Update bin centers. Also invalidates the moment cache */
         UpdateCenters( v_new, pdf );
 
         if ( checkMass )
@@ -1273,9 +1357,11 @@ namespace AIM
         }
 
 
+        return nSkipped;
+
     } /* End of Grid_Aerosol::Coagulate */
 
-    void Grid_Aerosol::Grow( const RealDouble dt, Vector_2D &H2O, const Vector_2D &T, const Vector_1D &P, const UInt N, const UInt SYM )
+    UInt Grid_Aerosol::Grow( const RealDouble dt, Field2D &H2O, const Vector_2D &T, const Vector_1D &P, const UInt N, const UInt SYM )
     {
 
         /* DESCRIPTION:
@@ -1302,7 +1388,7 @@ namespace AIM
 
         if ( N == 0 ) {
             /* No growth is performed */
-            return;
+            return 0;
         } else if ( N == 1 ) {
             /* No emitted aerosols -> Aerosol is a uniform field */
             /* Perform growth only once */
@@ -1325,12 +1411,12 @@ namespace AIM
             } else {
                 std::cout << " In Grid_Aerosol::Grow: Wrong input for SYM\n";
                 std::cout << " SYM = " << SYM << "\n";
-                return;
+                return 0;
             }
         } else {
             std::cout << " In Grid_Aerosol::Grow: Wrong input for N\n";
             std::cout << " N = " << N << "\n";
-            return;
+            return 0;
         }
 
         UInt iNx  = 0;
@@ -1348,70 +1434,52 @@ namespace AIM
         /* Scaled Boltzmann constant */
         const RealDouble kB_ = physConst::kB * 1.00E+06;
 
-        /* Declare and initialize particle totals and water vapor array */
-        Vector_3D icePart = Number( );
-        Vector_3D iceVol  = Volume( );
-        Vector_2D totH2O  = H2O;
+        /* Bin widths in log space */
+        Vector_1D dLog( nBin );
+        for ( iBin = 0; iBin < nBin; iBin++ )
+            dLog[iBin] = log( bin_Edges[iBin+1] / bin_Edges[iBin] );
 
-        /* Vector containing Kelvin factors evaluated at each bin center */
-        Vector_1D kFactor( nBin, 0.0E+00 );
+        /* Number of ice-free cells */
+        UInt nSkipped = 0;
 
 #pragma omp parallel if( !PARALLEL_CASES ) default( shared )
         {
 
         /* All declarations here are enforced as thread private */
 
-        RealDouble partVol  = 0.0E+00;
-        RealDouble icePart_ = 0.0E+00;
-        RealDouble iceVol_  = 0.0E+00;
+        /* Growth rates per bin, recomputed when ( T, P ) changes */
+        GrowthRate growth( bin_Centers );
 
-        /* Declare and initialize growth rates per bin. */
-        RealDouble kGrowth[nBin];
+        /* Particle number [#/cm^3] and volume [m^3/cm^3] of each bin of
+         * the current cell, contiguous, before and after redistribution */
+        Vector_1D icePart( nBin ), iceVol( nBin ), newPart( nBin ), newVol( nBin );
+        RealDouble * const icePart_ = icePart.data();
+        RealDouble * const iceVol_  = iceVol.data();
+
+        RealDouble partVol = 0.0E+00;
+        int toBin = -1;
 
         /* Declare and initialize aggregated growth rates */
         RealDouble totkGrowth_1 = 0.0E+00;
         RealDouble totkGrowth_2 = 0.0E+00;
 
-        int jBin = -1;
-        std::vector<int> toBin( nBin, 0 );
-        std::vector<int>::iterator iterBegin, iterCurr, iterEnd;
-
         /* Declare and initialize variable to store saturation quantities,
          * pressure and temperature */
         RealDouble pSat = 0.0E+00;
         RealDouble nSat = 0.0E+00;
         RealDouble locT = 0.0E+00;
         RealDouble locP = 0.0E+00;
-        /* Declare and initialize total ice concentration */
+        /* Declare and initialize total and gaseous + solid water
+         * concentrations */
         RealDouble totH2Oi = 0.0E+00;
+        RealDouble totH2O  = 0.0E+00;
 
-	/* Declare and initialize total particles per cell */
-	RealDouble totPart = 0.0E+00;
-
-        /* Compute Kelvin factor */
-#pragma omp for                                                               \
-        private ( iBin                                                      ) \
-        schedule( dynamic, 1                                                )
-        for ( iBin = 0; iBin < nBin; iBin++ )
-            kFactor[iBin] = physFunc::Kelvin( bin_Centers[iBin] );
+        /* Declare and initialize total particles per cell */
+        RealDouble totPart = 0.0E+00;
 
 #pragma omp for                                                               \
         private ( iNx, jNy, iBin                                            ) \
-        schedule( dynamic, 1                                                )
-        for ( jNy = 0; jNy < Ny_max; jNy++ ) {
-            for ( iNx = 0; iNx < Nx_max; iNx++ ) {
-                for ( iBin = 0; iBin < nBin; iBin++ ) {
-                    totH2O[jNy][iNx] += iceVol[iBin][jNy][iNx] * UNITCONVERSION;
-                    /* Unit check:
-                     * [ molec/cm^3 ] = [ m^3 ice/cm^3 air ]   * [ molec/m^3 ice ] */
-                }
-            }
-        }
-
-#pragma omp for                                                               \
-        private ( iNx, jNy, iBin, jBin, locP, locT, pSat, nSat              ) \
-        private ( kGrowth, totkGrowth_1, totkGrowth_2, totH2Oi, totPart     ) \
-        private ( partVol, icePart_, iceVol_                                ) \
+        reduction( +:nSkipped                                               ) \
         schedule( dynamic, 1                                                )
         for ( jNy = 0; jNy < Ny_max; jNy++ ) {
 
@@ -1421,18 +1489,41 @@ namespace AIM
              * account for 2D pressure met-fields?? */
             locP = P[jNy];
 
-            for ( iNx = 0; iNx < Nx; iNx++ ) {
+            for ( iNx = 0; iNx < Nx_max; iNx++ ) {
 
                 /* Reinitialize total rate and concentrations */
                 totkGrowth_1 = 0.0E+00;
                 totkGrowth_2 = 0.0E+00;
                 totH2Oi      = 0.0E+00;
 
+                totPart = 0.0E+00;
+                for ( iBin = 0; iBin < nBin; iBin++ ) {
+                    icePart_[iBin] = dLog[iBin] * pdf[iBin][jNy][iNx];
+                    totPart += icePart_[iBin];
+                }
+
+                /* Cells without ice crystals neither grow nor take up
+                 * water: leave them untouched */
+                if ( totPart <= ACTIVE_ICE_NUM ) {
+                    nSkipped++;
+                    continue;
+                }
+
+                /* Total water, gaseous and solid */
+                totH2O = H2O[jNy][iNx];
+                for ( iBin = 0; iBin < nBin; iBin++ ) {
+                    iceVol_[iBin] = dLog[iBin] * bin_VCenters[iBin][jNy][iNx] * pdf[iBin][jNy][iNx];
+                    totH2O += iceVol_[iBin] * UNITCONVERSION;
+                    /* Unit check:
+                     * [ molec/cm^3 ] = [ m^3 ice/cm^3 air ]   * [ molec/m^3 ice ] */
+                }
+
                 /* Store local temperature */
                 locT = T[jNy][iNx];
 
-                /* Store local saturation pressure w.r.t ice */
-                pSat = physFunc::pSat_H2Os( locT );
+                /* Growth rates and saturation pressure w.r.t ice */
+                growth.SetState( locT, locP );
+                pSat = growth.pSat();
 
                 if ( H2O[jNy][iNx] * kB_ * locT / pSat > 0.0 ) {
 
@@ -1488,63 +1579,54 @@ namespace AIM
                      * final concentrations are bounded between 0 and 
                      * C_{tot}, independently of the time step */
 
-		    /* Check if partNum greater than a limit */
-		    totPart = 0.0E-00;
-		    for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
-
-			totPart += icePart[iBin][jNy][iNx];
-
-		    }
-
                     /* Compute particle growth rates through ice deposition
                      * We here assume that C_{s,i} is independent of the
                      * bin and thus the particle size and only depends
-                     * on meteorological parameters. */
-		    if ( totPart > 0.00 ) {
-			for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
-			
-			    /* kGrowth is expressed in [cm^3 ice/s/part] */
-			    kGrowth[iBin] = physFunc::growthRate( bin_Centers[iBin], locT, locP, H2O[jNy][iNx] );
-			
-			    /* kGrowth_* are thus in 
-			    * [(cm^3 ice/s)/cm^3 air] = [1/s] */
-			    totkGrowth_1 += kGrowth[iBin] * icePart[iBin][jNy][iNx] \
-			                    * kFactor[iBin];
-			    totkGrowth_2 += kGrowth[iBin] * icePart[iBin][jNy][iNx];
-			}
-			
-			/* Compute the molecular saturation concentration 
-			* C_{s,i} in [molec/cm^3] */
-			nSat = pSat / ( kB_ * locT );
-			
-			/* Update gaseous molecular concentration */
-			H2O[jNy][iNx] = ( H2O[jNy][iNx] + dt * totkGrowth_1 * nSat ) \
-			              / (   1.00E+00    + dt * totkGrowth_2        );
-			
-			/* Make sure that molecular water does not go over 
-			* total water (gaseous + solid) concentrations */
-			H2O[jNy][iNx] = std::min( H2O[jNy][iNx], totH2O[jNy][iNx] );
-			
-			for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
-			    iceVol[iBin][jNy][iNx] += dt * kGrowth[iBin] * icePart[iBin][jNy][iNx] \
-			                            * ( H2O[jNy][iNx] -  kFactor[iBin] * nSat ) / UNITCONVERSION;
-			    /* Unit check:
-			     * [m^3 ice/cm^3 air]   = [s] * [cm^3 ice/s/part] * [part/cm^3 air] \
-			     *                      * [molec/cm^3 air] * [m^3 ice/molec] 
-			     *                      = [cm^3 ice/cm^3 air] * [m^3 ice/cm^3 air] 
-			     *                      = [m^3 ice/cm^3 air] */
-			
-			    iceVol[iBin][jNy][iNx] = \
-			            std::min( std::max( iceVol[iBin][jNy][iNx], 0.0E+00 ), icePart[iBin][jNy][iNx] * MAXVOL );
-			
-			    /* Compute total water taken up on particles */
-			    totH2Oi += iceVol[iBin][jNy][iNx] * UNITCONVERSION;
-			    /* Unit check:
-			     * [molec/cm^3 air] = [m^3 ice/cm^3 air] * [molec/m^3 ice] */
-			}
-			
-			H2O[jNy][iNx] = totH2O[jNy][iNx] - totH2Oi; 
-		    }
+                     * on meteorological parameters.
+                     * kGrowth is expressed in [cm^3 ice/s/part], kGrowth_*
+                     * are thus in [(cm^3 ice/s)/cm^3 air] = [1/s] */
+                    const RealDouble * const kGrowth = growth.Rates();
+                    const RealDouble * const kFactor = growth.Kelvin();
+
+#pragma omp simd reduction( +:totkGrowth_1, totkGrowth_2 )
+                    for ( iBin = 0; iBin < nBin; iBin++ ) {
+                        totkGrowth_1 += kGrowth[iBin] * icePart_[iBin] * kFactor[iBin];
+                        totkGrowth_2 += kGrowth[iBin] * icePart_[iBin];
+                    }
+
+                    /* Compute the molecular saturation concentration 
+                     * C_{s,i} in [molec/cm^3] */
+                    nSat = pSat / ( kB_ * locT );
+
+                    /* Update gaseous molecular concentration */
+                    H2O[jNy][iNx] = ( H2O[jNy][iNx] + dt * totkGrowth_1 * nSat ) \
+                                  / (   1.00E+00    + dt * totkGrowth_2        );
+
+                    /* Make sure that molecular water does not go over 
+                     * total water (gaseous + solid) concentrations */
+                    H2O[jNy][iNx] = std::min( H2O[jNy][iNx], totH2O );
+
+                    const RealDouble locH2O = H2O[jNy][iNx];
+
+#pragma omp simd reduction( +:totH2Oi )
+                    for ( iBin = 0; iBin < nBin; iBin++ ) {
+                        iceVol_[iBin] += dt * kGrowth[iBin] * icePart_[iBin] \
+                                       * ( locH2O - kFactor[iBin] * nSat ) / UNITCONVERSION;
+                        /* Unit check: 
+                         * [m^3 ice/cm^3 air]   = [s] * [cm^3 ice/s/part] * [part/cm^3 air] \
+                         *                      * [molec/cm^3 air] * [m^3 ice/molec] 
+                         *                      = [cm^3 ice/cm^3 air] * [m^3 ice/cm^3 air] 
+                         *                      = [m^3 ice/cm^3 air] */
+
+                        iceVol_[iBin] = std::min( std::max( iceVol_[iBin], 0.0E+00 ), icePart_[iBin] * MAXVOL );
+
+                        /* Compute total water taken up on particles */
+                        totH2Oi += iceVol_[iBin] * UNITCONVERSION;
+                        /* Unit check:
+                         * [molec/cm^3 air] = [m^3 ice/cm^3 air] * [molec/m^3 ice] */
+                    }
+
+                    H2O[jNy][iNx] = totH2O - totH2Oi; 
                 }
 
                 /* ======================================================= */
@@ -1555,76 +1637,48 @@ namespace AIM
                 /* ======================================================= */
                 /* ======================================================= */
 
-                /* 1. Compute bin particle flux */
-
                 for ( iBin = 0; iBin < nBin; iBin++ ) {
+                    newPart[iBin] = 0.0E+00;
+                    newVol[iBin]  = 0.0E+00;
+                }
 
-                    /* What does bin iBin grow into? */
-                    toBin[iBin] = -1;
-
-                    /* Only perform computation if number of particle is
-                     * greater than some small number to avoid division
-                     * by ridiculously small numbers */
+                /* Move the particles of each bin, in increasing order, to
+                 * the bin that contains their new volume */
+                for ( iBin = 0; iBin < nBin; iBin++ ) {
 
                     /* Compute particle volume */
-                    partVol = iceVol[iBin][jNy][iNx] / icePart[iBin][jNy][iNx];
+                    partVol = iceVol_[iBin] / icePart_[iBin];
 
                     /* Find which bin corresponds to this particle 
                      * volume */
-                    toBin[iBin] = std::lower_bound( bin_VEdges.begin(), bin_VEdges.end(), partVol ) \
-                                  - bin_VEdges.begin() - 1;
-
-                    if ( toBin[iBin] == 0 ) {
-                        if ( partVol < bin_VEdges[0] )
-                            /* Particles are reduced to their core
-                             * and thus considered lost */
-                            toBin[iBin] = -1;
+                    toBin = std::lower_bound( bin_VEdges.begin(), bin_VEdges.end(), partVol ) \
+                            - bin_VEdges.begin() - 1;
+
+                    /* Particles below the smallest edge are reduced to
+                     * their core and thus considered lost, as are empty
+                     * bins and particles beyond the largest edge */
+                    if ( ( toBin == 0 ) && ( partVol < bin_VEdges[0] ) )
+                        continue;
+
+                    if ( ( toBin >= 0 ) && ( toBin < (int) nBin ) ) {
+                        newPart[toBin] += icePart_[iBin];
+                        newVol[toBin]  += iceVol_[iBin];
                     }
 
                 }
 
-                /* 2. Attribute new particles according to fluxes */
-
                 for ( iBin = 0; iBin < nBin; iBin++ ) {
 
-                    /* Find all bins that end up in bin iBin after growth */
-
-                    /* Initialize total new number of particles and volume 
-                     * to 0 */
-                    icePart_ = 0.0E+00;
-                    iceVol_  = 0.0E+00;
-
-                    /* Bin jBin -> Bin iBin */
-                    jBin = -1;
-
-                    /* Initialize iterators */
-                    iterBegin = toBin.begin();
-                    iterEnd   = toBin.end();
-                    iterCurr  = iterBegin;
-
-                    while ((iterCurr = std::find(iterCurr, iterEnd, iBin)) != iterEnd) {
-                        jBin = iterCurr - iterBegin; //std::distance(iterBegin, iterCurr);
-
-                        /* If jBin -> iBin, then add particle number and 
-                         * volume to sum */
-
-                        icePart_ += icePart[jBin][jNy][iNx];
-                        iceVol_  += iceVol[jBin][jNy][iNx];
-
-                        /* Iterate */
-                        iterCurr++;
-                    }
-
-                    if ( icePart_ > 0.0E+00 ) {
+                    if ( newPart[iBin] > 0.0E+00 ) {
                         /* Bin is not empty */
 
                         /* Compute particle volume:
                          * [m^3] = [m^3/cm^3 air] / [#/cm^3 air] 
                          * and clip it between min and max volume allowed. */
 
-                        bin_VCenters[iBin][jNy][iNx] = std::max( std::min( iceVol_ / icePart_, bin_VEdges[iBin+1] ), bin_VEdges[iBin] );
+                        bin_VCenters[iBin][jNy][iNx] = std::max( std::min( newVol[iBin] / newPart[iBin], bin_VEdges[iBin+1] ), bin_VEdges[iBin] );
 
-                        pdf[iBin][jNy][iNx] = icePart_ / ( log( bin_Edges[iBin+1] / bin_Edges[iBin] ) );
+                        pdf[iBin][jNy][iNx] = newPart[iBin] / dLog[iBin];
 
                     } else {
                         /* Bin is empty */
@@ -1643,6 +1697,8 @@ namespace AIM
 
         } /* pragma omp parallel */
 
+        momentsValid = false;
+
         if ( N == 1 ) {
 
             /* Allocate uniform results to the grid */
@@ -1736,9 +1792,13 @@ namespace AIM
             }
         }
 
+        return nSkipped;
+
     } /* End of Grid::Aerosol::Grow */
 
-    void Grid_Aerosol::UpdateCenters( const Vector_3D &iceV, const Vector_3D &PDF ) {
+    void Grid_Aerosol::UpdateCenters( const FieldStack &iceV, const FieldStack &PDF ) {
+
+        momentsValid = false;
 
         UInt iNx  = 0;
         UInt jNy  = 0;
@@ -1772,9 +1832,190 @@ namespace AIM
 
     } /* End of Grid_Aerosol::UpdateCenters */
 
+    void Grid_Aerosol::CentersToVolume( const UInt iBin )
+    {
+
+        momentsValid = false;
+
+        UInt jNy = 0;
+
+        const RealDouble ratio = log( bin_Edges[iBin+1] / bin_Edges[iBin] );
+
+#pragma omp parallel for                                                      \
+        default ( shared                                                    ) \
+        private ( jNy                                                       ) \
+        schedule( static                                                    ) \
+        if      ( !PARALLEL_CASES                                           )
+        for ( jNy = 0; jNy < Ny; jNy++ ) {
+            RealDouble *vc        = bin_VCenters[iBin][jNy];
+            const RealDouble *PDF = pdf[iBin][jNy];
+#pragma omp simd
+            for ( UInt iNx = 0; iNx < Nx; iNx++ )
+                vc[iNx] = ratio * vc[iNx] * PDF[iNx];
+        }
+
+    } /* End of Grid_Aerosol::CentersToVolume */
+
+    void Grid_Aerosol::VolumeToCenters( const UInt iBin )
+    {
+
+        momentsValid = false;
+
+        UInt jNy = 0;
+
+        const RealDouble TINY  = 1.00E-50;
+        const RealDouble ratio = log( bin_Edges[iBin+1] / bin_Edges[iBin] );
+        const RealDouble vLow  = 1.0001 * bin_VEdges[iBin];
+        const RealDouble vHigh = 0.9999 * bin_VEdges[iBin+1];
+        const RealDouble vMid  = 0.5 * ( bin_VEdges[iBin] + bin_VEdges[iBin+1] );
+
+#pragma omp parallel for                                                      \
+        default ( shared                                                    ) \
+        private ( jNy                                                       ) \
+        schedule( static                                                    ) \
+        if      ( !PARALLEL_CASES                                           )
+        for ( jNy = 0; jNy < Ny; jNy++ ) {
+            RealDouble *vc        = bin_VCenters[iBin][jNy];
+            const RealDouble *PDF = pdf[iBin][jNy];
+            for ( UInt iNx = 0; iNx < Nx; iNx++ ) {
+                if ( PDF[iNx] > TINY )
+                    vc[iNx] = std::max( std::min( vc[iNx] / PDF[iNx] / ratio, \
+                                                  vHigh ), vLow );
+                else
+                    vc[iNx] = vMid;
+            }
+        }
+
+    } /* End of Grid_Aerosol::VolumeToCenters */
+
+    void Grid_Aerosol::ClearCell( const UInt iNx, const UInt jNy )
+    {
+
+        for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
+            pdf[iBin][jNy][iNx]          = 0.0E+00;
+            bin_VCenters[iBin][jNy][iNx] = \
+                0.5 * ( bin_VEdges[iBin] + bin_VEdges[iBin+1] );
+        }
+
+    } /* End of Grid_Aerosol::ClearCell */
+
+    void Grid_Aerosol::Regrid( const UInt Nx_, const UInt Ny_, const UInt i0, const UInt j0, \
+                               const Vector_1D &pdfFill )
+    {
+
+        Vector_1D volFill( nBin, 0.0E+00 );
+        for ( UInt iBin = 0; iBin < nBin; iBin++ )
+            volFill[iBin] = 0.5 * ( bin_VEdges[iBin] + bin_VEdges[iBin+1] );
+
+        pdf.Embed( Ny_, Nx_, j0, i0, pdfFill );
+        if ( bin_VCenters.size() > 0 )
+            bin_VCenters.Embed( Ny_, Nx_, j0, i0, volFill );
+
+        Nx = Nx_;
+        Ny = Ny_;
+
+        momentsValid = false;
+
+    } /* End of Grid_Aerosol::Regrid */
+
+    void Grid_Aerosol::ComputeMoments( ) const
+    {
+
+        if ( momentsValid )
+            return;
+
+        UInt jNy  = 0;
+        UInt iNx  = 0;
+        UInt iBin = 0;
+
+        if ( ( moments.size() != MOM_N ) || ( moments[0].Ny() != Ny ) \
+                                         || ( moments[0].Nx() != Nx ) )
+            moments.Resize( MOM_N, Ny, Nx, 0.0E+00 );
+
+        const RealDouble FACTOR  = 3.0 / RealDouble( 4.0 * physConst::PI );
+        const RealDouble SURFACE = 4.0 * physConst::PI;
+        const RealDouble VOLUME  = 4.0 / RealDouble(3.0) * physConst::PI;
+        const RealDouble TO_IWC  = physConst::RHO_ICE * 1.0E+06;
+
+        /* Extinction coefficients, see Extinction */
+        const RealDouble a = 3.448E+00; /* [m^2/kg] */
+        const RealDouble b = 2.431E-03; /* [m^3/kg] */
+
+        Vector_1D dLog( nBin );
+        for ( iBin = 0; iBin < nBin; iBin++ )
+            dLog[iBin] = log( bin_Edges[iBin+1] / bin_Edges[iBin] );
+
+        /* Rows are independent. Within a row, bins are accumulated in
+         * increasing order, as in Moment, over contiguous cells */
+#pragma omp parallel for                                                      \
+        default ( shared                                                    ) \
+        private ( iNx, jNy, iBin                                            ) \
+        schedule( dynamic, 1                                                ) \
+        if      ( !PARALLEL_CASES                                           )
+        for ( jNy = 0; jNy < Ny; jNy++ ) {
+
+            RealDouble * const m0 = moments[MOM_M0][jNy];
+            RealDouble * const m1 = moments[MOM_M1][jNy];
+            RealDouble * const m2 = moments[MOM_M2][jNy];
+            RealDouble * const m3 = moments[MOM_M3][jNy];
+
+            for ( iNx = 0; iNx < Nx; iNx++ ) {
+                m0[iNx] = 0.0E+00;
+                m1[iNx] = 0.0E+00;
+                m2[iNx] = 0.0E+00;
+                m3[iNx] = 0.0E+00;
+            }
+
+            for ( iBin = 0; iBin < nBin; iBin++ ) {
+                const RealDouble * const p  = pdf[iBin][jNy];
+                const RealDouble * const vc = bin_VCenters[iBin][jNy];
+                const RealDouble w = dLog[iBin];
+#pragma omp simd
+                for ( iNx = 0; iNx < Nx; iNx++ ) {
+                    /* r^3 and r, in [m^3] and [m] */
+                    const RealDouble r3 = FACTOR * vc[iNx];
+                    const RealDouble r  = pow( r3, 1.0 / RealDouble( 3.0 ) );
+                    m0[iNx] += w * p[iNx];
+                    m1[iNx] += w * r * p[iNx];
+                    m2[iNx] += w * ( r * r ) * p[iNx];
+                    m3[iNx] += w * r3 * p[iNx];
+                }
+            }
+
+            RealDouble * const rMean = moments[MOM_RMEAN][jNy];
+            RealDouble * const rEff  = moments[MOM_REFF][jNy];
+            RealDouble * const sad   = moments[MOM_SAD][jNy];
+            RealDouble * const iwc   = moments[MOM_IWC][jNy];
+            RealDouble * const ext   = moments[MOM_EXT][jNy];
+
+            for ( iNx = 0; iNx < Nx; iNx++ ) {
+                rMean[iNx] = ( m0[iNx] > 0.0E+00 ) ? m1[iNx] / m0[iNx] : 0.0E+00;
+                rEff[iNx]  = ( m2[iNx] > 1.00E-50 ) ? m3[iNx] / m2[iNx] : 0.0E+00;
+                sad[iNx]   = SURFACE * m2[iNx];         /* [m^2/cm^3] */
+                iwc[iNx]   = m3[iNx] * VOLUME * TO_IWC; /* [kg/m^3]   */
+                ext[iNx]   = ( rEff[iNx] > 1.00E-15 ) ? iwc[iNx] * ( a + b / rEff[iNx] ) : 0.0E+00; /* [1/m] */
+            }
+        }
+
+        momentsValid = true;
+
+    } /* End of Grid_Aerosol::ComputeMoments */
+
+    const Field2D& Grid_Aerosol::CachedMoment( const MomentField field ) const
+    {
+
+        ComputeMoments( );
+
+        return moments[field];
+
+    } /* End of Grid_Aerosol::CachedMoment */
+
     Vector_2D Grid_Aerosol::Moment( UInt n ) const
     {
 
+        if ( n <= 3 )
+            return CachedMoment( MomentField( MOM_M0 + n ) ).toVector();
+
         UInt jNy  = 0;
         UInt iNx  = 0;
         UInt iBin = 0;
@@ -1799,14 +2040,14 @@ namespace AIM
 
     } /* End of Grid_Aerosol::Moment */
 
-    Vector_3D Grid_Aerosol::Number( ) const
+    FieldStack Grid_Aerosol::Number( ) const
     {
 
         UInt jNy  = 0;
         UInt iNx  = 0;
         UInt iBin = 0;
 
-        Vector_3D number( nBin, Vector_2D( Ny, Vector_1D( Nx, 0.0E+00 ) ) );
+        FieldStack number( nBin, Ny, Nx, 0.0E+00 );
         RealDouble ratio = 0.0E+00;
 
 #pragma omp parallel for                                                      \
@@ -1884,14 +2125,14 @@ namespace AIM
 
     } 
 
-    Vector_3D Grid_Aerosol::Volume( ) const
+    FieldStack Grid_Aerosol::Volume( ) const
     {
 
         UInt jNy  = 0;
         UInt iNx  = 0;
         UInt iBin = 0;
 
-        Vector_3D volume( nBin, Vector_2D( Ny, Vector_1D( Nx, 0.0E+00 ) ) );
+        FieldStack volume( nBin, Ny, Nx, 0.0E+00 );
         RealDouble ratio = 0.0E+00;
 
 #pragma omp parallel for                                                      \
@@ -1970,56 +2211,14 @@ namespace AIM
     Vector_2D Grid_Aerosol::IWC( ) const
     {
 
-        UInt jNy  = 0;
-        UInt iNx  = 0;
-
-        Vector_2D TVol = TotalVolume();
-        const RealDouble FACTOR = physConst::RHO_ICE * 1.0E+06;
-
-#pragma omp parallel for                                                      \
-        default ( shared                                                    ) \
-        private ( iNx, jNy                                                  ) \
-        schedule( dynamic, 1                                                ) \
-        if      ( !PARALLEL_CASES                                           )
-        for ( jNy = 0; jNy < Ny; jNy++ ) {
-            for ( iNx = 0; iNx < Nx; iNx++ )
-                TVol[jNy][iNx] *= FACTOR;
-        /* Unit check: [m^3/cm^3] * [kg/m^3] * [cm^3/m^3] = [kg/m^3] */
-        }
-
-        return TVol;
+        return CachedMoment( MOM_IWC ).toVector();
 
     } /* End of Grid_Aerosol::IWC */
 
     Vector_2D Grid_Aerosol::Extinction( ) const
     {
 
-        UInt jNy  = 0;
-        UInt iNx  = 0;
-
-        Vector_2D chi = IWC();
-        Vector_2D rE  = EffRadius();
-
-        const RealDouble a = 3.448E+00; /* [m^2/kg] */
-        const RealDouble b = 2.431E-03; /* [m^3/kg] */
-
-#pragma omp parallel for                                                      \
-        default ( shared                                                    ) \
-        private ( iNx, jNy                                                  ) \
-        schedule( dynamic, 1                                                ) \
-        if      ( !PARALLEL_CASES                                           )
-        for ( jNy = 0; jNy < Ny; jNy++ ) {
-            for ( iNx = 0; iNx < Nx; iNx++ ) {
-                if ( rE[jNy][iNx] > 1.00E-15 ) {
-                    chi[jNy][iNx] = chi[jNy][iNx] * ( a + b / rE[jNy][iNx] );
-                    /* Unit check: 
-                     * [1/m] = [kg/m^3] * [m^2/kg] */
-                } else
-                    chi[jNy][iNx] = 0.0E+00;
-            }
-        }
-
-        return chi;
+        return CachedMoment( MOM_EXT ).toVector();
 
     } /* End of Grid_Aerosol::Extinction */
 
@@ -2159,29 +2358,7 @@ namespace AIM
     Vector_2D Grid_Aerosol::EffRadius( ) const
     {
 
-        UInt jNy  = 0;
-        UInt iNx  = 0;
-
-        Vector_2D r_eff( Ny, Vector_1D( Nx, 0.0E+00 ) );
-
-        const Vector_2D m2 = Moment( 2 );
-        const Vector_2D m3 = Moment( 3 );
-
-#pragma omp parallel for                                                      \
-        default ( shared                                                    ) \
-        private ( iNx, jNy                                                  ) \
-        schedule( dynamic, 1                                                ) \
-        if      ( !PARALLEL_CASES                                           )
-        for ( jNy = 0; jNy < Ny; jNy++ ) {
-            for ( iNx = 0; iNx < Nx; iNx++ ) {
-                if ( m2[jNy][iNx] > 1.00E-50 )
-                    r_eff[jNy][iNx] = m3[jNy][iNx]/m2[jNy][iNx];
-                else
-                    r_eff[jNy][iNx] = 0.0E+00;
-            }
-        }
-
-        return r_eff;
+        return CachedMoment( MOM_REFF ).toVector();
 
     } /* End of Grid_Aerosol::EffRadius */
 
@@ -2307,6 +2484,7 @@ namespace AIM
         }
         else {
             pdf = pdf_;
+            momentsValid = false;
         }
 
     } /* End of Grid_Aerosol::updatePdf */
@@ -2378,6 +2556,8 @@ namespace AIM
             }
         }
 
+        momentsValid = false;
+
     } /* End of Grid_Aerosol::addPDF */
 
     void Grid_Aerosol::addPDF( const Vector_1D &PDF, const Vector_2D &weights, \
@@ -2403,6 +2583,8 @@ namespace AIM
             }
         }
 
+        momentsValid = false;
+
     } /* End of Grid_Aerosol::addPDF */
 
     Vector_1D Grid_Aerosol::getBinCenters() const
@@ -2412,7 +2594,7 @@ namespace AIM
 
     } /* End of Grid_Aerosol::getBinCenters */
 
-    Vector_3D Grid_Aerosol::getBinVCenters() const
+    FieldStack Grid_Aerosol::getBinVCenters() const
     {
 
         return bin_VCenters;
@@ -2440,7 +2622,7 @@ namespace AIM
 
     } /* End of Grid_Aerosol::getNBin */
 
-    Vector_3D Grid_Aerosol::getPDF() const
+    FieldStack Grid_Aerosol::getPDF() const
     {
 
         return pdf;
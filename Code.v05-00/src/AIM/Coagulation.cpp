@@ -102,6 +102,9 @@ namespace AIM
         }
         buildF   ( bin_VCenters_1 );
 
+        vNominal = bin_VCenters_1;
+        buildMap ( vNominal, nominalMap );
+
 
     } /* End of Coagulation::Coagulation */
 
@@ -184,6 +187,9 @@ namespace AIM
         }
         buildF   ( bin_VCenters_1 );
 
+        vNominal = bin_VCenters_1;
+        buildMap ( vNominal, nominalMap );
+
     } /* End of Coagulation::Coagulation */
             
     Coagulation::Coagulation( const char* phase, Vector_1D const &bin_Centers_1, RealDouble rho_1, RealDouble bin_Centers_2, RealDouble rho_2, RealDouble temperature_K_, RealDouble pressure_Pa_ ):
@@ -261,6 +267,12 @@ namespace AIM
         beta = k.beta;
         f = k.f;
         indices = k.indices;
+        vNominal = k.vNominal;
+        nominalMap = k.nominalMap;
+        mapCache = k.mapCache;
+        nMapNominal = k.nMapNominal;
+        nMapHit = k.nMapHit;
+        nMapMiss = k.nMapMiss;
 
     } /* End of Coagulation::Coagulation */
 
@@ -275,6 +287,12 @@ namespace AIM
         beta = k.beta;
         f = k.f;
         indices = k.indices;
+        vNominal = k.vNominal;
+        nominalMap = k.nominalMap;
+        mapCache = k.mapCache;
+        nMapNominal = k.nMapNominal;
+        nMapHit = k.nMapHit;
+        nMapMiss = k.nMapMiss;
         return *this;
 
     } /* End of Coagulation::operator= */
@@ -372,7 +390,7 @@ namespace AIM
 
     } /* End of Coagulation::buildF */
 
-    void Coagulation::buildF( Vector_3D &bin_VCenters, const UInt jNy, const UInt iNx )
+    void Coagulation::buildF( const FieldStack &bin_VCenters, const UInt jNy, const UInt iNx )
     {
 
         RealDouble vij;
@@ -422,6 +440,102 @@ namespace AIM
 
     } /* End of Coagulation::buildF */
 
+    void Coagulation::buildMap( const Vector_1D &bin_VCenters, CoagMap &map ) const
+    {
+
+        /* Same mapping as buildF, for the bin volumes of one grid cell,
+         * stored as the production entries and loss rates used by
+         * Grid_Aerosol::Coagulate. Only writes into map, so that each
+         * thread can build the map of its own cell */
+
+        RealDouble vij, frac;
+        UInt iBin, jBin, e, nEntry, index;
+        const UInt size = bin_VCenters.size();
+
+        map.ptr.resize( size + 1 );
+        map.count.resize( size );
+        map.loss.resize( size * size );
+        map.target.resize( 2 * size * size );
+        map.kTmp.resize( 2 * size * size );
+        map.jTmp.resize( 2 * size * size );
+        map.coefTmp.resize( 2 * size * size );
+
+        for ( iBin = 0; iBin < size; iBin++ )
+            map.count[iBin] = 0;
+
+        /* Entries are listed by increasing jBin, then iBin. The loss rate
+         * of every pair is written, so that no zeroing is needed */
+        nEntry = 0;
+        for ( jBin = 0; jBin < size; jBin++ ) {
+            for ( iBin = 0; iBin < size; iBin++ ) {
+                vij = bin_VCenters[iBin] + bin_VCenters[jBin];
+                index = std::distance( bin_VCenters.begin(), std::upper_bound( bin_VCenters.begin(), bin_VCenters.end(), vij ) ) - 1;
+
+                /* Fraction of ( iBin, jBin ) staying in iBin */
+                map.loss[iBin*size+jBin] = 1.0E+00;
+
+                if ( index < size-1 ) {
+                    frac = ( bin_VCenters[index+1] - vij ) / ( bin_VCenters[index+1] - bin_VCenters[index] ) * bin_VCenters[index] / vij;
+                    if ( index == iBin )
+                        map.loss[iBin*size+jBin] = 1.0E+00 - frac;
+                    else if ( jBin <= index && iBin < index ) {
+                        map.target [nEntry] = index;
+                        map.kTmp   [nEntry] = iBin;
+                        map.jTmp   [nEntry] = jBin;
+                        map.coefTmp[nEntry] = frac * beta[iBin][jBin];
+                        map.count[index]++;
+                        nEntry++;
+                    }
+                    frac = 1.0E+00 - frac;
+                    index++;
+                } else {
+                    index = size-1;
+                    frac  = 1.0E+00;
+                    if ( index == iBin )
+                        map.loss[iBin*size+jBin] = 0.0E+00;
+                }
+
+                if ( jBin <= index && iBin < index ) {
+                    map.target [nEntry] = index;
+                    map.kTmp   [nEntry] = iBin;
+                    map.jTmp   [nEntry] = jBin;
+                    map.coefTmp[nEntry] = frac * beta[iBin][jBin];
+                    map.count[index]++;
+                    nEntry++;
+                }
+
+                map.loss[iBin*size+jBin] *= beta[iBin][jBin];
+            }
+        }
+
+        /* Stable counting sort by target bin */
+        map.ptr[0] = 0;
+        for ( iBin = 0; iBin < size; iBin++ ) {
+            map.ptr[iBin+1] = map.ptr[iBin] + map.count[iBin];
+            map.count[iBin] = map.ptr[iBin];
+        }
+
+        map.k.resize( nEntry );
+        map.j.resize( nEntry );
+        map.coef.resize( nEntry );
+
+        for ( e = 0; e < nEntry; e++ ) {
+            index = map.count[map.target[e]]++;
+            map.k   [index] = map.kTmp   [e];
+            map.j   [index] = map.jTmp   [e];
+            map.coef[index] = map.coefTmp[e];
+        }
+
+    } /* End of Coagulation::buildMap */
+
+    void Coagulation::ClearMaps( )
+    {
+
+        /* Drops all cached mappings. The nominal mapping is kept */
+        mapCache.clear();
+
+    } /* End of Coagulation::ClearMaps */
+
     Vector_2D Coagulation::getKernel() const
     {
 
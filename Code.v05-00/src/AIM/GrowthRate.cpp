@@ -0,0 +1,96 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*                        AIrcraft Microphysics                     */
+/*                              (AIM)                               */
+/*                                                                  */
+/* GrowthRate Program File                                          */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : GrowthRate.cpp                            */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "AIM/GrowthRate.hpp"
+
+namespace AIM
+{
+
+    GrowthRate::GrowthRate( ):
+        nBin( 0 ),
+        lastT( -1.0E+00 ),
+        lastP( -1.0E+00 ),
+        pSat_( 0.0E+00 )
+    {
+
+        /* Default constructor */
+
+    } /* End of GrowthRate::GrowthRate */
+
+    GrowthRate::GrowthRate( const Vector_1D &bin_Centers ):
+        nBin( bin_Centers.size() ),
+        r( bin_Centers ),
+        fourPiR( bin_Centers.size() ),
+        invR( bin_Centers.size() ),
+        kelvin( bin_Centers.size() ),
+        rCond( bin_Centers.size() ),
+        kGrowth( bin_Centers.size(), 0.0E+00 ),
+        lastT( -1.0E+00 ),
+        lastP( -1.0E+00 ),
+        pSat_( 0.0E+00 )
+    {
+
+        for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
+            fourPiR[iBin] = 4.0 * physConst::PI * r[iBin] * 1.00E+06;
+            invR[iBin]    = 1.0 / r[iBin];
+            kelvin[iBin]  = physFunc::Kelvin( r[iBin] );
+            rCond[iBin]   = r[iBin] / ( r[iBin] + physConst::L_T );
+        }
+
+    } /* End of GrowthRate::GrowthRate */
+
+    void GrowthRate::SetState( const RealDouble T, const RealDouble P )
+    {
+
+        if ( ( T == lastT ) && ( P == lastP ) )
+            return;
+
+        lastT = T;
+        lastP = P;
+
+        /* Terms of physFunc::growthRate that only depend on T and P */
+        const RealDouble vTherm = physFunc::thermalSpeed( T, MW_H2O / physConst::Na );
+        const RealDouble D      = physFunc::DiffCoef_H2O( T, P ); /* [m^2/s] */
+        const RealDouble lambda = physFunc::lambda( T, P );       /* [m] */
+        const RealDouble dKin   = D / ( physConst::ALPHA_H2O * vTherm ); /* [m] */
+        const RealDouble kKin   = physConst::K_AIR / ( physConst::ALPHA_T * physConst::CP_Air * physFunc::rhoAir( T, P ) * vTherm ); /* [m] */
+        const RealDouble latS   = physFunc::LHeatSubl_H2O( T );   /* [J/kg] */
+
+        pSat_ = physFunc::pSat_H2Os( T );
+        const RealDouble nSat = pSat_ / ( physConst::kB * T );   /* [#/m^3] */
+
+        /* Thermal resistance factor, to be multiplied by dCoef * Kelvin
+         * and divided by the thermal conductivity */
+        const RealDouble heat = latS * nSat * MW_H2O / ( physConst::Na * T ) \
+                              * ( latS * MW_H2O / ( physConst::R * T ) - 1.00E+00 );
+
+        const RealDouble * const r_       = r.data();
+        const RealDouble * const fourPiR_ = fourPiR.data();
+        const RealDouble * const invR_    = invR.data();
+        const RealDouble * const kelvin_  = kelvin.data();
+        const RealDouble * const rCond_   = rCond.data();
+        RealDouble * const kGrowth_       = kGrowth.data();
+
+#pragma omp simd
+        for ( UInt iBin = 0; iBin < nBin; iBin++ ) {
+            const RealDouble dCoef = D / ( r_[iBin] / ( r_[iBin] + lambda ) + dKin * invR_[iBin] );
+            const RealDouble kCond = physConst::K_AIR / ( rCond_[iBin] + kKin * invR_[iBin] );
+            kGrowth_[iBin] = fourPiR_[iBin] * dCoef \
+                           / ( 1.00E+00 + dCoef * heat * kelvin_[iBin] / kCond );
+        }
+
+    } /* End of GrowthRate::SetState */
+
+}
+
+/* End of GrowthRate.cpp */
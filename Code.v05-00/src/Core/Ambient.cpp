@@ -109,16 +109,17 @@ Ambient& Ambient::operator=( const Ambient &a )
 
 } /* End of Ambient::operator= */
 
-void Ambient::getData( RealDouble aerArray[][2], UInt iTime ) const
+void Ambient::getData( KppContext &ctx, RealDouble aerArray[][2], \
+                       UInt iTime ) const
 {
 
     UInt N = 0;
 
     for ( N = 0; N < NVAR; N++ )
-        VAR[N] = Species[N][iTime];
+        ctx.VAR[N] = Species[N][iTime];
 
     for ( N = 0; N < NFIX; N++ )
-        FIX[N] = Species[NVAR+N][iTime];
+        ctx.FIX[N] = Species[NVAR+N][iTime];
 
     aerArray[  0][0] = sootDens[iTime];
     aerArray[  0][1] = sootRadi[iTime];
@@ -129,27 +130,27 @@ void Ambient::getData( RealDouble aerArray[][2], UInt iTime ) const
 
     /* Ensure positiveness */
     for ( N = 0; N < NVAR; N++ ) {
-        if ( VAR[N] <= 0.0 ) {
-            VAR[N] = 1.0E-50;
+        if ( ctx.VAR[N] <= 0.0 ) {
+            ctx.VAR[N] = 1.0E-50;
         }
     }
 
 } /* End of Ambient::getData */
 
-void Ambient::FillIn( UInt iTime )
+void Ambient::FillIn( KppContext &ctx, UInt iTime )
 {
 
     UInt N = 0;
 
     /* Ensure positiveness */
     for ( N = 0; N < NVAR; N++ ) {
-        if ( VAR[N] <= 0.0 ) {
-            VAR[N] = 1.0E-50;
+        if ( ctx.VAR[N] <= 0.0 ) {
+            ctx.VAR[N] = 1.0E-50;
         }
     }
 
     for ( N = 0; N < NVAR; N++ )
-        Species[N][iTime] = VAR[N];
+        Species[N][iTime] = ctx.VAR[N];
 
 } /* End of Ambient::FillIn */
 
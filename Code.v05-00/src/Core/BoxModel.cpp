@@ -36,7 +36,6 @@ static int SUCCESS     =  1;
 #include "Core/Monitor.hpp"
 #include "KPP/KPP.hpp"
 #include "KPP/KPP_Parameters.h"
-#include "KPP/KPP_Global.h"
 #include "Core/SZA.hpp"
 #include "Core/Ambient.hpp"
 #include "Core/Fuel.hpp"
@@ -53,7 +52,7 @@ static int SAVE_FAIL    = -2;
 
 Vector_1D BuildTime( const RealDouble tStart, const RealDouble tEnd,    \
                      const RealDouble sunRise, const RealDouble sunSet, \
-                     const RealDouble DYN_DT );
+                     const RealDouble DYN_DT, const RealDouble NIGHT_DT );
 int BoxModel( const OptInput &Input_Opt, const Input &input )
 {
 
@@ -119,6 +118,9 @@ int BoxModel( const OptInput &Input_Opt, const Input &input )
         exit(1);
     }
 
+    /* Night-time macro step in s */
+    const RealDouble NIGHT_DT = NIGHT_DT_FACTOR * DYN_DT;
+
 #ifndef XLIM
     const RealDouble BOX_AREA = ( XLIM_LEFT + XLIM_RIGHT ) * ( YLIM_UP + YLIM_DOWN );
 #else
@@ -191,7 +193,7 @@ int BoxModel( const OptInput &Input_Opt, const Input &input )
     /* Create time array */
 
     /* Vector of time in [s] */
-    const Vector_1D timeArray = BuildTime ( tInitial_s, tFinal_s, 3600.0*sun->sunRise, 3600.0*sun->sunSet, DYN_DT );
+    const Vector_1D timeArray = BuildTime ( tInitial_s, tFinal_s, 3600.0*sun->sunRise, 3600.0*sun->sunSet, DYN_DT, NIGHT_DT );
 
     /* Time counter [-] */
     UInt nTime = 0;
@@ -400,26 +402,21 @@ int BoxModel( const OptInput &Input_Opt, const Input &input )
     /* ----------------------------------------------------------------------- */
     /* ======================================================================= */
 
-    /* Allocate arrays for KPP */
-
-    RealDouble STEPMIN = (RealDouble)0.0;
-
-    RealDouble RTOL[NVAR];
-    RealDouble ATOL[NVAR];
+    /* Chemistry context: concentrations, rates and tolerances */
+    KppContext kpp;
+    kpp.SetTolerances( KPP_RTOLS, KPP_ATOLS, 0.0E+00 );
+    kpp.DECOMP = Input_Opt.CHEMISTRY_LU_SCHED ? KPP_DECOMP_SCHEDULED \
+                                              : KPP_DECOMP_GENERATED;
+    kpp.THETAMIN = Input_Opt.CHEMISTRY_JAC_THETAMIN;
 
     /* Allocate photolysis rate array */
     RealDouble jRate[NPHOTOL];
 
-    for( UInt i = 0; i < NVAR; i++ ) {
-        RTOL[i] = KPP_RTOLS; 
-        ATOL[i] = KPP_ATOLS; 
-    }
-
     /* aerArray stores all the number concentrations of aerosols */
     RealDouble aerArray[N_AER][2];
 
     /* Ambient chemistry */
-    ambientData.getData( aerArray, nTime );
+    ambientData.getData( kpp, aerArray, nTime );
 
     
     /* ======================================================================= */
@@ -500,7 +497,7 @@ int BoxModel( const OptInput &Input_Opt, const Input &input )
 #endif /* TIME_IT */
 
         /* Ambient chemistry */
-        ambientData.getData( aerArray, nTime );
+        ambientData.getData( kpp, aerArray, nTime );
 
         /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
         /* ~~~~ Chemical rates ~~~~ */
@@ -508,21 +505,24 @@ int BoxModel( const OptInput &Input_Opt, const Input &input )
 
         /* Zero-out reaction rate */
         for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-            RCONST[iReact] = 0.0E+00;
+            kpp.RCONST[iReact] = 0.0E+00;
 
         /* Update photolysis rates */
         for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-            PHOTOL[iPhotol] = jRate[iPhotol];
+            kpp.PHOTOL[iPhotol] = jRate[iPhotol];
 
         /* Update reaction rates */
-        Update_RCONST( temperature_K, pressure_Pa, airDens, VAR[ind_H2O] );
+        Update_RCONST( kpp, temperature_K, pressure_Pa, airDens, kpp.VAR[ind_H2O] );
 
         /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
         /* ~~~~~ Integration ~~~~~~ */
         /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-        IERR = INTEGRATE( VAR, curr_Time_s, curr_Time_s + dt, \
-                          ATOL, RTOL, STEPMIN );
+        IERR = INTEGRATE( kpp, curr_Time_s, curr_Time_s + dt );
+
+        /* Start the next step from the last accepted step size */
+        if ( CHEM_WARM_START )
+            kpp.STEPMIN = kpp.RPAR[11];
 
         if ( IERR < 0 ) {
             /* Integration failed */
@@ -536,11 +536,11 @@ int BoxModel( const OptInput &Input_Opt, const Input &input )
             if ( printDEBUG ) {
                 std::cout << " ~~~ Printing reaction rates:\n";
                 for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                    std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
+                    std::cout << "Reaction " << iReact << ": " << kpp.RCONST[iReact] << " [molec/cm^3/s]\n";
                 }
                 std::cout << " ~~~ Printing concentrations:\n";
                 for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                    std::cout << "Species " << iSpec << ": " << VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
+                    std::cout << "Species " << iSpec << ": " << kpp.VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
                 }
             }
 
@@ -550,7 +550,7 @@ int BoxModel( const OptInput &Input_Opt, const Input &input )
             return KPP_FAIL;
         }
 
-        ambientData.FillIn( nTime + 1 );
+        ambientData.FillIn( kpp, nTime + 1 );
         
         curr_Time_s += dt;
         nTime++;
@@ -592,6 +592,8 @@ int BoxModel( const OptInput &Input_Opt, const Input &input )
     std::cout << "\n";
 
 #endif /* TIME_IT */
+
+    kpp.PrintCost();
     
     #pragma omp critical
     {
@@ -14,14 +14,24 @@
 #include <iostream>
 #include <vector>
 #include <cmath>
+#include <algorithm>
+
+#include "Core/Parameters.hpp"
 
 double UpdateTime( double time, const double tStart, \
                    const double sunRise, const double sunSet, \
-                   const double DYN_DT, double& nextTimeStep );
+                   const double DYN_DT, const double NIGHT_DT, \
+                   double& nextTimeStep );
+
+/* Builds the macro time steps shared by chemistry and microphysics.
+ * Time steps are DYN_DT long, except during the night where they are
+ * stretched up to NIGHT_DT (a multiple of DYN_DT). Night-time steps end
+ * on multiples of NIGHT_DT after tStart, so that any output period that
+ * is a multiple of NIGHT_DT is still hit. */
 
 std::vector<double> BuildTime( const double tStart, const double tEnd, \
                                const double sunRise, const double sunSet, \
-                               const double DYN_DT )
+                               const double DYN_DT, const double NIGHT_DT )
 {
 
     unsigned int nT = 0;
@@ -40,7 +50,7 @@ std::vector<double> BuildTime( const double tStart, const double tEnd, \
 
         timeArray.push_back( time );
         timeStep = UpdateTime( time, tStart, sunRise, sunSet, \
-                               DYN_DT, nextTimeStep );
+                               DYN_DT, NIGHT_DT, nextTimeStep );
         time += std::min( timeStep, std::abs( ( tEnd - time ) ) );
         nT++;
     }
@@ -52,7 +62,8 @@ std::vector<double> BuildTime( const double tStart, const double tEnd, \
 
 double UpdateTime( double time, const double tStart, \
                    const double sunRise, const double sunSet, \
-                   const double DYN_DT, double &nextTimeStep )
+                   const double DYN_DT, const double NIGHT_DT, \
+                   double &nextTimeStep )
 {
 
     const double default_TimeStep = DYN_DT;
@@ -101,6 +112,31 @@ double UpdateTime( double time, const double tStart, \
     if ( sunCorrection == 1 )
         nextTimeStep = currTimeStep - timeStep;
 
+    /* Stretch time step during the night, once the plume is old enough.
+     * Transport sub-steps within the macro step in PlumeModel, chemistry
+     * is handled by the adaptive integrator. */
+    if ( ( NIGHT_DT > timeStep ) && ( ( time - tStart ) >= NIGHT_DT_DELAY ) ) {
+
+        const double DAY = 24.0 * 3600.0;
+        const double tod = std::fmod( time, DAY );
+
+        /* Length of the night and position within it [s] */
+        const double nightLength = std::fmod( sunRise - sunSet + DAY, DAY );
+        const double sinceSet    = std::fmod( tod - sunSet + DAY, DAY );
+        const double toRise      = std::fmod( sunRise - tod + DAY, DAY );
+
+        /* End of step on the next multiple of NIGHT_DT */
+        const double nextNight = tStart + NIGHT_DT * \
+                               ( std::floor( ( time - tStart ) / NIGHT_DT + 1.0E-06 ) + 1.0 );
+        const double nightStep = nextNight - time;
+
+        /* Keep one dynamic time step of margin around sunset and sunrise */
+        if ( ( sinceSet < nightLength ) && ( sinceSet >= default_TimeStep ) && \
+             ( toRise >= nightStep + default_TimeStep ) )
+            timeStep = std::max( timeStep, nightStep );
+
+    }
+
     return timeStep;
 
 } /* End of Updatetime */
@@ -149,6 +149,21 @@ bool Diag_TS_Chem( const char* rootName,                     \
 
         }
 
+        /* Failed chemistry integrations, recovered or not */
+#if ( SAVE_TO_DOUBLE )
+        array = util::vect2double( Data.chemFail, m.Ny(), m.Nx(), 1.0E+00 );
+#else
+        array = util::vect2float ( Data.chemFail, m.Ny(), m.Nx(), 1.0E+00 );
+#endif /* SAVE_TO_DOUBLE */
+
+        #pragma omp critical
+        {
+        didSaveSucceed *= fileHandler.addVar2D( currFile, &(array)[0],          \
+                                     "Chem_Failures", yDim, xDim, outputType,  \
+                                     "-", "Number of failed chemistry steps" );
+        }
+        delete[] array;
+
         if ( didSaveSucceed == NC_SUCCESS ) {
 //            std::cout << " Done saving to netCDF!" << "\n";
         } else {
@@ -11,6 +11,7 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include "Core/Parameters.hpp"
 #include "Core/Input_Mod.hpp"
 
 OptInput::OptInput( ):
@@ -118,8 +119,21 @@ OptInput::OptInput( ):
     TRANSPORT_UPDRAFT( 0 ),
     TRANSPORT_UPDRAFT_TIMESCALE( 0.0E+00 ),
     TRANSPORT_UPDRAFT_VELOCITY( 0.0E+00 ),
+    TRANSPORT_SINGLE_SPECIES( 0 ),
+    TRANSPORT_SINGLE_AEROSOL( 0 ),
+    TRANSPORT_SINGLE_RINGS( 0 ),
+    TRANSPORT_NX( NX ),
+    TRANSPORT_NY( NY ),
+    TRANSPORT_GROW_DOMAIN( 0 ),
+    TRANSPORT_NX_INIT( NX ),
+    TRANSPORT_NY_INIT( NY ),
     CHEMISTRY_CHEMISTRY( 0 ),
     CHEMISTRY_HETCHEM( 0 ),
+    CHEMISTRY_SKIP_BACKG( 0 ),
+    CHEMISTRY_LU_SCHED( 0 ),
+    CHEMISTRY_JAC_THETAMIN( 0.0E+00 ),
+    CHEMISTRY_CLUSTER_TOL( 0.0E+00 ),
+    CHEMISTRY_REDUCED_TOL( 0.0E+00 ),
     CHEMISTRY_JRATE_FOLDER( "" ),
     CHEMISTRY_TIMESTEP( 0.0E+00 ),
     AEROSOL_GRAVSETTLING( 0 ),
@@ -31,6 +31,8 @@
 #include "Core/Interface.hpp"
 #include "Core/Parameters.hpp"
 #include "Core/Input.hpp"
+#include "SANDS/Solver.hpp"
+#include "SANDS/PrecisionCheck.hpp"
 
 static int DIR_FAIL = -9;
 int PARALLEL_CASES;
@@ -47,9 +49,27 @@ inline bool exist( const std::string &name )
 
 } /* End of exist */
 
-int main( int , char* )
+int main( int argc, char* argv[] )
 {
 
+    /* --warm-wisdom: only compute FFTW plans for the grid sizes of the
+     * input file and store them in the wisdom file, then exit
+     * --precision-check: compare single and double precision transport
+     * on the compiled grid, then exit */
+    bool WARM_WISDOM     = 0;
+    bool PRECISION_CHECK = 0;
+    for ( int iArg = 1; iArg < argc; iArg++ ) {
+        if ( std::string( argv[iArg] ) == "--warm-wisdom" )
+            WARM_WISDOM = 1;
+        else if ( std::string( argv[iArg] ) == "--precision-check" )
+            PRECISION_CHECK = 1;
+        else {
+            std::cout << " Unknown argument: " << argv[iArg] << std::endl;
+            std::cout << " Usage: " << argv[0] << " [--warm-wisdom] [--precision-check]" << std::endl;
+            exit(-1);
+        }
+    }
+
     std::vector<std::vector<double> > parameters;
     unsigned int iCase, nCases;
     const unsigned int iOFFSET = 0;
@@ -116,6 +136,52 @@ int main( int , char* )
     /* ====================================================================== */
     #pragma omp barrier
 
+    if ( WARM_WISDOM ) {
+
+        SANDS::Solver Solver;
+        const UInt nxFull = Input_Opt.TRANSPORT_NX;
+        const UInt nyFull = Input_Opt.TRANSPORT_NY;
+        Solver.Regrid( Mesh( nxFull, nyFull, nxFull, nyFull ) );
+        std::cout << "\n Computing FFTW plans for a " << nxFull << "x" << nyFull << " grid..." << std::endl;
+        Solver.Initialize( /* Use threaded FFT?    */ Input_Opt.SIMULATION_THREADED_FFT, \
+                           /* Use FFTW wisdom?     */ 1,                                  \
+                           /* FFTW Directory       */ Input_Opt.SIMULATION_DIRECTORY_W_WRITE_PERMISSION.c_str(), \
+                           /* Fill negative values */ 1,                                  \
+                           /* Fill with this value */ 0.0E+00,                            \
+                           /* Fill option          */ 1,                                  \
+                           /* Single precision?    */ Input_Opt.TRANSPORT_SINGLE_SPECIES || \
+                                                      Input_Opt.TRANSPORT_SINGLE_AEROSOL || \
+                                                      Input_Opt.TRANSPORT_SINGLE_RINGS );
+
+        /* All intermediate grids a growing domain goes through */
+        if ( Input_Opt.TRANSPORT_GROW_DOMAIN ) {
+            for ( UInt nx = Input_Opt.TRANSPORT_NX_INIT; nx <= nxFull; nx *= 2 ) {
+                for ( UInt ny = Input_Opt.TRANSPORT_NY_INIT; ny <= nyFull; ny *= 2 ) {
+                    std::cout << " Computing FFTW plans for a " << nx << "x" << ny << " grid..." << std::endl;
+                    Solver.Regrid( Mesh( nxFull, nyFull, nx, ny ) );
+                }
+            }
+        }
+
+        std::cout << " " << FFT_PlanRegistry::Size() << " plans stored in ";
+        std::cout << Input_Opt.SIMULATION_DIRECTORY_W_WRITE_PERMISSION << FFTW_WISDOM_FILE << std::endl;
+
+        FFT_PlanRegistry::Clear();
+        return 0;
+
+    }
+
+    if ( PRECISION_CHECK ) {
+
+        SANDS::PrecisionCheck( Input_Opt.SIMULATION_THREADED_FFT,   \
+                               Input_Opt.SIMULATION_USE_FFTW_WISDOM, \
+                               Input_Opt.SIMULATION_DIRECTORY_W_WRITE_PERMISSION.c_str() );
+
+        FFT_PlanRegistry::Clear();
+        return 0;
+
+    }
+
     /* Print number of cases considered */
     #pragma omp single
     {
@@ -265,6 +331,9 @@ int main( int , char* )
    
     std::cout << "\n All cases have been completed!" << std::endl;
 
+    /* Destroy the FFTW plans shared by all cases */
+    FFT_PlanRegistry::Clear();
+
     /* ====================================================================== */
     /* ---- END NORMALLY ---------------------------------------------------- */
     /* ====================================================================== */
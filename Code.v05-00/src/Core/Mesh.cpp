@@ -11,20 +11,46 @@
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cmath>
+#include <algorithm>
+
 #include "Core/Mesh.hpp"
 
-Mesh::Mesh( ):
-   nx( NX ),
-   ny( NY ),
+/* Full domain limits */
 #ifndef XLIM
-   xlim_right( XLIM_RIGHT ),
-   xlim_left( XLIM_LEFT ),
+    static const RealDouble FULL_XLIM_RIGHT = XLIM_RIGHT;
+    static const RealDouble FULL_XLIM_LEFT  = XLIM_LEFT;
 #else
-   xlim_right( XLIM ),
-   xlim_left( XLIM ),
+    static const RealDouble FULL_XLIM_RIGHT = XLIM;
+    static const RealDouble FULL_XLIM_LEFT  = XLIM;
 #endif
-   ylim_up( YLIM_UP ),
-   ylim_down( YLIM_DOWN )
+static const RealDouble FULL_YLIM_UP   = YLIM_UP;
+static const RealDouble FULL_YLIM_DOWN = YLIM_DOWN;
+
+/* First index of a window of n cells out of nFull, centered on the cell
+ * containing the origin, which is located at lim from the lower edge */
+static UInt CenteredIndex( const UInt nFull, const UInt n, const RealDouble lim, \
+                           const RealDouble h )
+{
+
+    const int iOrigin = (int) std::floor( lim / h );
+    const int i0      = iOrigin - (int) ( n / 2 );
+
+    return (UInt) std::max( 0, std::min( i0, (int) ( nFull - n ) ) );
+
+} /* End of CenteredIndex */
+
+Mesh::Mesh( ):
+   nx( NX ),
+   ny( NY ),
+   xlim_right( FULL_XLIM_RIGHT ),
+   xlim_left( FULL_XLIM_LEFT ),
+   ylim_up( FULL_YLIM_UP ),
+   ylim_down( FULL_YLIM_DOWN ),
+   nxFull_( NX ),
+   nyFull_( NY ),
+   i0_( 0 ),
+   j0_( 0 )
 {
 
     /* Default Constructor */
@@ -32,6 +58,74 @@ Mesh::Mesh( ):
     hx_ = ( xlim_right + xlim_left ) / nx;
     hy_ = ( ylim_up + ylim_down ) / ny;
 
+    Build();
+
+} /* End of Mesh::Mesh */
+
+Mesh::Mesh( const UInt nxFull, const UInt nyFull, \
+            const UInt nx_, const UInt ny_ ):
+   nx( nx_ ),
+   ny( ny_ ),
+   nxFull_( nxFull ),
+   nyFull_( nyFull )
+{
+
+    hx_ = ( FULL_XLIM_RIGHT + FULL_XLIM_LEFT ) / nxFull_;
+    hy_ = ( FULL_YLIM_UP + FULL_YLIM_DOWN ) / nyFull_;
+
+    SetWindow( CenteredIndex( nxFull_, nx, FULL_XLIM_LEFT, hx_ ), \
+               CenteredIndex( nyFull_, ny, FULL_YLIM_DOWN, hy_ ) );
+
+    Build();
+
+} /* End of Mesh::Mesh */
+
+Mesh::Mesh( const UInt nxFull, const UInt nyFull, \
+            const UInt nx_, const UInt ny_,       \
+            const UInt i0, const UInt j0 ):
+   nx( nx_ ),
+   ny( ny_ ),
+   nxFull_( nxFull ),
+   nyFull_( nyFull )
+{
+
+    hx_ = ( FULL_XLIM_RIGHT + FULL_XLIM_LEFT ) / nxFull_;
+    hy_ = ( FULL_YLIM_UP + FULL_YLIM_DOWN ) / nyFull_;
+
+    SetWindow( i0, j0 );
+
+    Build();
+
+} /* End of Mesh::Mesh */
+
+void Mesh::SetWindow( const UInt i0, const UInt j0 )
+{
+
+    if ( ( nx == 0 ) || ( ny == 0 ) || ( i0 + nx > nxFull_ ) || ( j0 + ny > nyFull_ ) ) {
+        std::cout << " In Mesh::SetWindow: Window does not fit in the domain ( ";
+        std::cout << ny << "x" << nx << " at " << j0 << "," << i0;
+        std::cout << " in " << nyFull_ << "x" << nxFull_ << " )\n";
+        exit(-1);
+    }
+
+    i0_ = i0;
+    j0_ = j0;
+
+    /* Window limits, counted as the full domain's */
+    xlim_left  = FULL_XLIM_LEFT - i0_ * hx_;
+    xlim_right = ( i0_ + nx ) * hx_ - FULL_XLIM_LEFT;
+    ylim_down  = FULL_YLIM_DOWN - j0_ * hy_;
+    ylim_up    = ( j0_ + ny ) * hy_ - FULL_YLIM_DOWN;
+
+} /* End of Mesh::SetWindow */
+
+void Mesh::Build( )
+{
+
+    x_.clear(); x_e_.clear(); dx_.clear();
+    y_.clear(); y_e_.clear(); dy_.clear();
+    areas_.clear();
+
     /* Cell center x-coordinates */
     for ( UInt i = 0; i < nx; i++ ) {
         x_.push_back( i * hx_ - xlim_left + hx_ / 2.0 );
@@ -67,7 +161,7 @@ Mesh::Mesh( ):
         }
     }
 
-} /* End of Mesh::Mesh */
+} /* End of Mesh::Build */
 
 Mesh::Mesh( const Mesh &m )
 {
@@ -87,9 +181,14 @@ Mesh::Mesh( const Mesh &m )
     hy_         = m.hy_;
     nx          = m.nx;
     ny          = m.ny;
+    nxFull_     = m.nxFull_;
+    nyFull_     = m.nyFull_;
+    i0_         = m.i0_;
+    j0_         = m.j0_;
     nCellMap    = m.nCellMap;
     weights     = m.weights;
     mapIndex_   = m.mapIndex_;
+    ringCells_  = m.ringCells_;
 
 } /* End of Mesh::Mesh */
 
@@ -114,9 +213,14 @@ Mesh& Mesh::operator=( const Mesh &m )
     hy_         = m.hy_;
     nx          = m.nx;
     ny          = m.ny;
+    nxFull_     = m.nxFull_;
+    nyFull_     = m.nyFull_;
+    i0_         = m.i0_;
+    j0_         = m.j0_;
     nCellMap    = m.nCellMap;
     weights     = m.weights;
     mapIndex_   = m.mapIndex_;
+    ringCells_  = m.ringCells_;
 
     return *this;
 
@@ -150,11 +254,11 @@ void Mesh::Ring2Mesh( Cluster &c )
 
     std::cout << "Mesh::Ring2Mesh: Symmetry around the Y-axis is assumed!";
     std::cout << std::endl;
-    nx_max = std::ceil(NX/2);
+    nx_max = std::ceil(nx/2);
 
 #else
 
-    nx_max = NX;
+    nx_max = nx;
 
 #endif /* Y_SYMMETRY */
 
@@ -162,11 +266,11 @@ void Mesh::Ring2Mesh( Cluster &c )
 
     std::cout << "Mesh::Ring2Mesh: Symmetry around the X-axis is assumed!";
     std::cout << std::endl;
-    ny_max = std::ceil(NY/2);
+    ny_max = std::ceil(ny/2);
 
 #else
 
-    ny_max = NY;
+    ny_max = ny;
 
 #endif /* X_SYMMETRY */
 
@@ -183,14 +287,14 @@ void Mesh::Ring2Mesh( Cluster &c )
      * In case we do not want to perform chemistry in the ring structure, we
      * only care about the most inner ring in which emissions are released */
 
-    if ( RingV[nRing - 1].getHAxis() > x_[NX - 1] ) {
+    if ( RingV[nRing - 1].getHAxis() > x_[nx - 1] ) {
         std::cout << "The largest ring's horizontal axis is larger than the grid's dimensions!\n";
-        std::cout << "Horizontal axis: " << RingV[nRing-1].getHAxis() << " >= " << x_[NX - 1] << std::endl;
+        std::cout << "Horizontal axis: " << RingV[nRing-1].getHAxis() << " >= " << x_[nx - 1] << std::endl;
         /*exit(-1);*/
     }
-    if ( RingV[nRing - 1].getVAxis() > y_[NY - 1] ) {
+    if ( RingV[nRing - 1].getVAxis() > y_[ny - 1] ) {
         std::cout << "The largest ring's vertical axis is larger than the grid's dimensions!\n";
-        std::cout << "Vertical axis: " << RingV[nRing-1].getVAxis() << " >= " << y_[NY - 1] << std::endl;
+        std::cout << "Vertical axis: " << RingV[nRing-1].getVAxis() << " >= " << y_[ny - 1] << std::endl;
         /*exit(-1);*/
     }
 
@@ -211,18 +315,18 @@ void Mesh::Ring2Mesh( Cluster &c )
 #endif /* RINGS */
 
     Vector_2D v2d;
-    Vector_1D v1d( NX, 0.0E+00 );
+    Vector_1D v1d( nx, 0.0E+00 );
 
     /* For rings and ambient */
     for ( UInt iRing = 0; iRing < maxRing; iRing++ ) {
         nCellMap.push_back( 0 );
         weights.push_back( v2d );
-        for ( UInt iNy = 0; iNy < NY; iNy++ ) {
+        for ( UInt iNy = 0; iNy < ny; iNy++ ) {
             weights[iRing].push_back( v1d );
         }
     }
-    for ( UInt iNy = 0; iNy < NY; iNy++ )
-        mapIndex_.push_back( Vector_1Dui( NX, 0 ) );
+    for ( UInt iNy = 0; iNy < ny; iNy++ )
+        mapIndex_.push_back( Vector_1Dui( nx, 0 ) );
 
 
     for ( UInt iRing = 0; iRing < maxRing; iRing++ ) {
@@ -396,23 +500,23 @@ void Mesh::Ring2Mesh( Cluster &c )
 
                 /* Split over 4 cells */
                 /* First cell */
-                jNy = std::ceil(NY/2);
-                iNx = std::ceil(NX/2);
+                jNy = std::ceil(ny/2);
+                iNx = std::ceil(nx/2);
                 weights[iRing][jNy][iNx] = 0.25 * ringArea / cellArea_; /* 1.0E+00; */
                 mapIndex_[jNy][iNx] = iRing;
                 /* Second cell */
-                jNy = std::ceil(NY/2-1);
-                iNx = std::ceil(NX/2);
+                jNy = std::ceil(ny/2-1);
+                iNx = std::ceil(nx/2);
                 weights[iRing][jNy][iNx] = 0.25 * ringArea / cellArea_; /* 1.0E+00; */
                 mapIndex_[jNy][iNx] = iRing;
                 /* Third cell */
-                jNy = std::ceil(NY/2);
-                iNx = std::ceil(NX/2-1);
+                jNy = std::ceil(ny/2);
+                iNx = std::ceil(nx/2-1);
                 weights[iRing][jNy][iNx] = 0.25 * ringArea / cellArea_; /* 1.0E+00; */
                 mapIndex_[jNy][iNx] = iRing;
                 /* Fourth cell */
-                jNy = std::ceil(NY/2-1);
-                iNx = std::ceil(NX/2-1);
+                jNy = std::ceil(ny/2-1);
+                iNx = std::ceil(nx/2-1);
                 weights[iRing][jNy][iNx] = 0.25 * ringArea / cellArea_; /* 1.0E+00; */
                 mapIndex_[jNy][iNx] = iRing;
                 /* nCellMap */
@@ -430,20 +534,20 @@ void Mesh::Ring2Mesh( Cluster &c )
          *                         |
          *              (2)        |       (4)
          *                         |
-         * NY/2  __________________|__________________
+         * ny/2  __________________|__________________
          *                         |
          *                         |
          *              (1)        |       (3)
          *                         |
-         * (0,0)                 NX/2
+         * (0,0)                 nx/2
          */
         /* Region 1 has been done previously */
 
         /* Do region 2 */
         for ( UInt iNx = 0; iNx < nx_max; iNx++ ) {
-            for ( UInt jNy = ny_max; jNy < NY; jNy++ ) {
-                weights[iRing][jNy][iNx] = weights[iRing][(NY - 1) - jNy][iNx];
-                mapIndex_[jNy][iNx] = mapIndex_[(NY - 1) - jNy][iNx];
+            for ( UInt jNy = ny_max; jNy < ny; jNy++ ) {
+                weights[iRing][jNy][iNx] = weights[iRing][(ny - 1) - jNy][iNx];
+                mapIndex_[jNy][iNx] = mapIndex_[(ny - 1) - jNy][iNx];
             }
         }
         
@@ -451,18 +555,18 @@ void Mesh::Ring2Mesh( Cluster &c )
         
         /* Do regions 3 and 4 */
         /* 3 */
-        for ( UInt iNx = nx_max; iNx < NX; iNx++ ) {
+        for ( UInt iNx = nx_max; iNx < nx; iNx++ ) {
             for ( UInt jNy = 0; jNy < ny_max; jNy++ ) {
-                weights[iRing][jNy][iNx] = weights[iRing][jNy][(NX - 1) - iNx];
-                mapIndex_[jNy][iNx] = mapIndex_[jNy][(NX - 1) - iNx];
+                weights[iRing][jNy][iNx] = weights[iRing][jNy][(nx - 1) - iNx];
+                mapIndex_[jNy][iNx] = mapIndex_[jNy][(nx - 1) - iNx];
             }
         }
        
         /* 4 */
-        for ( UInt iNx = nx_max; iNx < NX; iNx++ ) {
-            for ( UInt jNy = ny_max; jNy < NY; jNy++ ) {
-                weights[iRing][jNy][iNx] = weights[iRing][(NY - 1) - jNy][(NX - 1) - iNx];
-                mapIndex_[jNy][iNx] = mapIndex_[(NY - 1) - jNy][(NX - 1 ) - iNx];
+        for ( UInt iNx = nx_max; iNx < nx; iNx++ ) {
+            for ( UInt jNy = ny_max; jNy < ny; jNy++ ) {
+                weights[iRing][jNy][iNx] = weights[iRing][(ny - 1) - jNy][(nx - 1) - iNx];
+                mapIndex_[jNy][iNx] = mapIndex_[(ny - 1) - jNy][(nx - 1 ) - iNx];
             }
         }
         
@@ -473,10 +577,10 @@ void Mesh::Ring2Mesh( Cluster &c )
 #if ( X_SYMMETRY && !Y_SYMMETRY )
         /* Do regions 2 and 4 */
         /* 2 and 4 */
-        for ( UInt iNx = 0; iNx < NX; iNx++ ) {
-            for ( UInt jNy = ny_max; jNy < NY; jNy++ ) {
-                weights[iRing][jNy][iNx] = weights[iRing][(NY - 1) - jNy][iNx];
-                mapIndex_[jNy][iNx] = mapIndex_[(NY - 1) - jNy][iNx];
+        for ( UInt iNx = 0; iNx < nx; iNx++ ) {
+            for ( UInt jNy = ny_max; jNy < ny; jNy++ ) {
+                weights[iRing][jNy][iNx] = weights[iRing][(ny - 1) - jNy][iNx];
+                mapIndex_[jNy][iNx] = mapIndex_[(ny - 1) - jNy][iNx];
             }
         }
         
@@ -488,31 +592,31 @@ void Mesh::Ring2Mesh( Cluster &c )
         /* Do regions 3 and 4 */
         /* 3 and 4 */
         if ( !c.halfRing() ) {
-            for ( UInt iNx = nx_max; iNx < NX; iNx++ ) {
-                for ( UInt jNy = 0; jNy < NY; jNy++ ) {
-                    weights[iRing][jNy][iNx] = weights[iRing][jNy][(NX - 1) - iNx];
-                    mapIndex_[jNy][iNx] = mapIndex_[jNy][(NX - 1) - iNx];
+            for ( UInt iNx = nx_max; iNx < nx; iNx++ ) {
+                for ( UInt jNy = 0; jNy < ny; jNy++ ) {
+                    weights[iRing][jNy][iNx] = weights[iRing][jNy][(nx - 1) - iNx];
+                    mapIndex_[jNy][iNx] = mapIndex_[jNy][(nx - 1) - iNx];
                 }
             }
 
             nCellMap[iRing] *= 2;
         } else {
             if ( iRing < nRing ) {
-                for ( UInt iNx = nx_max; iNx < NX; iNx++ ) {
-                    for ( UInt jNy = 0; jNy < NY; jNy++ ) {
-                        weights[iRing-1][jNy][iNx] = weights[iRing-1][jNy][(NX - 1) - iNx];
-                        weights[iRing][jNy][iNx]   = weights[iRing][jNy][(NX - 1) - iNx];
-                        mapIndex_[jNy][iNx] = mapIndex_[jNy][(NX - 1) - iNx];
+                for ( UInt iNx = nx_max; iNx < nx; iNx++ ) {
+                    for ( UInt jNy = 0; jNy < ny; jNy++ ) {
+                        weights[iRing-1][jNy][iNx] = weights[iRing-1][jNy][(nx - 1) - iNx];
+                        weights[iRing][jNy][iNx]   = weights[iRing][jNy][(nx - 1) - iNx];
+                        mapIndex_[jNy][iNx] = mapIndex_[jNy][(nx - 1) - iNx];
                     }
                 }
 
                 nCellMap[iRing] *= 2;
             }
             else {
-                for ( UInt iNx = nx_max; iNx < NX; iNx++ ) {
-                    for ( UInt jNy = 0; jNy < NY; jNy++ ) {
-                        weights[iRing][jNy][iNx] = weights[iRing][jNy][(NX - 1) - iNx];
-                        mapIndex_[jNy][iNx] = mapIndex_[jNy][(NX - 1) - iNx];
+                for ( UInt iNx = nx_max; iNx < nx; iNx++ ) {
+                    for ( UInt jNy = 0; jNy < ny; jNy++ ) {
+                        weights[iRing][jNy][iNx] = weights[iRing][jNy][(nx - 1) - iNx];
+                        mapIndex_[jNy][iNx] = mapIndex_[jNy][(nx - 1) - iNx];
                     }
                 }
 
@@ -524,6 +628,7 @@ void Mesh::Ring2Mesh( Cluster &c )
 
     }
 
+    BuildRingCells( );
 
 } /* End of Mesh::Ring2Mesh */
 
@@ -534,8 +639,17 @@ void Mesh::MapWeights( )
     UInt nRing = weights.size(); // This is actually equal to nRing+1
 
     RealDouble max = 0.0E+00;
-    for ( jNy = 0; jNy < NY; jNy++ ) {
-        for ( iNx = 0; iNx < NX; iNx++ ) {
+
+    if ( mapIndex_.size() != ny )
+        mapIndex_.assign( ny, Vector_1Dui( nx, 0 ) );
+
+#pragma omp parallel for                 \
+    if       ( !PARALLEL_CASES         ) \
+    default  ( shared                  ) \
+    private  ( iNx, jNy, iRing, max    ) \
+    schedule ( static                  )
+    for ( jNy = 0; jNy < ny; jNy++ ) {
+        for ( iNx = 0; iNx < nx; iNx++ ) {
             max = weights[0][jNy][iNx];
             mapIndex_[jNy][iNx] = 0;
             for ( iRing = 1; iRing < nRing; iRing++ ) {
@@ -547,8 +661,173 @@ void Mesh::MapWeights( )
         }
     }
 
+    BuildRingCells( );
+
 } /* End of Mesh::MapWeights */
 
+void Mesh::BuildRingCells( )
+{
+
+    UInt jNy, iNx, iRing;
+
+    /* Rings and ambient. Without weights, all cells map to 0 */
+    const UInt nRing = std::max( (UInt) weights.size(), (UInt) 1 );
+
+    if ( mapIndex_.size() != ny ) {
+        ringCells_.clear();
+        return;
+    }
+
+    /* Number of cells of each ring in each row. Rows are then filled
+     * independently, each starting at the sum of the counts of the rows
+     * below, which keeps cell lists sorted. */
+    Vector_2Dui offset( ny + 1, Vector_1Dui( nRing, 0 ) );
+
+#pragma omp parallel for                 \
+    if       ( !PARALLEL_CASES         ) \
+    default  ( shared                  ) \
+    private  ( iNx, jNy                ) \
+    schedule ( static                  )
+    for ( jNy = 0; jNy < ny; jNy++ ) {
+        for ( iNx = 0; iNx < nx; iNx++ )
+            offset[jNy+1][mapIndex_[jNy][iNx]]++;
+    }
+
+    for ( jNy = 0; jNy < ny; jNy++ ) {
+        for ( iRing = 0; iRing < nRing; iRing++ )
+            offset[jNy+1][iRing] += offset[jNy][iRing];
+    }
+
+    ringCells_.assign( nRing, Vector_1Dui( ) );
+    for ( iRing = 0; iRing < nRing; iRing++ )
+        ringCells_[iRing].resize( offset[ny][iRing] );
+
+#pragma omp parallel for                 \
+    if       ( !PARALLEL_CASES         ) \
+    default  ( shared                  ) \
+    private  ( iNx, jNy, iRing         ) \
+    schedule ( static                  )
+    for ( jNy = 0; jNy < ny; jNy++ ) {
+        for ( iNx = 0; iNx < nx; iNx++ ) {
+            iRing = mapIndex_[jNy][iNx];
+            ringCells_[iRing][offset[jNy][iRing]++] = jNy * nx + iNx;
+        }
+    }
+
+} /* End of Mesh::BuildRingCells */
+
+template <class Field>
+void Mesh::EdgeCheck( const Field &F, bool edge[4] ) const
+{
+
+    const UInt bandX = std::max( (UInt) std::ceil( GRID_EDGE_WIDTH * nx ), (UInt) 1 );
+    const UInt bandY = std::max( (UInt) std::ceil( GRID_EDGE_WIDTH * ny ), (UInt) 1 );
+
+    RealDouble total = 0.0E+00;
+    RealDouble left  = 0.0E+00;
+    RealDouble right = 0.0E+00;
+    RealDouble down  = 0.0E+00;
+    RealDouble up    = 0.0E+00;
+
+    /* Cells are uniform, no need for area weighting */
+    for ( UInt jNy = 0; jNy < ny; jNy++ ) {
+        for ( UInt iNx = 0; iNx < nx; iNx++ ) {
+            const RealDouble value = std::abs( F[jNy][iNx] );
+            total += value;
+            if ( iNx < bandX )
+                left  += value;
+            if ( iNx >= nx - bandX )
+                right += value;
+            if ( jNy < bandY )
+                down  += value;
+            if ( jNy >= ny - bandY )
+                up    += value;
+        }
+    }
+
+    if ( total <= 0.0E+00 )
+        return;
+
+    /* Only flag sides that can still move */
+    edge[0] = edge[0] || ( ( i0_ > 0 )                && ( left  > GRID_EDGE_FRAC * total ) );
+    edge[1] = edge[1] || ( ( i0_ + nx < nxFull_ )     && ( right > GRID_EDGE_FRAC * total ) );
+    edge[2] = edge[2] || ( ( j0_ > 0 )                && ( down  > GRID_EDGE_FRAC * total ) );
+    edge[3] = edge[3] || ( ( j0_ + ny < nyFull_ )     && ( up    > GRID_EDGE_FRAC * total ) );
+
+} /* End of Mesh::EdgeCheck */
+
+template void Mesh::EdgeCheck<Field2D>( const Field2D &F, bool edge[4] ) const;
+template void Mesh::EdgeCheck<Vector_2D>( const Vector_2D &F, bool edge[4] ) const;
+
+/* Doubles a window [i0, i0+n) of the full grid [0, nFull) towards the
+ * flagged side(s). Returns the new first index and updates n. */
+static UInt GrowWindow( const UInt i0, UInt &n, const UInt nFull, \
+                        const bool lower, const bool upper )
+{
+
+    if ( !( lower || upper ) || ( n >= nFull ) )
+        return i0;
+
+    const UInt nNew  = std::min( 2 * n, nFull );
+    const UInt added = nNew - n;
+
+    int i0New = (int) i0;
+    if ( lower && upper )
+        i0New -= (int) ( added / 2 );
+    else if ( lower )
+        i0New -= (int) added;
+
+    n = nNew;
+    return (UInt) std::max( 0, std::min( i0New, (int) ( nFull - nNew ) ) );
+
+} /* End of GrowWindow */
+
+bool Mesh::Grow( const bool edge[4], Mesh &grown ) const
+{
+
+    UInt nxNew = nx;
+    UInt nyNew = ny;
+    const UInt i0New = GrowWindow( i0_, nxNew, nxFull_, edge[0], edge[1] );
+    const UInt j0New = GrowWindow( j0_, nyNew, nyFull_, edge[2], edge[3] );
+
+    if ( ( nxNew == nx ) && ( nyNew == ny ) )
+        return 0;
+
+    grown = Mesh( nxFull_, nyFull_, nxNew, nyNew, i0New, j0New );
+
+    /* Offset of this window in the new one */
+    const UInt iOff = i0_ - i0New;
+    const UInt jOff = j0_ - j0New;
+
+    /* Ring weights and mapping are extended with the values of the
+     * closest cell of the current window */
+    const UInt nRing = weights.size();
+    grown.weights.assign( nRing, Vector_2D( nyNew, Vector_1D( nxNew, 0.0E+00 ) ) );
+    grown.mapIndex_.assign( nyNew, Vector_1Dui( nxNew, 0 ) );
+    grown.nCellMap = nCellMap;
+
+    for ( UInt jNy = 0; jNy < nyNew; jNy++ ) {
+        const UInt jOld = std::min( (UInt) std::max( (int) jNy - (int) jOff, 0 ), ny - 1 );
+        for ( UInt iNx = 0; iNx < nxNew; iNx++ ) {
+            const UInt iOld = std::min( (UInt) std::max( (int) iNx - (int) iOff, 0 ), nx - 1 );
+            for ( UInt iRing = 0; iRing < nRing; iRing++ )
+                grown.weights[iRing][jNy][iNx] = weights[iRing][jOld][iOld];
+            if ( mapIndex_.size() > 0 ) {
+                const bool inside = ( jNy >= jOff ) && ( jNy < jOff + ny ) && \
+                                    ( iNx >= iOff ) && ( iNx < iOff + nx );
+                grown.mapIndex_[jNy][iNx] = mapIndex_[jOld][iOld];
+                if ( !inside && ( mapIndex_[jOld][iOld] < nCellMap.size() ) )
+                    grown.nCellMap[mapIndex_[jOld][iOld]]++;
+            }
+        }
+    }
+
+    grown.BuildRingCells( );
+
+    return 1;
+
+} /* End of Mesh::Grow */
+
 void Mesh::Debug( ) const
 {
 
@@ -576,9 +855,9 @@ void Mesh::Debug( ) const
     std::cout << " ";
     std::cout << cell;
     std::cout << " cells over ";
-    std::cout << NCELL;
+    std::cout << nx * ny;
     std::cout << " ( ";
-    std::cout << 100 * ( cell / ((RealDouble)NCELL) );
+    std::cout << 100 * ( cell / ((RealDouble) nx * ny) );
     std::cout << " % )";
     std::cout << std::endl;
     std::cout << std::endl;
@@ -403,6 +403,45 @@ Meteorology::Meteorology( const Meteorology &met ) :
 
 } /* End of Meteorology::Meteorology */
 
+Meteorology& Meteorology::operator=( const Meteorology &met )
+{
+
+    if ( &met == this )
+        return *this;
+
+    alt_user      = met.alt_user;
+    temp_user     = met.temp_user;
+    pres_user     = met.pres_user;
+    RHw_user      = met.RHw_user;
+    satdepth_user = met.satdepth_user;
+
+    TYPE          = met.TYPE;
+    TEMPERATURE   = met.TEMPERATURE;
+    PRESSURE      = met.PRESSURE;
+    RHI           = met.RHI;
+    ALTITUDE      = met.ALTITUDE;
+    LAPSERATE     = met.LAPSERATE;
+    DIURNAL_AMPL  = met.DIURNAL_AMPL;
+    DIURNAL_PHASE = met.DIURNAL_PHASE;
+    diurnalPert   = met.diurnalPert;
+    DELTAT        = met.DELTAT;
+    TOP           = met.TOP;
+    BOT           = met.BOT;
+    LEFT          = met.LEFT;
+    RIGHT         = met.RIGHT;
+    RH            = met.RH;
+    RH_star       = met.RH_star;
+    RH_far        = met.RH_far;
+    alt_          = met.alt_;
+    press_        = met.press_;
+    temp_         = met.temp_;
+    airDens_      = met.airDens_;
+    H2O_          = met.H2O_;
+
+    return *this;
+
+} /* End of Meteorology::operator= */
+
 Meteorology::~Meteorology( )
 {
 
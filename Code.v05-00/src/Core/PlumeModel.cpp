@@ -40,6 +40,7 @@ static int SUCCESS     =  1;
 #include "AIM/Settling.hpp"
 #include "EPM/Integrate.hpp"
 #include "KPP/KPP.hpp"
+#include "KPP/KPP_RateCache.hpp"
 #include "KPP/KPP_Parameters.h"
 #include "KPP/KPP_Global.h"
 #include "Core/SZA.hpp"
@@ -68,6 +69,10 @@ static int SUCCESS     =  1;
 int isSaved = 1;
 static int SAVE_FAIL   = -2;
 
+/* Chemistry runs on KppContext objects. The globals below are only used
+ * by the adjoint driver and its integrator (KPP_Main_ADJ, INTEGRATE_ADJ),
+ * and NOON_JRATES by Update_JRates. */
+
 RealDouble C[NSPEC];             /* Concentration of all species */
 RealDouble * VAR = &C[0];        /* Concentration of variable species (global) */
 RealDouble * FIX = &C[NVAR];     /* Concentration of fixed species (global) */
@@ -91,7 +96,7 @@ void AdvGlobal( const RealDouble time, const RealDouble T_UPDRAFT, \
                 RealDouble &dTrav_x, RealDouble &dTrav_y );
 Vector_1D BuildTime( const RealDouble tStart, const RealDouble tEnd,    \
                      const RealDouble sunRise, const RealDouble sunSet, \
-                     const RealDouble DYN_DT );
+                     const RealDouble DYN_DT, const RealDouble NIGHT_DT );
 
 
 int PlumeModel( OptInput &Input_Opt, const Input &input )
@@ -125,6 +130,13 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
 
     const bool TRANSPORT          = Input_Opt.TRANSPORT_TRANSPORT;
     const RealDouble TRANSPORT_DT = Input_Opt.TRANSPORT_TIMESTEP;
+    /* Transform precision for each class of fields. Plume H2O is always
+     * transported in double precision */
+    const bool SINGLE_SPECIES     = Input_Opt.TRANSPORT_SINGLE_SPECIES;
+    const bool SINGLE_AEROSOL     = Input_Opt.TRANSPORT_SINGLE_AEROSOL;
+    const bool SINGLE_RINGS       = Input_Opt.TRANSPORT_SINGLE_RINGS;
+    /* Start on a reduced grid and grow it as the plume spreads? */
+    const bool GROW_DOMAIN        = Input_Opt.TRANSPORT_GROW_DOMAIN;
 
     #ifdef RINGS
         /* The RINGS option requires that negative values are filled with
@@ -147,6 +159,9 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
     const bool CHEMISTRY          = Input_Opt.CHEMISTRY_CHEMISTRY;
     const RealDouble CHEMISTRY_DT = Input_Opt.CHEMISTRY_TIMESTEP;
     const bool HETCHEM            = Input_Opt.CHEMISTRY_HETCHEM;
+    const bool SKIP_BACKG         = Input_Opt.CHEMISTRY_SKIP_BACKG;
+    const RealDouble CLUSTER_TOL  = Input_Opt.CHEMISTRY_CLUSTER_TOL;
+    const RealDouble REDUCED_TOL  = Input_Opt.CHEMISTRY_REDUCED_TOL;
     const char* JRATE_FOLDER      = Input_Opt.CHEMISTRY_JRATE_FOLDER.c_str();
 
     /* ======================================================================= */
@@ -259,6 +274,18 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
         std::cout << " Output might be compromised!" << std::endl;
     }
 
+    /* Night-time macro step in s. Pick the largest multiple of DYN_DT, up
+     * to NIGHT_DT_FACTOR, that divides every timeseries output period.
+     * Timeseries written at every time step disable stretching. */
+    UInt nNight = NIGHT_DT_FACTOR;
+    while ( ( nNight > 1 ) && \
+            ( ( TS_SPEC && ( ( TS_FREQ == 0.0E+00 ) || \
+                ( std::fmod( TS_FREQ * 60.0, nNight * DYN_DT ) != 0.0E+00 ) ) ) || \
+              ( TS_AERO && ( ( TS_AERO_FREQ == 0.0E+00 ) || \
+                ( std::fmod( TS_AERO_FREQ * 60.0, nNight * DYN_DT ) != 0.0E+00 ) ) ) ) )
+        nNight--;
+    const RealDouble NIGHT_DT = nNight * DYN_DT;
+
     /* Assign parameters */
 
     RealDouble temperature_K = input.temperature_K();
@@ -327,12 +354,14 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
     /* ----------------------------------------------------------------------- */
     /* ======================================================================= */
 
-    Mesh m;
-    const Vector_1D xE = m.xE();
-    const Vector_1D yE = m.yE();
+    /* Without domain growth, the initial grid is the full grid */
+    Mesh m( Input_Opt.TRANSPORT_NX,      Input_Opt.TRANSPORT_NY, \
+            Input_Opt.TRANSPORT_NX_INIT, Input_Opt.TRANSPORT_NY_INIT );
+    Vector_1D xE = m.xE();
+    Vector_1D yE = m.yE();
 
     /* Get cell areas */
-    const Vector_2D cellAreas = m.areas();
+    Vector_2D cellAreas = m.areas();
 
     /* ======================================================================= */
     /* ----------------------------------------------------------------------- */
@@ -409,11 +438,15 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
     RealDouble curr_Time_s = tInitial_s; /* [s] */
     /* Time step in [s] */
     RealDouble dt = 0;                   /* [s] */
+    /* Transport sub-steps */
+    UInt nSubStep    = 1;
+    RealDouble dtSub = 0;                /* [s] */
+    RealDouble tSub  = 0;                /* [s] */
 
     /* Create time array */
 
     /* Vector of time in [s] */
-    const Vector_1D timeArray = BuildTime ( tInitial_s, tFinal_s, 3600.0*sun->sunRise, 3600.0*sun->sunSet, DYN_DT );
+    const Vector_1D timeArray = BuildTime ( tInitial_s, tFinal_s, 3600.0*sun->sunRise, 3600.0*sun->sunSet, DYN_DT, NIGHT_DT );
 
     /* Time counter [-] */
     UInt nTime = 0;
@@ -435,6 +468,12 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
     /* ----------------------------------------------------------------------- */
     /* ======================================================================= */
 
+    /* Keep the inputs the meteorology was built from, to rebuild it if
+     * the domain grows */
+    const OptInput Met_Opt               = Input_Opt;
+    const RealDouble Met_temperature_K   = temperature_K;
+    const RealDouble Met_relHumidity_i   = relHumidity_i;
+
     Meteorology Met( Input_Opt, curr_Time_s / 3600.0, m,        \
                      temperature_K, pressure_Pa, relHumidity_i, \
                      printDEBUG );
@@ -514,7 +553,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
     D_Y   = input.vertiDiff(); /* [m^2/s] */
     shear = input.shear();     /* [1/s] */
     if ( shear >= 0.0E+00 )
-        LASTINDEX_SHEAR = NX-1;
+        LASTINDEX_SHEAR = m.Nx()-1;
     else
         LASTINDEX_SHEAR = 0;
 
@@ -524,15 +563,20 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
     /* Allocate Solvers */
     SANDS::Solver Solver;
     #pragma omp critical
-    {
-        std::cout << "\n Initializing solver..." << std::endl;
-        Solver.Initialize( /* Use threaded FFT?    */ THREADED_FFT, \
-                           /* Use FFTW wisdom?     */ USE_WISDOM,   \
-                           /* FFTW Directory       */ FFTW_DIR,     \
-                           /* Fill negative values */ FILLNEG,      \
-                           /* Fill with this value */ fillWith );
-        std::cout << "\n Initialization complete..." << std::endl;
-    }
+    { std::cout << "\n Initializing solver..." << std::endl; }
+
+    /* FFTW plans are shared across cases and planning is serialized by
+     * FFT_PlanRegistry */
+    Solver.Initialize( /* Use threaded FFT?    */ THREADED_FFT, \
+                       /* Use FFTW wisdom?     */ USE_WISDOM,   \
+                       /* FFTW Directory       */ FFTW_DIR,     \
+                       /* Fill negative values */ FILLNEG,      \
+                       /* Fill with this value */ fillWith,     \
+                       /* Fill option          */ 1,            \
+                       /* Single precision?    */ SINGLE_SPECIES || SINGLE_AEROSOL || SINGLE_RINGS );
+
+    #pragma omp critical
+    { std::cout << "\n Initialization complete..." << std::endl; }
 
 
     /* ======================================================================= */
@@ -588,29 +632,24 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
     /* ----------------------------------------------------------------------- */
     /* ======================================================================= */
 
-    /* Allocate arrays for KPP */
-
-    RealDouble STEPMIN = (RealDouble)0.0;
-
-    /* Allocate tolerances */
-    RealDouble RTOL[NVAR];
-    RealDouble ATOL[NVAR];
+    /* Chemistry context: concentrations, rates and tolerances for the
+     * ambient and ring chemistry. Grid cells are integrated from
+     * per-block copies. */
+    KppContext kpp;
+    kpp.SetTolerances( KPP_RTOLS, KPP_ATOLS, 0.0E+00 );
+    kpp.DECOMP = Input_Opt.CHEMISTRY_LU_SCHED ? KPP_DECOMP_SCHEDULED \
+                                              : KPP_DECOMP_GENERATED;
+    kpp.THETAMIN = Input_Opt.CHEMISTRY_JAC_THETAMIN;
 
     /* Allocate RealDoubles to store RH and IWC */
     RealDouble relHumidity, IWC;
 
-    /* Initialize tolerances */
-    for( UInt i = 0; i < NVAR; i++ ) {
-        RTOL[i] = KPP_RTOLS;
-        ATOL[i] = KPP_ATOLS;
-    }
-
 
     /* aerArray stores all the number concentrations of aerosols */
     RealDouble aerArray[N_AER][2];
 
     /* Ambient chemistry */
-    ambientData.getData( aerArray, nTime );
+    ambientData.getData( kpp, aerArray, nTime );
 
     /* ======================================================================= */
     /* ----------------------------------------------------------------------- */
@@ -624,7 +663,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
     RealDouble Ab0 = input.bypassArea();
     RealDouble Tc0 = input.coreExitTemp();
     AIM::Aerosol liquidAer, iceAer;
-    EPM::Integrate( temperature_K, pressure_Pa, relHumidity_w, VAR, FIX, \
+    EPM::Integrate( temperature_K, pressure_Pa, relHumidity_w, kpp.VAR, kpp.FIX, \
                     aerArray, aircraft, EI, Ice_rad, Ice_den, Soot_den,  \
                     H2O_mol, SO4g_mol, SO4l_mol, liquidAer, iceAer, areaPlume, \
                     Ab0, Tc0 );
@@ -708,6 +747,11 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                                        temperature_K, pressure_Pa );
     }
 
+    /* Largest settling speed, limits the transport sub-step [m/s] */
+    RealDouble vFallMax = 0.0E+00;
+    for ( UInt iBin_PA = 0; iBin_PA < Data.nBin_PA; iBin_PA++ )
+        vFallMax = std::max( vFallMax, std::abs( vFall[iBin_PA] ) );
+
 #ifdef RINGS
 
     /* ======================================================================= */
@@ -735,7 +779,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
 
     /* Compute Grid to Ring mapping */
     m.Ring2Mesh( ringCluster );
-    Vector_2Dui mapIndices = m.mapIndex();
+    Vector_2Dui ringCells = m.ringCells();
 
     /* Print ring to mesh mapping? */
     if ( DEBUG_MAPPING )
@@ -858,10 +902,10 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
 
         std::cout << "\n ## BACKG COND.:";
         std::cout << "\n ##\n";
-        std::cout << " ## - NOx  = " << std::setw(txtWidth) << ( VAR[ind_NO] + VAR[ind_NO2] ) / airDens * 1.0E+12 << " [ppt]\n";
-        std::cout << " ## - HNO3 = " << std::setw(txtWidth) << ( VAR[ind_HNO3] ) / airDens * 1.0E+12 << " [ppt]\n";
-        std::cout << " ## - O3   = " << std::setw(txtWidth) << ( VAR[ind_O3] )   / airDens * 1.0E+09 << " [ppb]\n";
-        std::cout << " ## - CO   = " << std::setw(txtWidth) << ( VAR[ind_CO] )   / airDens * 1.0E+09 << " [ppb]\n";
+        std::cout << " ## - NOx  = " << std::setw(txtWidth) << ( kpp.VAR[ind_NO] + kpp.VAR[ind_NO2] ) / airDens * 1.0E+12 << " [ppt]\n";
+        std::cout << " ## - HNO3 = " << std::setw(txtWidth) << ( kpp.VAR[ind_HNO3] ) / airDens * 1.0E+12 << " [ppt]\n";
+        std::cout << " ## - O3   = " << std::setw(txtWidth) << ( kpp.VAR[ind_O3] )   / airDens * 1.0E+09 << " [ppb]\n";
+        std::cout << " ## - CO   = " << std::setw(txtWidth) << ( kpp.VAR[ind_CO] )   / airDens * 1.0E+09 << " [ppb]\n";
         std::cout << " ##\n";
         std::cout << " ## - LA : " << std::setw(txtWidth+3) << Data.LA_nDens << " [#/cm^3], \n";
         std::cout << " ##        " << std::setw(txtWidth+3) << Data.LA_rEff  << " [nm], \n";
@@ -953,6 +997,34 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
     Stopwatch_cumul.Start( );
 
 #endif /* TIME_IT */
+
+    /* Number of grid cells visited and skipped by each process */
+    unsigned long nChemCells   = 0, nChemSkipped   = 0;
+    unsigned long nCoagCells   = 0, nCoagSkipped   = 0;
+    unsigned long nGrowthCells = 0, nGrowthSkipped = 0;
+
+    /* Thermal rate constants, tabulated once per meteorological state */
+    KppRateCache rateCache;
+
+    /* Rosenbrock steps and rejected steps over all rings and cells, and
+     * last accepted step size of the ambient chemistry. Cells and rings
+     * that have no step size yet start from stepStart */
+    unsigned long nChemSteps = 0, nChemRejected = 0;
+
+    /* Cells integrated by their cluster representative */
+    unsigned long nChemClustered = 0;
+
+    /* Cells handled by the reduced far-field chemistry, and largest
+     * relative error on the family rates of the checked ones */
+    unsigned long nChemReduced = 0;
+    RealDouble reducedErr = 0.0E+00;
+
+    /* Failed integrations of cells, rings and ambient, by the rung of
+     * INTEGRATE_FALLBACK that recovered them (0 if none did) */
+    unsigned long nChemFailed[4] = { 0, 0, 0, 0 };
+    int rung = 0;
+    RealDouble ambientStep = 0.0E+00;
+    const RealDouble stepStart = kpp.STEPMIN;
     
     //std::cout << curr_Time_s < tFinal_s << std::endl;
     while ( curr_Time_s < tFinal_s ) {
@@ -969,47 +1041,88 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
         
         /* ======================================================================= */
         /* ----------------------------------------------------------------------- */
-        /* --------------------------- UPDATE TIMESTEP --------------------------- */
+        /* ---------------------------- DOMAIN GROWTH ---------------------------- */
         /* ----------------------------------------------------------------------- */
         /* ======================================================================= */
 
-        /* Compute time step */
-        dt = timeArray[nTime+1] - timeArray[nTime];
-        LAST_STEP = ( curr_Time_s + dt >= tFinal_s );
-        Solver.UpdateTimeStep( dt );
- 
-        /* ======================================================================= */
-        /* ----------------------------------------------------------------------- */
-        /* ---------------------- UPDATE TRANSPORT PARAMETERS -------------------- */
-        /* ----------------------------------------------------------------------- */
-        /* ======================================================================= */
+        /* Grow the grid before the plume reaches its boundaries. The current
+         * grid is embedded as is in the grown one and new cells are set to
+         * far-field values, which conserves all quantities exactly. */
+        if ( GROW_DOMAIN ) {
 
-        /* Compute diffusion parameters */
-        /* Is transport turned on? */
-        if ( TRANSPORT ) {
+            bool edge[4] = { 0, 0, 0, 0 };
+            m.EdgeCheck( Data.Species[ind_H2Oplume], edge );
+            if ( TRANSPORT_PA )
+                m.EdgeCheck( Data.solidAerosol.TotalNumber(), edge );
 
-            /* Compute diffusion parameters at mid time step */
+            Mesh mGrown;
+            if ( ( edge[0] || edge[1] || edge[2] || edge[3] ) && m.Grow( edge, mGrown ) ) {
 
-            /* d_x: horizontal diffusion coefficient [m^2/s]
-             * d_y: vertical diffusion coefficient [m^2/s]
-             */
+                const UInt iOff = m.i0() - mGrown.i0();
+                const UInt jOff = m.j0() - mGrown.j0();
 
-            DiffParam( curr_Time_s - tInitial_s + dt/2.0, d_x, d_y, D_X, D_Y );
-        }
-        else {
+                std::cout << "\n Growing domain from " << m.Nx() << "x" << m.Ny();
+                std::cout << " to " << mGrown.Nx() << "x" << mGrown.Ny() << " cells" << std::endl;
+
+                m = mGrown;
 
-            /* If diffusion is turned off, set diffusion parameters to 0 */
+                xE = m.xE();
+                yE = m.yE();
+                cellAreas = m.areas();
 
-            d_x = 0.0;
-            d_y = 0.0;
+                if ( shear >= 0.0E+00 )
+                    LASTINDEX_SHEAR = m.Nx()-1;
+
+                /* Rebuild meteorology on the new grid, as it was at the
+                 * start of the simulation and after the last update */
+                Met = Meteorology( Met_Opt, tInitial_s / 3600.0, m,         \
+                                   Met_temperature_K, pressure_Pa,          \
+                                   Met_relHumidity_i, printDEBUG );
+                if ( TRANSPORT_PA )
+                    Met.Update( curr_Time_s / 3600.0, m, dTrav_x, dTrav_y );
+
+                Vector_1D ambient( ambientData.Species.size(), 0.0E+00 );
+                for ( UInt N = 0; N < ambient.size(); N++ )
+                    ambient[N] = ambientData.Species[N][nTime];
+
+                Data.Regrid( m.Nx(), m.Ny(), iOff, jOff, ambient, Met );
+
+                Solver.Regrid( m );
+
+#ifdef RINGS
+                ringCells = m.ringCells();
+#endif /* RINGS */
+
+            }
 
         }
-        
+
+        /* ======================================================================= */
+        /* ----------------------------------------------------------------------- */
+        /* --------------------------- UPDATE TIMESTEP --------------------------- */
+        /* ----------------------------------------------------------------------- */
+        /* ======================================================================= */
+
+        /* Compute time step */
+        dt = timeArray[nTime+1] - timeArray[nTime];
+        LAST_STEP = ( curr_Time_s + dt >= tFinal_s );
+
+        /* Split the macro step into transport sub-steps, so that ice
+         * crystals do not settle more than SETTLING_MAXDIST per sub-step.
+         * Propagators are cached for each distinct sub-step length. */
+        nSubStep = 1;
+        if ( TRANSPORT_PA && ( vFallMax > 0.0E+00 ) )
+            nSubStep = std::max( (UInt) std::ceil( dt * vFallMax / SETTLING_MAXDIST - 1.0E-06 ), (UInt) 1 );
+        dtSub = dt / nSubStep;
+        Solver.UpdateTimeStep( dtSub );
+
         /* Compute advection parameters */
         /* Is plume updraft on? */
         if ( UPDRAFT ) {
 
-            /* Compute global advection velocities at mid time step */
+            /* Compute global advection velocities at mid time step. They
+             * are not passed to the solver, the distances traveled move
+             * the met fields once per time step */
 
             /* vGlob_x > 0 means left, < 0 means right [m/s]
              * vGlob_y > 0 means upwards, < 0 means downwards [m/s]
@@ -1029,163 +1142,202 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
 
         }
 
-        /* Update diffusion and advection arrays */
-        Solver.UpdateDiff ( d_x, d_y );
-        /* Assume no plume advection */
-        Solver.UpdateAdv  ( 0.0E+00, 0.0E+00 );
-        /* Microphysics settling is considered for each bin independently */
-        /* Update shear */
-        Solver.UpdateShear( shear, m.y() );
-
-        /* ======================================================================= */
-        /* ----------------------------------------------------------------------- */
-        /* ------------------------------- RUN SANDS ----------------------------- */
-        /* ---------------- Spectral Advection aNd Diffusion Solver -------------- */
-        /* ----------------------------------------------------------------------- */
-        /* ======================================================================= */
-
 #ifdef TIME_IT
 
         Stopwatch.Start( reset );
 
 #endif /* TIME_IT */
 
-        if ( TRANSPORT ) {
+        for ( UInt iSub = 0; iSub < nSubStep; iSub++ ) {
 
-            if ( CHEMISTRY ) {
-                /* Advection and diffusion of gas phase species */
-                for ( N = 0; N < NVAR; N++ ) {
-                    if ( N == ind_H2O )
-                        Solver.Run( Data.Species[ind_H2Oplume], cellAreas, 1 );
-                    else
-                        Solver.Run( Data.Species[N], cellAreas );
-                }
-            } else {
-                /* Advection and diffusion of condensable species */
-                /* Advection and diffusion of plume affected H2O */
-                Solver.Run( Data.Species[ind_H2Oplume], cellAreas, -1 );
+            /* Start of the transport sub-step [s] */
+            tSub = curr_Time_s + iSub * dtSub;
 
-            }
+            /* ======================================================================= */
+            /* ----------------------------------------------------------------------- */
+            /* ---------------------- UPDATE TRANSPORT PARAMETERS -------------------- */
+            /* ----------------------------------------------------------------------- */
+            /* ======================================================================= */
 
-            /* Update H2O */
-            for ( jNy = 0; jNy < NY; jNy++ ) {
-                for ( iNx = 0; iNx < NX; iNx++ ) {
-                    Data.Species[ind_H2O][jNy][iNx] = Data.Species[ind_H2Omet][jNy][iNx] + Data.Species[ind_H2Oplume][jNy][iNx];
-                }
+            /* Compute diffusion parameters */
+            /* Is transport turned on? */
+            if ( TRANSPORT ) {
+
+                /* Compute diffusion parameters at mid sub-step */
+
+                /* d_x: horizontal diffusion coefficient [m^2/s]
+                 * d_y: vertical diffusion coefficient [m^2/s]
+                 */
+
+                DiffParam( tSub - tInitial_s + dtSub/2.0, d_x, d_y, D_X, D_Y );
             }
+            else {
+
+                /* If diffusion is turned off, set diffusion parameters to 0 */
+
+                d_x = 0.0;
+                d_y = 0.0;
 
-            /* Advection and diffusion for aerosol particles */
-            Solver.Run( Data.sootDens, cellAreas );
-            /* Monodisperse assumption for soot particles */
-            Solver.Run( Data.sootRadi, cellAreas );
-            Solver.Run( Data.sootArea, cellAreas );
-
-            /* We assume that sulfate aerosols do not settle */
-            if ( TRANSPORT_LA ) {
-                /* Transport of liquid aerosols */
-                for ( UInt iBin_LA = 0; iBin_LA < Data.nBin_LA; iBin_LA++ )
-                    Solver.Run( Data.liquidAerosol.pdf[iBin_LA], cellAreas );
             }
 
-            if ( TRANSPORT_PA ) {
-                /* Transport of solid aerosols */
+            /* Update diffusion and advection arrays */
+            Solver.UpdateDiff ( d_x, d_y );
+            /* Assume no plume advection */
+            Solver.UpdateAdv  ( 0.0E+00, 0.0E+00 );
+            /* Microphysics settling is considered for each bin independently */
+            /* Update shear */
+            Solver.UpdateShear( shear, m.y() );
 
-                /* Ice volume per bin (NBIN x NY x NX) in [m^3/cm^3 air] */
-                Vector_3D iceVolume = Data.solidAerosol.Volume();
+            /* ======================================================================= */
+            /* ----------------------------------------------------------------------- */
+            /* ------------------------------- RUN SANDS ----------------------------- */
+            /* ---------------- Spectral Advection aNd Diffusion Solver -------------- */
+            /* ----------------------------------------------------------------------- */
+            /* ======================================================================= */
 
-                for ( UInt iBin_PA = 0; iBin_PA < Data.nBin_PA; iBin_PA++ ) {
-                    /* Transport particle number and volume for each bin and
-                     * recompute centers of each bin for each grid cell
-                     * accordingly */
-                    Solver.UpdateAdv ( 0.0E+00, vFall[iBin_PA] );
+            if ( TRANSPORT ) {
+
+                if ( CHEMISTRY ) {
+                    /* Advection and diffusion of gas phase species. All species
+                     * but H2O share the same fill option and are transported
+                     * through batched transforms */
+                    std::vector<Field2D*> gasFields;
+                    gasFields.reserve( NVAR );
+                    for ( N = 0; N < NVAR; N++ ) {
+                        if ( N != ind_H2O )
+                            gasFields.push_back( &Data.Species[N] );
+                    }
+                    Solver.RunMany( gasFields, cellAreas, 0, SINGLE_SPECIES );
+                    Solver.Run( Data.Species[ind_H2Oplume], cellAreas, 1 );
+                } else {
+                    /* Advection and diffusion of condensable species */
+                    /* Advection and diffusion of plume affected H2O */
+                    Solver.Run( Data.Species[ind_H2Oplume], cellAreas, -1 );
 
-                    Solver.Run( Data.solidAerosol.pdf[iBin_PA], cellAreas, -1 );
-                    Solver.Run( iceVolume[iBin_PA], cellAreas, -1 );
+                }
 
+                /* Update H2O */
+                for ( jNy = 0; jNy < m.Ny(); jNy++ ) {
+                    for ( iNx = 0; iNx < m.Nx(); iNx++ ) {
+                        Data.Species[ind_H2O][jNy][iNx] = Data.Species[ind_H2Omet][jNy][iNx] + Data.Species[ind_H2Oplume][jNy][iNx];
+                    }
+                }
+
+                /* Advection and diffusion for aerosol particles */
+                /* Monodisperse assumption for soot particles */
+                std::vector<Field2D*> sootFields;
+                sootFields.push_back( &Data.sootDens );
+                sootFields.push_back( &Data.sootRadi );
+                sootFields.push_back( &Data.sootArea );
+                Solver.RunMany( sootFields, cellAreas, 0, SINGLE_AEROSOL );
+
+                /* We assume that sulfate aerosols do not settle */
+                if ( TRANSPORT_LA ) {
+                    /* Transport of liquid aerosols */
+                    Solver.RunMany( Data.liquidAerosol.pdf, cellAreas, 0, SINGLE_AEROSOL );
+                    Data.liquidAerosol.InvalidateMoments();
                 }
 
-                if ( FLUX_CORRECTION ) {
+                if ( TRANSPORT_PA ) {
+                    /* Transport of solid aerosols */
+
+                    for ( UInt iBin_PA = 0; iBin_PA < Data.nBin_PA; iBin_PA++ ) {
+                        /* Transport particle number and volume for each bin.
+                         * The volume (in [m^3/cm^3 air]) is carried in place
+                         * of the bin centers, which are recomputed as soon
+                         * as the bin has been transported */
+                        Solver.UpdateAdv ( 0.0E+00, vFall[iBin_PA] );
 
-                    /* Limit flux of ice particles through top boundary */
+                        Data.solidAerosol.CentersToVolume( iBin_PA );
+
+                        std::vector<Field2D*> iceFields;
+                        iceFields.push_back( &Data.solidAerosol.pdf[iBin_PA] );
+                        iceFields.push_back( &Data.solidAerosol.bin_VCenters[iBin_PA] );
+                        Solver.RunMany( iceFields, cellAreas, -1, SINGLE_AEROSOL );
+
+                        Data.solidAerosol.VolumeToCenters( iBin_PA );
+
+                    }
+
+                    if ( FLUX_CORRECTION ) {
+
+                        /* Limit flux of ice particles through top boundary */
 
 #pragma omp parallel for                        \
-                    if      ( !PARALLEL_CASES ) \
-                    default ( shared          ) \
-                    private ( iNx, jNy        ) \
-                    schedule( dynamic, 1      )
-                    for ( jNy = 0; jNy < NY; jNy++ ) {
-                        if ( ( yE[jNy] > YLIM_UP - 200.0 ) && ( yE[jNy] > 400.0 ) ) {
-                            for ( iNx = 0; iNx < NX; iNx++ ) {
-                                for ( UInt iBin_PA = 0; iBin_PA < Data.nBin_PA; iBin_PA++ ) {
-                                    Data.solidAerosol.pdf[iBin_PA][jNy][iNx] = 0.0E+00;
-                                    iceVolume[iBin_PA][jNy][iNx] = 0.0E+00;
+                        if      ( !PARALLEL_CASES ) \
+                        default ( shared          ) \
+                        private ( iNx, jNy        ) \
+                        schedule( dynamic, 1      )
+                        for ( jNy = 0; jNy < m.Ny(); jNy++ ) {
+                            if ( ( yE[jNy] > YLIM_UP - 200.0 ) && ( yE[jNy] > 400.0 ) ) {
+                                for ( iNx = 0; iNx < m.Nx(); iNx++ ) {
+                                    Data.solidAerosol.ClearCell( iNx, jNy );
+                                    Data.Species[ind_H2O][jNy][iNx] = Data.Species[ind_H2O][jNy][LASTINDEX_SHEAR];
                                 }
-                                Data.Species[ind_H2O][jNy][iNx] = Data.Species[ind_H2O][jNy][LASTINDEX_SHEAR];
                             }
                         }
-                    }
 
-                    /* Limit flux of ice particles through left and right boundary */
+                        /* Limit flux of ice particles through left and right boundary */
 
 #pragma omp parallel for                        \
-                    if      ( !PARALLEL_CASES ) \
-                    default ( shared          ) \
-                    private ( iNx, jNy        ) \
-                    schedule( dynamic, 1      )
-                    for ( iNx = 0; iNx < NX; iNx++ ) {
+                        if      ( !PARALLEL_CASES ) \
+                        default ( shared          ) \
+                        private ( iNx, jNy        ) \
+                        schedule( dynamic, 1      )
+                        for ( iNx = 0; iNx < m.Nx(); iNx++ ) {
 #ifndef XLIM
-                        if ( ( xE[iNx] < -XLIM_LEFT + 5.0E+03 ) || ( xE[iNx] > XLIM_RIGHT - 5.0E+03 ) ) {
+                            if ( ( xE[iNx] < -XLIM_LEFT + 5.0E+03 ) || ( xE[iNx] > XLIM_RIGHT - 5.0E+03 ) ) {
 #else
-                        if ( ( xE[iNx] < -XLIM + 5.0E+03 ) || ( xE[iNx] > XLIM - 5.0E+03 ) ) {
+                            if ( ( xE[iNx] < -XLIM + 5.0E+03 ) || ( xE[iNx] > XLIM - 5.0E+03 ) ) {
 #endif
-                            for ( jNy = 0; jNy < NY; jNy++ ) {
-                                for ( UInt iBin_PA = 0; iBin_PA < Data.nBin_PA; iBin_PA++ ) {
-                                    Data.solidAerosol.pdf[iBin_PA][jNy][iNx] = 0.0E+00;
-                                    iceVolume[iBin_PA][jNy][iNx] = 0.0E+00;
+                                for ( jNy = 0; jNy < m.Ny(); jNy++ ) {
+                                    Data.solidAerosol.ClearCell( iNx, jNy );
+                                    Data.Species[ind_H2O][jNy][iNx] = Data.Species[ind_H2O][m.Ny()-1][iNx];
                                 }
-                                Data.Species[ind_H2O][jNy][iNx] = Data.Species[ind_H2O][NY-1][iNx];
                             }
                         }
-                    }
 
-                } /* FLUX_CORRECTION */
+                        Data.solidAerosol.InvalidateMoments();
 
-                /* Update centers of each bin */
-                Data.solidAerosol.UpdateCenters( iceVolume, Data.solidAerosol.pdf );
+                    } /* FLUX_CORRECTION */
 
-            }
+                }
 
 #ifdef RINGS
 
-            /* If using rings and shear is non zero, then stretch rings to capture the
-             * asymmetric expansion of the plume */
-            if ( shear != 0.0E+00 ) {
+                /* If using rings and shear is non zero, then stretch rings to capture the
+                 * asymmetric expansion of the plume */
+                if ( shear != 0.0E+00 ) {
 
-                /* Rings do NOT get diffused, nor advected. They only get distorted
-                 * through shear */
+                    /* Rings do NOT get diffused, nor advected. They only get distorted
+                     * through shear */
 
-                /* Update diffusion and advection arrays */
-                Solver.UpdateDiff ( 0.0E+00, 0.0E+00 );
-                /* Assume no plume advection */
-                Solver.UpdateAdv  ( 0.0E+00, 0.0E+00 );
-                /* Update shear */
-                Solver.UpdateShear( shear, m.y() );
+                    /* Update diffusion and advection arrays */
+                    Solver.UpdateDiff ( 0.0E+00, 0.0E+00 );
+                    /* Assume no plume advection */
+                    Solver.UpdateAdv  ( 0.0E+00, 0.0E+00 );
+                    /* Update shear */
+                    Solver.UpdateShear( shear, m.y() );
 
-                /* Do not apply any filling option: -1 */
-                for ( iRing = 0; iRing < nRing + 1; iRing++ )
-                    Solver.Run( m.weights[iRing], cellAreas, -1 );
+                    /* Do not apply any filling option: -1 */
+                    Solver.RunMany( m.weights, cellAreas, -1, SINGLE_RINGS );
 
-                /* Recompute the map to mesh mapping, i.e. for each grid cell,
-                 * find the corresponding ring */
-                m.MapWeights();
+                    /* Recompute the map to mesh mapping, i.e. for each grid cell,
+                     * find the corresponding ring. Only needed once the
+                     * weights have been transported over the whole step */
+                    if ( iSub == nSubStep - 1 ) {
+                        m.MapWeights();
 
-                mapIndices = m.mapIndex();
+                        ringCells = m.ringCells();
+                    }
 
-            }
+                }
 
 #endif /* RINGS */
 
-        }
+            }
+
+        } /* Transport sub-steps */
 
 #ifdef TIME_IT
 
@@ -1206,8 +1358,8 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
             Met.Update( ( curr_Time_s + dt/2 ) / 3600.0, m, dTrav_x, dTrav_y );
 
             /* Update H2O */
-            for ( jNy = 0; jNy < NY; jNy++ ) {
-                for ( iNx = 0; iNx < NX; iNx++ ) {
+            for ( jNy = 0; jNy < m.Ny(); jNy++ ) {
+                for ( iNx = 0; iNx < m.Nx(); iNx++ ) {
                     Data.Species[ind_H2Omet][jNy][iNx] = Met.H2O(jNy,iNx);
                     Data.Species[ind_H2O][jNy][iNx] = Data.Species[ind_H2Omet][jNy][iNx] + Data.Species[ind_H2Oplume][jNy][iNx];
                 }
@@ -1246,7 +1398,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
         if ( printDEBUG ) {
             std::cout << "\n DEBUG : \n";
             for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                std::cout << "         PHOTOL[" << iPhotol << "] = " << PHOTOL[iPhotol] << "\n";
+                std::cout << "         PHOTOL[" << iPhotol << "] = " << jRate[iPhotol] << "\n";
         }
 
 
@@ -1277,10 +1429,10 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                 for ( iRing = 0; iRing < nRing; iRing++ ) {
 
                     /* Convert ring structure to KPP inputs (VAR and FIX) */
-                    ringData.getData( nTime + 1, iRing );
+                    ringData.getData( kpp, nTime + 1, iRing );
 
                     for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ )
-                        tempArray[iSpec] = VAR[iSpec];
+                        tempArray[iSpec] = kpp.VAR[iSpec];
 
                     /* ===================================================== */
                     /* ================= Chemical rates ==================== */
@@ -1290,19 +1442,19 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                     if ( HETCHEM ) {
 
                         for ( UInt iSpec = 0; iSpec < NSPEC; iSpec++ ) {
-                            HET[iSpec][0] = 0.0E+00;
-                            HET[iSpec][1] = 0.0E+00;
-                            HET[iSpec][2] = 0.0E+00;
+                            kpp.HET[iSpec][0] = 0.0E+00;
+                            kpp.HET[iSpec][1] = 0.0E+00;
+                            kpp.HET[iSpec][2] = 0.0E+00;
                         }
 
                         Data.getAerosolProp( AerosolRadi, AerosolArea, IWC,  \
                                              m.weights[iRing] );
 
-                        relHumidity = VAR[ind_H2O] * \
+                        relHumidity = kpp.VAR[ind_H2O] * \
                                       physConst::kB * temperature_K * 1.00E+06 / \
                                       physFunc::pSat_H2Ol( temperature_K );
-                        GC_SETHET( temperature_K, pressure_Pa, airDens, relHumidity, \
-                                   Data.STATE_PSC, VAR, AerosolArea, AerosolRadi, IWC, &(Data.KHETI_SLA[0]) );
+                        GC_SETHET( kpp, temperature_K, pressure_Pa, airDens, relHumidity, \
+                                   Data.STATE_PSC, AerosolArea, AerosolRadi, IWC, &(Data.KHETI_SLA[0]) );
 
                         if ( printDEBUG ) {
                             std::cout << "\n DEBUG :  Heterogeneous chemistry rates (Ring:  " << iRing << ")\n";
@@ -1315,36 +1467,36 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                             std::cout << "       :  Area strat. liq   = " << AerosolArea[1] * 1.0E+12 << " [mum^2/cm^3]\n";
                             std::cout << "       :  Area trop. sulf   = " << AerosolArea[2] * 1.0E+12 << " [mum^2/cm^3]\n";
                             std::cout << "       :  Area soot part.   = " << AerosolArea[3] * 1.0E+12 << " [mum^2/cm^3]\n";
-                            std::cout << "       :  HET[ind_HO2][0]   = " << HET[ind_HO2][0]          << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_NO2][0]   = " << HET[ind_NO2][0]          << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_NO3][0]   = " << HET[ind_NO3][0]          << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_N2O5][0]  = " << HET[ind_N2O5][0]         << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_BrNO3][0] = " << HET[ind_BrNO3][0]        << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_HOBr][0]  = " << HET[ind_HOBr][0]         << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_HBr][0]   = " << HET[ind_HBr][0]          << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_HOBr][1]  = " << HET[ind_HOBr][1]         << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_HO2][0]   = " << kpp.HET[ind_HO2][0]          << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_NO2][0]   = " << kpp.HET[ind_NO2][0]          << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_NO3][0]   = " << kpp.HET[ind_NO3][0]          << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_N2O5][0]  = " << kpp.HET[ind_N2O5][0]         << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_BrNO3][0] = " << kpp.HET[ind_BrNO3][0]        << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_HOBr][0]  = " << kpp.HET[ind_HOBr][0]         << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_HBr][0]   = " << kpp.HET[ind_HBr][0]          << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_HOBr][1]  = " << kpp.HET[ind_HOBr][1]         << " [molec/cm^3/s]\n";
                             std::cout << "       :  PSC Rates:\n";
-                            std::cout << "       :  HET[ind_N2O5][1]  = " << HET[ind_N2O5][1]         << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_ClNO3][0] = " << HET[ind_ClNO3][0]        << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_ClNO3][1] = " << HET[ind_ClNO3][1]        << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_ClNO3][2] = " << HET[ind_ClNO3][2]        << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_BrNO3][1] = " << HET[ind_BrNO3][1]        << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_HOCl][0]  = " << HET[ind_HOCl][0]         << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_HOCl][1]  = " << HET[ind_HOCl][1]         << " [molec/cm^3/s]\n";
-                            std::cout << "       :  HET[ind_HOBr][2]  = " << HET[ind_HOBr][2]         << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_N2O5][1]  = " << kpp.HET[ind_N2O5][1]         << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_ClNO3][0] = " << kpp.HET[ind_ClNO3][0]        << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_ClNO3][1] = " << kpp.HET[ind_ClNO3][1]        << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_ClNO3][2] = " << kpp.HET[ind_ClNO3][2]        << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_BrNO3][1] = " << kpp.HET[ind_BrNO3][1]        << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_HOCl][0]  = " << kpp.HET[ind_HOCl][0]         << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_HOCl][1]  = " << kpp.HET[ind_HOCl][1]         << " [molec/cm^3/s]\n";
+                            std::cout << "       :  HET[ind_HOBr][2]  = " << kpp.HET[ind_HOBr][2]         << " [molec/cm^3/s]\n";
                         }
                     }
 
                     /* Zero-out reaction rate */
                     for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-                        RCONST[iReact] = 0.0E+00;
+                        kpp.RCONST[iReact] = 0.0E+00;
 
                     /* Update photolysis rates */
                     for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                        PHOTOL[iPhotol] = jRate[iPhotol];
+                        kpp.PHOTOL[iPhotol] = jRate[iPhotol];
 
                     /* Update reaction rates */
-                    Update_RCONST( temperature_K, pressure_Pa, airDens, VAR[ind_H2O] );
+                    Update_RCONST( kpp, temperature_K, pressure_Pa, airDens, kpp.VAR[ind_H2O] );
 
                     if ( SAVE_PL ) {
 
@@ -1360,7 +1512,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                          * the input file "input.apcemm" */
 
                         /* Compute family rates */
-                        ComputeFamilies( VAR, FIX, RCONST, familyRate );
+                        ComputeFamilies( kpp.VAR, kpp.FIX, kpp.RCONST, familyRate );
 
                         for ( UInt iFam = 0; iFam < NFAM; iFam++ )
                             plumeRates[nTime][iRing][iFam] = familyRate[iFam];
@@ -1381,7 +1533,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                              * the input file "input.apcemm" */
 
                             /* Compute family rates */
-                            ComputeFamilies( VAR, FIX, RCONST, familyRate );
+                            ComputeFamilies( kpp.VAR, kpp.FIX, kpp.RCONST, familyRate );
 
                             for ( UInt iFam = 0; iFam < 2; iFam++ )
                                 plumeRates[nTime][iRing][iFam] = familyRate[iFam];
@@ -1393,8 +1545,22 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                     /* ============== Chemical integration ================= */
                     /* ===================================================== */
 
-                    IERR = INTEGRATE( VAR, curr_Time_s, curr_Time_s + dt, \
-                                      ATOL, RTOL, STEPMIN );
+                    /* Start from the last step size of the ring */
+                    kpp.STEPMIN = ( CHEM_WARM_START && ( ringData.chemStep[iRing] > 0.0E+00 ) ) ? \
+                                  ringData.chemStep[iRing] : stepStart;
+
+                    IERR = INTEGRATE( kpp, curr_Time_s, curr_Time_s + dt );
+
+                    if ( IERR < 0 ) {
+                        /* Start again from the ring before the step */
+                        IERR = INTEGRATE_FALLBACK( kpp, tempArray, curr_Time_s, \
+                                                   curr_Time_s + dt, &rung );
+                        nChemFailed[rung]++;
+                    }
+
+                    ringData.chemStep[iRing] = kpp.RPAR[11];
+                    nChemSteps    += kpp.IPAR[12];
+                    nChemRejected += kpp.IPAR[12] - kpp.IPAR[13];
 
                     if ( IERR < 0 ) {
                         /* Integration failed */
@@ -1408,11 +1574,11 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                         if ( printDEBUG ) {
                             std::cout << " ~~~ Printing reaction rates:\n";
                             for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                                std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
+                                std::cout << "Reaction " << iReact << ": " << kpp.RCONST[iReact] << " [molec/cm^3/s]\n";
                             }
                             std::cout << " ~~~ Printing concentrations:\n";
                             for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                                std::cout << "Species " << iSpec << ": " << VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
+                                std::cout << "Species " << iSpec << ": " << kpp.VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
                             }
                         }
 
@@ -1422,17 +1588,17 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                         return KPP_FAIL;
                     }
 
-                    ringData.FillIn( nTime + 1, iRing );
+                    ringData.FillIn( kpp, nTime + 1, iRing );
 
-                    Data.applyRing( tempArray, mapIndices, iRing );
+                    Data.applyRing( kpp, tempArray, ringCells[iRing] );
 
                 }
 
                 /* Ambient chemistry */
-                ambientData.getData( aerArray, nTime );
+                ambientData.getData( kpp, aerArray, nTime );
 
                 for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ )
-                    tempArray[iSpec] = VAR[iSpec];
+                    tempArray[iSpec] = kpp.VAR[iSpec];
 
                 /* ========================================================= */
                 /* =================== Chemical rates ====================== */
@@ -1442,16 +1608,16 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                 if ( HETCHEM ) {
 
                     for ( UInt iSpec = 0; iSpec < NSPEC; iSpec++ ) {
-                        HET[iSpec][0] = 0.0E+00;
-                        HET[iSpec][1] = 0.0E+00;
-                        HET[iSpec][2] = 0.0E+00;
+                        kpp.HET[iSpec][0] = 0.0E+00;
+                        kpp.HET[iSpec][1] = 0.0E+00;
+                        kpp.HET[iSpec][2] = 0.0E+00;
                     }
 
-                    relHumidity = VAR[ind_H2O] * \
+                    relHumidity = kpp.VAR[ind_H2O] * \
                                   physConst::kB * temperature_K * 1.00E+06 / \
                                   physFunc::pSat_H2Ol( temperature_K );
-                    GC_SETHET( temperature_K, pressure_Pa, airDens, relHumidity, \
-                               Data.STATE_PSC, VAR, AerosolArea, AerosolRadi, IWC, &(Data.KHETI_SLA[0]) );
+                    GC_SETHET( kpp, temperature_K, pressure_Pa, airDens, relHumidity, \
+                               Data.STATE_PSC, AerosolArea, AerosolRadi, IWC, &(Data.KHETI_SLA[0]) );
 
                     if ( printDEBUG ) {
                         std::cout << "\n DEBUG :   Heterogeneous chemistry rates (Ambient)\n";
@@ -1464,36 +1630,36 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                         std::cout << "       :   Area strat. liq   = " << AerosolArea[1] * 1.0E+12 << " [mum^2/cm^3]\n";
                         std::cout << "       :   Area trop. sulf   = " << AerosolArea[2] * 1.0E+12 << " [mum^2/cm^3]\n";
                         std::cout << "       :   Area soot part.   = " << AerosolArea[3] * 1.0E+12 << " [mum^2/cm^3]\n";
-                        std::cout << "       :   HET[ind_HO2][0]   = " << HET[ind_HO2][0]          << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_NO2][0]   = " << HET[ind_NO2][0]          << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_NO3][0]   = " << HET[ind_NO3][0]          << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_N2O5][0]  = " << HET[ind_N2O5][0]         << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_BrNO3][0] = " << HET[ind_BrNO3][0]        << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_HOBr][0]  = " << HET[ind_HOBr][0]         << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_HBr][0]   = " << HET[ind_HBr][0]          << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_HOBr][1]  = " << HET[ind_HOBr][1]         << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_HO2][0]   = " << kpp.HET[ind_HO2][0]          << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_NO2][0]   = " << kpp.HET[ind_NO2][0]          << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_NO3][0]   = " << kpp.HET[ind_NO3][0]          << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_N2O5][0]  = " << kpp.HET[ind_N2O5][0]         << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_BrNO3][0] = " << kpp.HET[ind_BrNO3][0]        << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_HOBr][0]  = " << kpp.HET[ind_HOBr][0]         << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_HBr][0]   = " << kpp.HET[ind_HBr][0]          << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_HOBr][1]  = " << kpp.HET[ind_HOBr][1]         << " [molec/cm^3/s]\n";
                         std::cout << "       :   PSC Rates:\n";
-                        std::cout << "       :   HET[ind_N2O5][1]  = " << HET[ind_N2O5][1]         << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_ClNO3][0] = " << HET[ind_ClNO3][0]        << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_ClNO3][1] = " << HET[ind_ClNO3][1]        << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_ClNO3][2] = " << HET[ind_ClNO3][2]        << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_BrNO3][1] = " << HET[ind_BrNO3][1]        << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_HOCl][0]  = " << HET[ind_HOCl][0]         << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_HOCl][1]  = " << HET[ind_HOCl][1]         << " [molec/cm^3/s]\n";
-                        std::cout << "       :   HET[ind_HOBr][2]  = " << HET[ind_HOBr][2]         << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_N2O5][1]  = " << kpp.HET[ind_N2O5][1]         << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_ClNO3][0] = " << kpp.HET[ind_ClNO3][0]        << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_ClNO3][1] = " << kpp.HET[ind_ClNO3][1]        << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_ClNO3][2] = " << kpp.HET[ind_ClNO3][2]        << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_BrNO3][1] = " << kpp.HET[ind_BrNO3][1]        << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_HOCl][0]  = " << kpp.HET[ind_HOCl][0]         << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_HOCl][1]  = " << kpp.HET[ind_HOCl][1]         << " [molec/cm^3/s]\n";
+                        std::cout << "       :   HET[ind_HOBr][2]  = " << kpp.HET[ind_HOBr][2]         << " [molec/cm^3/s]\n";
                     }
                 }
 
                 /* Zero-out reaction rate */
                 for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-                    RCONST[iReact] = 0.0E+00;
+                    kpp.RCONST[iReact] = 0.0E+00;
 
                 /* Update photolysis rates */
                 for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                    PHOTOL[iPhotol] = jRate[iPhotol];
+                    kpp.PHOTOL[iPhotol] = jRate[iPhotol];
 
                 /* Update reaction rates */
-                Update_RCONST( temperature_K, pressure_Pa, airDens, VAR[ind_H2O] );
+                Update_RCONST( kpp, temperature_K, pressure_Pa, airDens, kpp.VAR[ind_H2O] );
 
                 if ( SAVE_PL ) {
 
@@ -1509,7 +1675,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                      * the input file "input.apcemm" */
 
                     /* Compute family rates */
-                    ComputeFamilies( VAR, FIX, RCONST, familyRate );
+                    ComputeFamilies( kpp.VAR, kpp.FIX, kpp.RCONST, familyRate );
 
                     for ( UInt iFam = 0; iFam < NFAM; iFam++ )
                         ambientRates[nTime][iFam] = familyRate[iFam];
@@ -1530,7 +1696,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                          * the input file "input.apcemm" */
 
                         /* Compute family rates */
-                        ComputeFamilies( VAR, FIX, RCONST, familyRate );
+                        ComputeFamilies( kpp.VAR, kpp.FIX, kpp.RCONST, familyRate );
 
                         for ( UInt iFam = 0; iFam < 2; iFam++ )
                             ambientRates[nTime][iFam] = familyRate[iFam];
@@ -1542,8 +1708,19 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                 /* ================ Chemical integration =================== */
                 /* ========================================================= */
 
-                IERR = INTEGRATE( VAR, curr_Time_s, curr_Time_s + dt, \
-                                  ATOL, RTOL, STEPMIN );
+                kpp.STEPMIN = ( CHEM_WARM_START && ( ambientStep > 0.0E+00 ) ) ? \
+                              ambientStep : stepStart;
+
+                IERR = INTEGRATE( kpp, curr_Time_s, curr_Time_s + dt );
+
+                if ( IERR < 0 ) {
+                    /* Start again from the ambient before the step */
+                    IERR = INTEGRATE_FALLBACK( kpp, tempArray, curr_Time_s, \
+                                               curr_Time_s + dt, &rung );
+                    nChemFailed[rung]++;
+                }
+
+                ambientStep = kpp.RPAR[11];
 
                 if ( IERR < 0 ) {
                     /* Integration failed */
@@ -1557,11 +1734,11 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                     if ( printDEBUG ) {
                         std::cout << " ~~~ Printing reaction rates:\n";
                         for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                            std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
+                            std::cout << "Reaction " << iReact << ": " << kpp.RCONST[iReact] << " [molec/cm^3/s]\n";
                         }
                         std::cout << " ~~~ Printing concentrations:\n";
                         for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                            std::cout << "Species " << iSpec << ": " << VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
+                            std::cout << "Species " << iSpec << ": " << kpp.VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
                         }
                     }
 
@@ -1571,9 +1748,9 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                     return KPP_FAIL;
                 }
 
-                ambientData.FillIn( nTime + 1 );
+                ambientData.FillIn( kpp, nTime + 1 );
 
-                Data.applyRing( tempArray, mapIndices, iRing );
+                Data.applyRing( kpp, tempArray, ringCells[iRing] );
 
             }
 
@@ -1584,22 +1761,159 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
             /* Is chemistry turned on? */
             if ( CHEMISTRY ) {
 
-                Vector_2D iceVolume_ = Data.solidAerosol.TotalVolume();
+                /* Aerosol moments of all cells, for heterogeneous
+                 * chemistry. Filled here, before the parallel loop reads
+                 * them */
+                Data.solidAerosol.ComputeMoments();
+                Data.liquidAerosol.ComputeMoments();
+                const Field2D &iceM2   = Data.solidAerosol.CachedMoment( AIM::Grid_Aerosol::MOM_M2 );
+                const Field2D &iceM3   = Data.solidAerosol.CachedMoment( AIM::Grid_Aerosol::MOM_M3 );
+                const Field2D &iceRad  = Data.solidAerosol.CachedMoment( AIM::Grid_Aerosol::MOM_RMEAN );
+                const Field2D &liqM2   = Data.liquidAerosol.CachedMoment( AIM::Grid_Aerosol::MOM_M2 );
+                const Field2D &liqRad  = Data.liquidAerosol.CachedMoment( AIM::Grid_Aerosol::MOM_RMEAN );
+
+                /* Cells that do not depart from the ambient are not
+                 * integrated and receive the ambient solution instead.
+                 * Cells that depart from it by less than REDUCED_TOL are
+                 * far-field cells, advanced by the reduced chemistry
+                 * once the ambient has been integrated */
+                Vector_2Dui activeCells, fullCells;
+                const bool REDUCED = ( REDUCED_TOL > 0.0E+00 );
+                if ( SKIP_BACKG || REDUCED ) {
+                    Vector_1D ambientVAR( NVAR, 0.0E+00 );
+                    for ( UInt N = 0; N < NVAR; N++ )
+                        ambientVAR[N] = ambientData.Species[N][nTime];
+
+                    if ( SKIP_BACKG ) {
+                        const UInt nActive = Data.ActiveCells( ambientVAR, activeCells );
+                        nChemSkipped += m.Nx() * m.Ny() - nActive;
+                    }
+                    if ( REDUCED )
+                        Data.ActiveCells( ambientVAR, fullCells, REDUCED_TOL );
+                }
+                nChemCells += m.Nx() * m.Ny();
+
+                /* Cells are integrated in blocks of KPP_NBATCH, advanced
+                 * in lockstep by INTEGRATE_BATCH, so a block costs as much
+                 * as its most expensive lane. With CHEM_LOAD_BALANCE, the
+                 * cells are ordered by cost below so that a block holds
+                 * cells that took similar step counts. Otherwise they stay
+                 * in grid order, where neighbouring cells usually see
+                 * similar conditions. */
+                Vector_1Dui chemCells, farCells;
+                chemCells.reserve( m.Nx() * m.Ny() );
+                for ( jNy = 0; jNy < m.Ny(); jNy++ ) {
+                    for ( iNx = 0; iNx < m.Nx(); iNx++ ) {
+                        if ( SKIP_BACKG && !activeCells[jNy][iNx] )
+                            continue;
+                        if ( REDUCED && !fullCells[jNy][iNx] )
+                            farCells.push_back( jNy * m.Nx() + iNx );
+                        else
+                            chemCells.push_back( jNy * m.Nx() + iNx );
+                    }
+                }
+                nChemReduced += farCells.size();
+
+                /* Per-cell cost varies by orders of magnitude between the
+                 * plume core and its edges. Cells are sorted by decreasing
+                 * step count over the last chemistry step, so that each
+                 * block gathers lanes of similar cost and the dynamic
+                 * schedule ends on cheap blocks. Ties keep the grid order */
+                if ( CHEM_LOAD_BALANCE ) {
+                    std::vector<std::pair<RealDouble, UInt>> costOrder( chemCells.size() );
+                    for ( UInt iCell = 0; iCell < chemCells.size(); iCell++ ) {
+                        costOrder[iCell].first  = -Data.chemCost.data()[chemCells[iCell]];
+                        costOrder[iCell].second = chemCells[iCell];
+                    }
+                    std::sort( costOrder.begin(), costOrder.end() );
+                    for ( UInt iCell = 0; iCell < chemCells.size(); iCell++ )
+                        chemCells[iCell] = costOrder[iCell].second;
+                }
+
+                /* Near-identical cells are clustered and only the first
+                 * cell of each cluster is integrated. The other cells
+                 * receive its relative change */
+                Vector_1Dui clusterPtr, clusterCell;
+                const bool CLUSTER = ( CLUSTER_TOL > 0.0E+00 );
+                if ( CLUSTER ) {
+                    const UInt nCell    = chemCells.size();
+                    const UInt nCluster = Data.ClusterCells( chemCells, Met, CLUSTER_TOL, \
+                                                             HETCHEM, clusterPtr, clusterCell );
+                    for ( UInt iCluster = 0; iCluster < nCluster; iCluster++ )
+                        chemCells[iCluster] = clusterCell[clusterPtr[iCluster]];
+                    chemCells.resize( nCluster );
+                    nChemClustered += nCell - nCluster;
+
+                    std::cout << " -> Chemistry clusters: " << nCluster << " for " << nCell << " cells";
+                    if ( nCluster > 0 )
+                        std::cout << " (compression: " << nCell / RealDouble( nCluster ) << ")";
+                    std::cout << std::endl;
+                }
+
+                /* Most rate constants only depend on the local temperature,
+                 * pressure and air density, which take few distinct values
+                 * across the grid */
+                if ( rateCache.Size() > KPP_RATECACHE_MAX )
+                    rateCache.Clear();
+                Vector_1Dui rateEntry( chemCells.size() );
+                for ( UInt iCell = 0; iCell < chemCells.size(); iCell++ ) {
+                    iNx = chemCells[iCell] % m.Nx();
+                    jNy = chemCells[iCell] / m.Nx();
+                    rateEntry[iCell] = rateCache.Lookup( Met.temp(jNy,iNx), Met.press(jNy), \
+                                                         Met.airDens(jNy,iNx) );
+                }
+
+                const UInt nChemBlock = ( chemCells.size() + KPP_NBATCH - 1 ) / KPP_NBATCH;
+                UInt iBlock = 0;
+
+                /* Failed cells of this step, by recovering rung */
+                unsigned long stepFailed[4] = { 0, 0, 0, 0 };
+
+                /* Integration statistics of the grid cells, in the
+                 * KPP_NSTAT layout */
+                unsigned long stepStat[KPP_NSTAT] = { 0 };
 
 #pragma omp parallel for                             \
                 if       ( !PARALLEL_CASES         ) \
                 default ( shared                   ) \
-                private ( iNx, jNy                 ) \
+                private ( iBlock, iNx, jNy         ) \
                 private ( relHumidity, IWC         ) \
                 schedule( dynamic, 1               )
-                for ( iNx = 0; iNx < NX; iNx++ ) {
-                    for ( jNy = 0; jNy < NY; jNy++ ) {
+                for ( iBlock = 0; iBlock < nChemBlock; iBlock++ ) {
+
+                    const UInt iFirst = iBlock * KPP_NBATCH;
+                    const int nLane   = std::min( (int) KPP_NBATCH, \
+                                                  (int) ( chemCells.size() - iFirst ) );
+
+                    /* Lane-wise inputs, species-major */
+                    RealDouble VARB[NVAR*KPP_NBATCH];
+                    RealDouble FIXB[NFIX*KPP_NBATCH];
+                    RealDouble RCTB[NREACT*KPP_NBATCH];
+                    RealDouble HB[KPP_NBATCH];
+                    int IERRB[KPP_NBATCH], ISTATB[KPP_NSTAT*KPP_NBATCH];
+
+                    /* Inputs of the lanes, to retry failed ones and
+                     * scale cluster members */
+                    RealDouble VAR0B[NVAR*KPP_NBATCH];
+
+                    /* Chemistry context, filled in for each lane. Its
+                     * statistics only count the fallback integrations of
+                     * the block */
+                    KppContext cell( kpp );
+                    cell.ResetStats();
+
+                    for ( int iLane = 0; iLane < nLane; iLane++ ) {
+
+                        iNx = chemCells[iFirst+iLane] % m.Nx();
+                        jNy = chemCells[iFirst+iLane] / m.Nx();
 
                         RealDouble AerosolArea[NAERO];
                         RealDouble AerosolRadi[NAERO];
 
-                        /* Convert data structure to KPP inputs (VAR and FIX) */
-                        Data.getData( iNx, jNy );
+                        /* Convert data structure to KPP inputs (VAR and FIX).
+                         * This gathers NSPEC values from separate species
+                         * planes, once per cell and chemistry step */
+                        Data.getData( cell, iNx, jNy );
 
                         /* ================================================= */
                         /* =============== Chemical rates ================== */
@@ -1609,22 +1923,22 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                         if ( HETCHEM ) {
 
                             for ( UInt iSpec = 0; iSpec < NSPEC; iSpec++ ) {
-                                HET[iSpec][0] = 0.0E+00;
-                                HET[iSpec][1] = 0.0E+00;
-                                HET[iSpec][2] = 0.0E+00;
+                                cell.HET[iSpec][0] = 0.0E+00;
+                                cell.HET[iSpec][1] = 0.0E+00;
+                                cell.HET[iSpec][2] = 0.0E+00;
                             }
 
-                            relHumidity = VAR[ind_H2O] * \
+                            relHumidity = cell.VAR[ind_H2O] * \
                                           physConst::kB * Met.temp(jNy,iNx) * 1.00E+06 / \
                                           physFunc::pSat_H2Ol( Met.temp(jNy,iNx) );
 
                             /* Ice/NAT */
-                            AerosolArea[0] = Data.solidAerosol.Moment( 2, jNy, iNx );
-                            AerosolRadi[0] = std::max( std::min( Data.solidAerosol.Radius( jNy, iNx ), 1.00E-04 ), 1.00E-10 );
+                            AerosolArea[0] = iceM2[jNy][iNx];
+                            AerosolRadi[0] = std::max( std::min( iceRad[jNy][iNx], 1.00E-04 ), 1.00E-10 );
 
                             /* Stratospheric liquid aerosols */
-                            AerosolArea[1] = Data.liquidAerosol.Moment( 2, jNy, iNx );
-                            AerosolRadi[1] = std::max( std::min( Data.liquidAerosol.Radius( jNy, iNx ), 1.00E-06 ), 1.00E-10 );
+                            AerosolArea[1] = liqM2[jNy][iNx];
+                            AerosolRadi[1] = std::max( std::min( liqRad[jNy][iNx], 1.00E-06 ), 1.00E-10 );
 
                             /* Tropospheric aerosols.
                              * Zero it out */
@@ -1635,35 +1949,66 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                             AerosolArea[3] = Data.sootArea[jNy][iNx];
                             AerosolRadi[3] = std::max( std::min( Data.sootRadi[jNy][iNx], 1.00E-08 ), 1.00E-10 );
 
-                            IWC            = Data.solidAerosol.Moment( 3, jNy, iNx ) \
+                            IWC            = iceM3[jNy][iNx] \
                                            * physConst::RHO_ICE; /* [kg/cm^3] */
 
-                            GC_SETHET( Met.temp(jNy,iNx), Met.press(jNy), \
-                                       Met.airDens(jNy,iNx), relHumidity, \
-                                       Data.STATE_PSC, VAR, AerosolArea,  \
+                            GC_SETHET( cell, Met.temp(jNy,iNx), Met.press(jNy), \
+                                       Met.airDens(jNy,iNx), relHumidity,       \
+                                       Data.STATE_PSC, AerosolArea,             \
                                        AerosolRadi, IWC, &(Data.KHETI_SLA[0]) );
                         }
 
-                        /* Zero-out reaction rate */
-                        for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-                            RCONST[iReact] = 0.0E+00;
-
                         /* Update photolysis rates */
                         for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                            PHOTOL[iPhotol] = jRate[iPhotol];
+                            cell.PHOTOL[iPhotol] = jRate[iPhotol];
+
+                        /* Update reaction rates, from the tabulated
+                         * thermal rates */
+                        Update_RCONST( cell, rateCache.Rates( rateEntry[iFirst+iLane] ), \
+                                       Met.temp(jNy,iNx), Met.airDens(jNy,iNx),          \
+                                       cell.VAR[ind_H2O] );
+
+                        for ( UInt N = 0; N < NVAR; N++ )
+                            VARB[N*KPP_NBATCH+iLane] = cell.VAR[N];
+                        for ( UInt N = 0; N < NFIX; N++ )
+                            FIXB[N*KPP_NBATCH+iLane] = cell.FIX[N];
+                        for ( UInt iReact = 0; iReact < NREACT; iReact++ )
+                            RCTB[iReact*KPP_NBATCH+iLane] = cell.RCONST[iReact];
 
-                        /* Update reaction rates */
-                        Update_RCONST( Met.temp(jNy,iNx), Met.press(jNy), \
-                                       Met.airDens(jNy,iNx), VAR[ind_H2O] );
+                        /* Start from the last step size of the cell */
+                        HB[iLane] = CHEM_WARM_START ? Data.chemStep[jNy][iNx] : 0.0E+00;
 
-                        /* ================================================= */
-                        /* ============= Chemical integration ============== */
-                        /* ================================================= */
+                    }
+
+                    /* ===================================================== */
+                    /* =============== Chemical integration ================ */
+                    /* ===================================================== */
+
+                    std::copy( VARB, VARB + NVAR*KPP_NBATCH, VAR0B );
+
+                    INTEGRATE_BATCH( VARB, FIXB, RCTB, nLane,            \
+                                     curr_Time_s, curr_Time_s + dt,      \
+                                     kpp.ATOL, kpp.RTOL, stepStart,      \
+                                     kpp.THETAMIN, HB, IERRB, ISTATB );
+
+                    unsigned long blockStat[KPP_NSTAT] = { 0 };
+                    for ( UInt iStat = 0; iStat < KPP_NSTAT; iStat++ ) {
+                        for ( int iLane = 0; iLane < nLane; iLane++ )
+                            blockStat[iStat] += ISTATB[iStat*KPP_NBATCH+iLane];
+                    }
+
+                    for ( int iLane = 0; iLane < nLane; iLane++ ) {
+
+                        iNx = chemCells[iFirst+iLane] % m.Nx();
+                        jNy = chemCells[iFirst+iLane] / m.Nx();
 
-                        IERR = INTEGRATE( VAR, curr_Time_s, curr_Time_s + dt, \
-                                          ATOL, RTOL, STEPMIN );
+                        RealDouble VAR0[NVAR];
+                        for ( UInt N = 0; N < NVAR; N++ )
+                            VAR0[N] = VAR0B[N*KPP_NBATCH+iLane];
 
-                        if ( IERR < 0 ) {
+                        const bool failed = ( IERRB[iLane] < 0 );
+
+                        if ( failed ) {
                             /* Integration failed */
 
                             std::cout << "Integration failed";
@@ -1675,32 +2020,89 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                             if ( printDEBUG ) {
                                 std::cout << " ~~~ Printing reaction rates:\n";
                                 for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                                    std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
+                                    std::cout << "Reaction " << iReact << ": " << RCTB[iReact*KPP_NBATCH+iLane] << " [molec/cm^3/s]\n";
                                 }
                                 std::cout << " ~~~ Printing concentrations:\n";
                                 for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                                    std::cout << "Species " << iSpec << ": " << VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
+                                    std::cout << "Species " << iSpec << ": " << VARB[iSpec*KPP_NBATCH+iLane]/airDens*1.0E+09 << " [ppb]\n";
                                 }
                             }
 
-//                                /* Tweak would be to define a bool "stop", initialize to False and then set it as True if IERR < 0 */
-//                                { /* Clear dynamically allocated variable(s) */
-//                                    if ( sun != NULL ) sun->~SZA();
-//                                    return KPP_FAIL;
-//                                }
+                            /* Start again from the cell before the step */
+                            for ( UInt N = 0; N < NFIX; N++ )
+                                cell.FIX[N] = FIXB[N*KPP_NBATCH+iLane];
+                            for ( UInt iReact = 0; iReact < NREACT; iReact++ )
+                                cell.RCONST[iReact] = RCTB[iReact*KPP_NBATCH+iLane];
+
+                            int laneRung = 0;
+                            INTEGRATE_FALLBACK( cell, VAR0, curr_Time_s, curr_Time_s + dt, &laneRung );
+                            if ( laneRung == 0 )
+                                std::cout << " -> Not recovered, the cell keeps its state before the step\n";
+
+                            for ( UInt N = 0; N < NVAR; N++ )
+                                VARB[N*KPP_NBATCH+iLane] = cell.VAR[N];
+                            HB[iLane]     = laneRung ? cell.RPAR[11] : 0.0E+00;
+                            ISTATB[KPP_NSTP*KPP_NBATCH+iLane] += cell.IPAR[12];
+                            ISTATB[KPP_NACC*KPP_NBATCH+iLane] += cell.IPAR[13];
+
+                            #pragma omp atomic
+                            stepFailed[laneRung]++;
                         }
 
                         /* Convert KPP output back to data structure */
-                        Data.applyData( iNx, jNy );
+                        for ( UInt N = 0; N < NVAR; N++ )
+                            cell.VAR[N] = VARB[N*KPP_NBATCH+iLane];
+                        Data.applyData( cell, iNx, jNy );
+
+                        Data.chemStep[jNy][iNx]  = HB[iLane];
+                        Data.chemCost[jNy][iNx]  = ISTATB[KPP_NSTP*KPP_NBATCH+iLane];
+                        Data.chemFail[jNy][iNx] += failed;
+
+                        if ( CLUSTER ) {
+                            const UInt iBegin = clusterPtr[iFirst+iLane] + 1;
+                            const UInt iEnd   = clusterPtr[iFirst+iLane+1];
+
+                            Data.applyCluster( cell, VAR0, clusterCell, iBegin, iEnd );
+
+                            for ( UInt iCell = iBegin; iCell < iEnd; iCell++ ) {
+                                Data.chemStep.data()[clusterCell[iCell]]  = HB[iLane];
+                                Data.chemCost.data()[clusterCell[iCell]]  = ISTATB[KPP_NSTP*KPP_NBATCH+iLane];
+                                Data.chemFail.data()[clusterCell[iCell]] += failed;
+                            }
+                        }
+
+                        #pragma omp atomic
+                        nChemSteps    += ISTATB[KPP_NSTP*KPP_NBATCH+iLane];
+                        #pragma omp atomic
+                        nChemRejected += ISTATB[KPP_NSTP*KPP_NBATCH+iLane] \
+                                       - ISTATB[KPP_NACC*KPP_NBATCH+iLane];
+
+                    }
 
+                    /* Cost of the block: lanes and fallback integrations */
+                    unsigned long fallbackStat[KPP_NSTAT];
+                    cell.GetStats( fallbackStat );
+                    for ( UInt iStat = 0; iStat < KPP_NSTAT; iStat++ ) {
+                        #pragma omp atomic
+                        stepStat[iStat] += blockStat[iStat] + fallbackStat[iStat];
                     }
                 }
 
+                kpp.AddStats( stepStat );
+
+                if ( stepFailed[0] + stepFailed[1] + stepFailed[2] + stepFailed[3] > 0 ) {
+                    std::cout << " -> Chemistry failures: " << stepFailed[1] + stepFailed[2] + stepFailed[3] \
+                              << " recovered (" << stepFailed[1] << ", " << stepFailed[2] << ", "              \
+                              << stepFailed[3] << " by rung), " << stepFailed[0] << " not recovered" << std::endl;
+                }
+                for ( UInt iRung = 0; iRung < 4; iRung++ )
+                    nChemFailed[iRung] += stepFailed[iRung];
+
                 RealDouble AerosolArea[NAERO];
                 RealDouble AerosolRadi[NAERO];
 
                 /* Ambient chemistry */
-                ambientData.getData( aerArray, nTime );
+                ambientData.getData( kpp, aerArray, nTime );
 
                 /* ========================================================= */
                 /* ==================== Chemical rates ===================== */
@@ -1710,35 +2112,50 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                 if ( HETCHEM ) {
 
                     for ( UInt iSpec = 0; iSpec < NSPEC; iSpec++ ) {
-                        HET[iSpec][0] = 0.0E+00;
-                        HET[iSpec][1] = 0.0E+00;
-                        HET[iSpec][2] = 0.0E+00;
+                        kpp.HET[iSpec][0] = 0.0E+00;
+                        kpp.HET[iSpec][1] = 0.0E+00;
+                        kpp.HET[iSpec][2] = 0.0E+00;
                     }
 
-                    relHumidity = VAR[ind_H2O] * \
+                    relHumidity = kpp.VAR[ind_H2O] * \
                                   physConst::kB * temperature_K * 1.00E+06 / \
                                   physFunc::pSat_H2Ol( temperature_K );
-                    GC_SETHET( temperature_K, pressure_Pa, airDens, relHumidity, \
-                               Data.STATE_PSC, VAR, AerosolArea, AerosolRadi, IWC, &(Data.KHETI_SLA[0]) );
+                    GC_SETHET( kpp, temperature_K, pressure_Pa, airDens, relHumidity, \
+                               Data.STATE_PSC, AerosolArea, AerosolRadi, IWC, &(Data.KHETI_SLA[0]) );
                 }
 
                 /* Zero-out reaction rate */
                 for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-                    RCONST[iReact] = 0.0E+00;
+                    kpp.RCONST[iReact] = 0.0E+00;
 
                 /* Update photolysis rates */
                 for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                    PHOTOL[iPhotol] = jRate[iPhotol];
+                    kpp.PHOTOL[iPhotol] = jRate[iPhotol];
 
                 /* Update reaction rates */
-                Update_RCONST( temperature_K, pressure_Pa, airDens, VAR[ind_H2O] );
+                Update_RCONST( kpp, temperature_K, pressure_Pa, airDens, kpp.VAR[ind_H2O] );
 
                 /* ========================================================= */
                 /* ================= Chemical integration ================== */
                 /* ========================================================= */
 
-                IERR = INTEGRATE( VAR, curr_Time_s, curr_Time_s + dt, \
-                                  ATOL, RTOL, STEPMIN );
+                RealDouble ambientVAR0[NVAR];
+                for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ )
+                    ambientVAR0[iSpec] = kpp.VAR[iSpec];
+
+                kpp.STEPMIN = ( CHEM_WARM_START && ( ambientStep > 0.0E+00 ) ) ? \
+                              ambientStep : stepStart;
+
+                IERR = INTEGRATE( kpp, curr_Time_s, curr_Time_s + dt );
+
+                if ( IERR < 0 ) {
+                    /* Start again from the ambient before the step */
+                    IERR = INTEGRATE_FALLBACK( kpp, ambientVAR0, curr_Time_s, \
+                                               curr_Time_s + dt, &rung );
+                    nChemFailed[rung]++;
+                }
+
+                ambientStep = kpp.RPAR[11];
 
                 if ( IERR < 0 ) {
                     /* Integration failed */
@@ -1752,11 +2169,11 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                     if ( printDEBUG ) {
                         std::cout << " ~~~ Printing reaction rates:\n";
                         for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                            std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
+                            std::cout << "Reaction " << iReact << ": " << kpp.RCONST[iReact] << " [molec/cm^3/s]\n";
                         }
                         std::cout << " ~~~ Printing concentrations:\n";
                         for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                            std::cout << "Species " << iSpec << ": " << VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
+                            std::cout << "Species " << iSpec << ": " << kpp.VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
                         }
                     }
 
@@ -1766,7 +2183,95 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                     return KPP_FAIL;
                 }
 
-                ambientData.FillIn( nTime + 1 );
+                ambientData.FillIn( kpp, nTime + 1 );
+
+                if ( SKIP_BACKG ) {
+                    Vector_1D ambientVAR( NVAR, 0.0E+00 );
+                    for ( UInt N = 0; N < NVAR; N++ )
+                        ambientVAR[N] = ambientData.Species[N][nTime+1];
+
+                    Data.applyBackground( ambientVAR, activeCells );
+                }
+
+                /* Far-field cells: departure from the ambient advanced
+                 * with the ambient Jacobian, radicals in quasi-steady
+                 * state. A few of them are also integrated with the full
+                 * mechanism and compared on the family rates */
+                if ( farCells.size() > 0 ) {
+
+                    KppContext farAmb( kpp );
+                    for ( UInt N = 0; N < NVAR; N++ )
+                        farAmb.VAR[N] = ambientVAR0[N];
+
+                    RealDouble JVS[LU_NONZERO];
+                    if ( REDUCED_PREPARE( farAmb, dt, JVS ) != 0 )
+                        std::cout << " -> Reduced chemistry: singular matrix, far-field cells keep their departure from the ambient" << std::endl;
+
+                    const UInt nFar   = farCells.size();
+                    const UInt stride = std::max( nFar / REDUCED_NCHECK, (UInt) 1 );
+                    RealDouble stepErr = 0.0E+00;
+                    UInt iFar = 0;
+
+                    /* Failed check integrations, by recovering rung */
+                    unsigned long checkFailed[4] = { 0, 0, 0, 0 };
+
+#pragma omp parallel for                 \
+    if       ( !PARALLEL_CASES         ) \
+    default  ( shared                  ) \
+    private  ( iFar                    ) \
+    reduction( max:stepErr             ) \
+    schedule ( static                  )
+                    for ( iFar = 0; iFar < nFar; iFar++ ) {
+
+                        const UInt iCell = farCells[iFar] % m.Nx();
+                        const UInt jCell = farCells[iFar] / m.Nx();
+
+                        KppContext cell( farAmb );
+                        Data.getData( cell, iCell, jCell );
+
+                        KppContext full( cell );
+                        bool check = ( iFar % stride == 0 ) && ( iFar / stride < REDUCED_NCHECK );
+                        if ( check && ( INTEGRATE( full, curr_Time_s, curr_Time_s + dt ) < 0 ) ) {
+                            /* Start again from the cell before the step. A
+                             * sample that cannot be recovered is skipped */
+                            int checkRung = 0;
+                            INTEGRATE_FALLBACK( full, cell.VAR, curr_Time_s, \
+                                                curr_Time_s + dt, &checkRung );
+                            check = ( checkRung > 0 );
+
+                            #pragma omp atomic
+                            checkFailed[checkRung]++;
+                        }
+
+                        REDUCED_ADVANCE( cell, JVS, ambientVAR0, kpp.VAR );
+                        Data.applyData( cell, iCell, jCell );
+
+                        if ( check ) {
+                            RealDouble famRed[NFAM], famFull[NFAM];
+                            ComputeFamilies( cell.VAR, cell.FIX, cell.RCONST, famRed  );
+                            ComputeFamilies( full.VAR, full.FIX, full.RCONST, famFull );
+
+                            RealDouble famMax = 0.0E+00;
+                            for ( UInt iFam = 0; iFam < NFAM; iFam++ )
+                                famMax = std::max( famMax, std::abs( famFull[iFam] ) );
+                            for ( UInt iFam = 0; iFam < NFAM; iFam++ )
+                                stepErr = std::max( stepErr, std::abs( famRed[iFam] - famFull[iFam] ) \
+                                                           / ( std::abs( famFull[iFam] ) + 1.0E-03 * famMax ) );
+                        }
+
+                    }
+
+                    reducedErr = std::max( reducedErr, stepErr );
+                    std::cout << " -> Reduced chemistry: " << nFar << " far-field cells, family rate error: " << stepErr << std::endl;
+
+                    if ( checkFailed[0] + checkFailed[1] + checkFailed[2] + checkFailed[3] > 0 ) {
+                        std::cout << " -> Reduced chemistry check failures: " << checkFailed[1] + checkFailed[2] + checkFailed[3] \
+                                  << " recovered, " << checkFailed[0] << " not recovered and skipped" << std::endl;
+                    }
+                    for ( UInt iRung = 0; iRung < 4; iRung++ )
+                        nChemFailed[iRung] += checkFailed[iRung];
+
+                }
             }
 
         #endif /* RINGS */
@@ -1794,7 +2299,8 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
 
             lastTimeLiqCoag = curr_Time_s + dt;
             /* If shear = 0, take advantage of the symmetry around the Y-axis */
-            Data.liquidAerosol.Coagulate( dtLiqCoag, Data.LA_Kernel, LA_MICROPHYSICS, ( shear == 0.0E+00 ) && ( XLIM_LEFT == XLIM_RIGHT ) );
+            nCoagSkipped += Data.liquidAerosol.Coagulate( dtLiqCoag, Data.LA_Kernel, LA_MICROPHYSICS, ( shear == 0.0E+00 ) && ( XLIM_LEFT == XLIM_RIGHT ) );
+            nCoagCells   += m.Nx() * m.Ny();
         }
 
         ITS_TIME_FOR_ICE_COAGULATION = ( ( ( curr_Time_s + dt - lastTimeIceCoag ) >= COAG_DT * 60.0 ) || LAST_STEP );
@@ -1806,7 +2312,8 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
 
             lastTimeIceCoag = curr_Time_s + dt;
             /* If shear = 0, take advantage of the symmetry around the Y-axis */
-            Data.solidAerosol.Coagulate ( dtIceCoag, Data.PA_Kernel, PA_MICROPHYSICS, ( shear == 0.0E+00 ) && ( XLIM_LEFT == XLIM_RIGHT ) );
+            nCoagSkipped += Data.solidAerosol.Coagulate ( dtIceCoag, Data.PA_Kernel, PA_MICROPHYSICS, ( shear == 0.0E+00 ) && ( XLIM_LEFT == XLIM_RIGHT ) );
+            nCoagCells   += m.Nx() * m.Ny();
         }
 
         /* ======================================================================= */
@@ -1825,8 +2332,14 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                 std::cout << "\n DEBUG (Solid Aerosol Growth): Current time: " << ( curr_Time_s - tInitial_s ) / 3600.0 << " hr. Last growth event was at: " << ( lastTimeIceGrowth - tInitial_s ) / 3600.0 << " hr. Running for " << dtIceGrowth << " s\n";
 
             lastTimeIceGrowth = curr_Time_s + dt;
-            /* If shear = 0, take advantage of the symmetry around the Y-axis */
-            Data.solidAerosol.Grow( dtIceGrowth, Data.Species[ind_H2O], Met.Temp(), Met.Press(), PA_MICROPHYSICS, ( shear == 0.0E+00 ) && ( XLIM_LEFT == XLIM_RIGHT ) );
+            /* Stretched night-time steps are split so that growth never
+             * runs over more than the dynamic time step at once */
+            const UInt nGrowth = std::max( (UInt) std::ceil( dtIceGrowth / DYN_DT - 1.0E-06 ), (UInt) 1 );
+            for ( UInt iGrowth = 0; iGrowth < nGrowth; iGrowth++ ) {
+                /* If shear = 0, take advantage of the symmetry around the Y-axis */
+                nGrowthSkipped += Data.solidAerosol.Grow( dtIceGrowth / nGrowth, Data.Species[ind_H2O], Met.Temp(), Met.Press(), PA_MICROPHYSICS, ( shear == 0.0E+00 ) && ( XLIM_LEFT == XLIM_RIGHT ) );
+                nGrowthCells   += m.Nx() * m.Ny();
+            }
         }
 
         /* ======================================================================= */
@@ -1858,8 +2371,8 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
         reduction( +:mass_Emitted_NOy ) \
         schedule ( dynamic, 1         ) \
         if       ( !PARALLEL_CASES    )
-        for ( iNx = 0; iNx < NX; iNx++ ) {
-            for ( jNy = 0; jNy < NY; jNy++ ) {
+        for ( iNx = 0; iNx < m.Nx(); iNx++ ) {
+            for ( jNy = 0; jNy < m.Ny(); jNy++ ) {
                 mass_Emitted_NOy += ( Data.Species[ind_NO][jNy][iNx]     + Data.Species[ind_NO2][jNy][iNx]   \
                                     + Data.Species[ind_NO3][jNy][iNx]    + Data.Species[ind_HNO2][jNy][iNx]  \
                                     + Data.Species[ind_HNO3][jNy][iNx]   + Data.Species[ind_HNO4][jNy][iNx]  \
@@ -1930,8 +2443,8 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
         reduction( +:mass_Emitted_CO2 ) \
         schedule ( dynamic, 1         ) \
         if       ( !PARALLEL_CASES    )
-        for ( iNx = 0; iNx < NX; iNx++ ) {
-            for ( jNy = 0; jNy < NY; jNy++ ) {
+        for ( iNx = 0; iNx < m.Nx(); iNx++ ) {
+            for ( jNy = 0; jNy < m.Ny(); jNy++ ) {
                 mass_Emitted_CO2 += ( Data.Species[ind_CO2][jNy][iNx] \
                                     - mass_Ambient_CO2 ) * cellAreas[jNy][iNx];
             }
@@ -1970,8 +2483,8 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
         reduction( +:mass_H2O      ) \
         schedule ( dynamic, 1      ) \
         if       ( !PARALLEL_CASES )
-        for ( iNx = 0; iNx < NX; iNx++ ) {
-            for ( jNy = 0; jNy < NY; jNy++ ) {
+        for ( iNx = 0; iNx < m.Nx(); iNx++ ) {
+            for ( jNy = 0; jNy < m.Ny(); jNy++ ) {
                 mass_H2O += ( ( Data.Species[ind_H2O][jNy][iNx] - mass_Ambient_H2O ) \
                             + totIceVol[jNy][iNx] * UNITCONVERSION ) * \
                             cellAreas[jNy][iNx];
@@ -2070,6 +2583,54 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
 
 #endif /* TIME_IT */
 
+    std::cout << "\n";
+    std::cout << " ** Skipped background work: " << "\n";
+    std::cout << " ** -> Transport  : " << Solver.nFieldsSkipped() << " out of " << Solver.nFieldsRun() + Solver.nFieldsSkipped() << " fields\n";
+    std::cout << " ** -> Chemistry  : " << nChemSkipped   << " out of " << nChemCells   << " cells\n";
+    std::cout << " ** -> Coagulation: " << nCoagSkipped   << " out of " << nCoagCells   << " cells\n";
+    std::cout << " ** -> Ice growth : " << nGrowthSkipped << " out of " << nGrowthCells << " cells\n";
+    std::cout << std::endl;
+
+    if ( REDUCED_TOL > 0.0E+00 ) {
+        std::cout << " ** Reduced far-field chemistry (tol = " << REDUCED_TOL << "): " << "\n";
+        std::cout << " ** -> Reduced    : " << nChemReduced << " out of " << nChemCells - nChemSkipped << " cells\n";
+        std::cout << " ** -> Max. error : " << reducedErr   << " (relative, on family rates)\n";
+        std::cout << std::endl;
+    }
+
+    if ( CLUSTER_TOL > 0.0E+00 ) {
+        std::cout << " ** Cell clustering (tol = " << CLUSTER_TOL << "): " << "\n";
+        std::cout << " ** -> Integrated : " << nChemCells - nChemSkipped - nChemReduced - nChemClustered << " out of " << nChemCells - nChemSkipped - nChemReduced << " cells\n";
+        std::cout << std::endl;
+    }
+
+    std::cout << " ** Rate constant cache: " << "\n";
+    std::cout << " ** -> Hits       : " << rateCache.Hits()   << " out of " << rateCache.Hits() + rateCache.Misses() << " cells\n";
+    std::cout << " ** -> Tabulated  : " << rateCache.Misses() << " states\n";
+    std::cout << std::endl;
+
+    const unsigned long nCoagNominal = Data.LA_Kernel.MapNominal() + Data.PA_Kernel.MapNominal();
+    const unsigned long nCoagMapHit  = Data.LA_Kernel.MapHits()    + Data.PA_Kernel.MapHits();
+    const unsigned long nCoagMapMiss = Data.LA_Kernel.MapMisses()  + Data.PA_Kernel.MapMisses();
+    std::cout << " ** Coagulation mappings (tol = " << COAG_MAP_TOL << "): " << "\n";
+    std::cout << " ** -> Nominal    : " << nCoagNominal << " out of " << nCoagNominal + nCoagMapHit + nCoagMapMiss << " cells\n";
+    std::cout << " ** -> Cached     : " << nCoagMapHit  << " out of " << nCoagMapHit + nCoagMapMiss << " other cells\n";
+    std::cout << " ** -> Built      : " << nCoagMapMiss << " mappings\n";
+    std::cout << std::endl;
+
+    std::cout << " ** Chemistry failures: " << "\n";
+    std::cout << " ** -> Retried    : " << nChemFailed[1] << " from a small step, " << nChemFailed[2] << " with Ros2, " << nChemFailed[3] << " sub-cycled\n";
+    std::cout << " ** -> Unrecovered: " << nChemFailed[0] << "\n";
+    std::cout << std::endl;
+
+    std::cout << " ** Chemistry steps (" << ( CHEM_WARM_START ? "warm" : "cold" ) << " start): " << "\n";
+    std::cout << " ** -> Steps      : " << nChemSteps    << "\n";
+    std::cout << " ** -> Rejected   : " << nChemRejected << "\n";
+    std::cout << std::endl;
+
+    /* Ring, ambient and grid integrations */
+    kpp.PrintCost();
+
 
 #ifdef RINGS
 
@@ -2166,13 +2727,17 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
             return KPPADJ_FAIL;
         }
 
+        /* Chemistry context for the forward integration */
+        KppContext adj;
+        adj.SetTolerances( KPPADJ_RTOLS, KPPADJ_ATOLS, 0.0E+00 );
+
         /* Apply optimized initial conditions to concentration array */
         for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ )
-            VAR[iSpec] = VAR_OPT[iSpec];
+            adj.VAR[iSpec] = VAR_OPT[iSpec];
 
         /* Create ambient struture */
         Ambient adjointData( timeArray.size(), Data.getAmbient(), Data.getAerosol(), Data.getLiqSpecies() );
-        adjointData.FillIn( 0 );
+        adjointData.FillIn( adj, 0 );
 
 
         /* Perform forward integration with optimized initial conditions */
@@ -2188,11 +2753,6 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
 
         /* ---- TOLERANCES ---------------------- */
 
-        for( UInt i = 0; i < NVAR; i++ ) {
-            RTOL[i] = KPPADJ_RTOLS;
-            ATOL[i] = KPPADJ_ATOLS;
-        }
-
         /* Tolerances for calculating adjoints are
          * used for controlling adjoint truncation
          * error and for solving the linear adjoint
@@ -2287,7 +2847,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
             if ( printDEBUG ) {
                 std::cout << "\n DEBUG : \n";
                 for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                    std::cout << "         PHOTOL[" << iPhotol << "] = " << PHOTOL[iPhotol] << "\n";
+                    std::cout << "         PHOTOL[" << iPhotol << "] = " << jRate[iPhotol] << "\n";
             }
 
             /* ============================================================= */
@@ -2299,7 +2859,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
 
 
             /* Ambient chemistry */
-            adjointData.getData( aerArray, nTime );
+            adjointData.getData( adj, aerArray, nTime );
 
             /* ============================================================= */
             /* ====================== Chemical rates ======================= */
@@ -2309,16 +2869,16 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
             if ( HETCHEM ) {
 
                 for ( UInt iSpec = 0; iSpec < NSPEC; iSpec++ ) {
-                    HET[iSpec][0] = 0.0E+00;
-                    HET[iSpec][1] = 0.0E+00;
-                    HET[iSpec][2] = 0.0E+00;
+                    adj.HET[iSpec][0] = 0.0E+00;
+                    adj.HET[iSpec][1] = 0.0E+00;
+                    adj.HET[iSpec][2] = 0.0E+00;
                 }
 
-                relHumidity = VAR[ind_H2O] * \
+                relHumidity = adj.VAR[ind_H2O] * \
                               physConst::kB * temperature_K * 1.00E+06 / \
                               physFunc::pSat_H2Ol( temperature_K );
-                GC_SETHET( temperature_K, pressure_Pa, airDens, relHumidity, \
-                           Data.STATE_PSC, VAR, AerosolArea, AerosolRadi, IWC, &(Data.KHETI_SLA[0]) );
+                GC_SETHET( adj, temperature_K, pressure_Pa, airDens, relHumidity, \
+                           Data.STATE_PSC, AerosolArea, AerosolRadi, IWC, &(Data.KHETI_SLA[0]) );
 
                 if ( printDEBUG ) {
                     std::cout << "\n DEBUG :   Heterogeneous chemistry rates (Ambient)\n";
@@ -2331,42 +2891,49 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                     std::cout << "       :   Area strat. liq   = " << AerosolArea[1] * 1.0E+12 << " [mum^2/cm^3]\n";
                     std::cout << "       :   Area trop. sulf   = " << AerosolArea[2] * 1.0E+12 << " [mum^2/cm^3]\n";
                     std::cout << "       :   Area soot part.   = " << AerosolArea[3] * 1.0E+12 << " [mum^2/cm^3]\n";
-                    std::cout << "       :   HET[ind_HO2][0]   = " << HET[ind_HO2][0]          << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_NO2][0]   = " << HET[ind_NO2][0]          << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_NO3][0]   = " << HET[ind_NO3][0]          << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_N2O5][0]  = " << HET[ind_N2O5][0]         << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_BrNO3][0] = " << HET[ind_BrNO3][0]        << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_HOBr][0]  = " << HET[ind_HOBr][0]         << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_HBr][0]   = " << HET[ind_HBr][0]          << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_HOBr][1]  = " << HET[ind_HOBr][1]         << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_HO2][0]   = " << adj.HET[ind_HO2][0]          << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_NO2][0]   = " << adj.HET[ind_NO2][0]          << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_NO3][0]   = " << adj.HET[ind_NO3][0]          << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_N2O5][0]  = " << adj.HET[ind_N2O5][0]         << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_BrNO3][0] = " << adj.HET[ind_BrNO3][0]        << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_HOBr][0]  = " << adj.HET[ind_HOBr][0]         << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_HBr][0]   = " << adj.HET[ind_HBr][0]          << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_HOBr][1]  = " << adj.HET[ind_HOBr][1]         << " [molec/cm^3/s]\n";
                     std::cout << "       :   PSC Rates:\n";
-                    std::cout << "       :   HET[ind_N2O5][1]  = " << HET[ind_N2O5][1]         << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_ClNO3][0] = " << HET[ind_ClNO3][0]        << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_ClNO3][1] = " << HET[ind_ClNO3][1]        << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_ClNO3][2] = " << HET[ind_ClNO3][2]        << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_BrNO3][1] = " << HET[ind_BrNO3][1]        << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_HOCl][0]  = " << HET[ind_HOCl][0]         << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_HOCl][1]  = " << HET[ind_HOCl][1]         << " [molec/cm^3/s]\n";
-                    std::cout << "       :   HET[ind_HOBr][2]  = " << HET[ind_HOBr][2]         << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_N2O5][1]  = " << adj.HET[ind_N2O5][1]         << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_ClNO3][0] = " << adj.HET[ind_ClNO3][0]        << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_ClNO3][1] = " << adj.HET[ind_ClNO3][1]        << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_ClNO3][2] = " << adj.HET[ind_ClNO3][2]        << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_BrNO3][1] = " << adj.HET[ind_BrNO3][1]        << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_HOCl][0]  = " << adj.HET[ind_HOCl][0]         << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_HOCl][1]  = " << adj.HET[ind_HOCl][1]         << " [molec/cm^3/s]\n";
+                    std::cout << "       :   HET[ind_HOBr][2]  = " << adj.HET[ind_HOBr][2]         << " [molec/cm^3/s]\n";
                 }
             }
 
             /* Zero-out reaction rate */
             for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-                RCONST[iReact] = 0.0E+00;
+                adj.RCONST[iReact] = 0.0E+00;
 
             /* Update photolysis rates */
             for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                PHOTOL[iPhotol] = jRate[iPhotol];
+                adj.PHOTOL[iPhotol] = jRate[iPhotol];
 
             /* Update reaction rates */
-            Update_RCONST( temperature_K, pressure_Pa, airDens, VAR[ind_H2O] );
+            Update_RCONST( adj, temperature_K, pressure_Pa, airDens, adj.VAR[ind_H2O] );
 
             /* ============================================================= */
             /* =================== Chemical integration ==================== */
             /* ============================================================= */
 
-            IERR = INTEGRATE_ADJ( NADJ, VAR, Y_adj, timeArray[nTime], timeArray[nTime+1], ATOL_adj, RTOL_adj, ATOL, RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, STEPMIN );
+            /* The adjoint integrator reads the fixed species and rate
+             * constants from the KPP globals */
+            for ( UInt iSpec = 0; iSpec < NFIX; iSpec++ )
+                FIX[iSpec] = adj.FIX[iSpec];
+            for ( UInt iReact = 0; iReact < NREACT; iReact++ )
+                RCONST[iReact] = adj.RCONST[iReact];
+
+            IERR = INTEGRATE_ADJ( NADJ, adj.VAR, Y_adj, timeArray[nTime], timeArray[nTime+1], ATOL_adj, RTOL_adj, adj.ATOL, adj.RTOL, ICNTRL, RCNTRL, ISTATUS, RSTATUS, adj.STEPMIN );
 
             if ( IERR < 0 ) {
                 /* Integration failed */
@@ -2380,11 +2947,11 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                 if ( printDEBUG ) {
                     std::cout << " ~~~ Printing reaction rates:\n";
                     for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                        std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
+                        std::cout << "Reaction " << iReact << ": " << adj.RCONST[iReact] << " [molec/cm^3/s]\n";
                     }
                     std::cout << " ~~~ Printing concentrations:\n";
                     for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                        std::cout << "Species " << iSpec << ": " << VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
+                        std::cout << "Species " << iSpec << ": " << adj.VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
                     }
                 }
 
@@ -2394,7 +2961,7 @@ int PlumeModel( OptInput &Input_Opt, const Input &input )
                 return KPP_FAIL;
             }
 
-            adjointData.FillIn( nTime + 1 );
+            adjointData.FillIn( adj, nTime + 1 );
 
             curr_Time_s += dt;
             nTime++;
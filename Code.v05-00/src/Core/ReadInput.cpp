@@ -5692,6 +5692,236 @@ void Read_Transport_Menu( OptInput &Input_Opt, bool &RC )
         exit(1);
     }
 
+    /* ==================================================== */
+    /* Single prec. species?                               */
+    /* ==================================================== */
+
+    variable = "Single prec. species?";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    if ( ( strcmp(tokens[0].c_str(), "T" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "t" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "1" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "TRUE" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "true" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "True" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "YES" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Y" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "y" )    == 0 ) )
+        Input_Opt.TRANSPORT_SINGLE_SPECIES = 1;
+    else if ( ( strcmp(tokens[0].c_str(), "F" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "f" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "0" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "FALSE" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "false" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "False" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "NO" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "No" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "no" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "N" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "n" )     == 0 ) )
+        Input_Opt.TRANSPORT_SINGLE_SPECIES = 0;
+    else {
+        std::cout << " Wrong input for: " << variable << std::endl;
+        exit(1);
+    }
+
+    /* ==================================================== */
+    /* Single prec. aerosols?                              */
+    /* ==================================================== */
+
+    variable = "Single prec. aerosols?";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    if ( ( strcmp(tokens[0].c_str(), "T" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "t" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "1" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "TRUE" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "true" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "True" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "YES" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Y" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "y" )    == 0 ) )
+        Input_Opt.TRANSPORT_SINGLE_AEROSOL = 1;
+    else if ( ( strcmp(tokens[0].c_str(), "F" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "f" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "0" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "FALSE" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "false" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "False" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "NO" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "No" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "no" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "N" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "n" )     == 0 ) )
+        Input_Opt.TRANSPORT_SINGLE_AEROSOL = 0;
+    else {
+        std::cout << " Wrong input for: " << variable << std::endl;
+        exit(1);
+    }
+
+    /* ==================================================== */
+    /* Single prec. rings?                                 */
+    /* ==================================================== */
+
+    variable = "Single prec. rings?";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    if ( ( strcmp(tokens[0].c_str(), "T" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "t" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "1" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "TRUE" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "true" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "True" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "YES" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Y" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "y" )    == 0 ) )
+        Input_Opt.TRANSPORT_SINGLE_RINGS = 1;
+    else if ( ( strcmp(tokens[0].c_str(), "F" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "f" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "0" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "FALSE" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "false" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "False" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "NO" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "No" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "no" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "N" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "n" )     == 0 ) )
+        Input_Opt.TRANSPORT_SINGLE_RINGS = 0;
+    else {
+        std::cout << " Wrong input for: " << variable << std::endl;
+        exit(1);
+    }
+
+    /* ==================================================== */
+    /* Grid size NX/NY                                      */
+    /* ==================================================== */
+
+    variable = "Grid size NX/NY";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    try {
+        Input_Opt.TRANSPORT_NX = std::stoi( tokens.at(0) );
+        Input_Opt.TRANSPORT_NY = std::stoi( tokens.at(1) );
+    } catch(std::exception& e) {
+        std::cout << " Could not convert string to int for " << variable << std::endl;
+        exit(1);
+    }
+
+    if ( ( Input_Opt.TRANSPORT_NX < 2 ) || ( Input_Opt.TRANSPORT_NX % 2 ) || \
+         ( Input_Opt.TRANSPORT_NY < 2 ) || ( Input_Opt.TRANSPORT_NY % 2 ) ) {
+        std::cout << " Wrong input for " << variable << std::endl;
+        std::cout << " Number of cells needs to be even and positive" << std::endl;
+        exit(1);
+    }
+
+    /* ==================================================== */
+    /* Grow domain?                                         */
+    /* ==================================================== */
+
+    variable = "Grow domain?";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    if ( ( strcmp(tokens[0].c_str(), "T" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "t" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "1" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "TRUE" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "true" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "True" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "YES" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Y" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "y" )    == 0 ) )
+        Input_Opt.TRANSPORT_GROW_DOMAIN = 1;
+    else if ( ( strcmp(tokens[0].c_str(), "F" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "f" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "0" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "FALSE" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "false" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "False" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "NO" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "No" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "no" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "N" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "n" )     == 0 ) )
+        Input_Opt.TRANSPORT_GROW_DOMAIN = 0;
+    else {
+        std::cout << " Wrong input for: " << variable << std::endl;
+        exit(1);
+    }
+
+    /* ==================================================== */
+    /* Initial NX/NY                                        */
+    /* ==================================================== */
+
+    variable = "Initial NX/NY";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    try {
+        Input_Opt.TRANSPORT_NX_INIT = std::stoi( tokens.at(0) );
+        Input_Opt.TRANSPORT_NY_INIT = std::stoi( tokens.at(1) );
+    } catch(std::exception& e) {
+        std::cout << " Could not convert string to int for " << variable << std::endl;
+        exit(1);
+    }
+
+    if ( Input_Opt.TRANSPORT_GROW_DOMAIN ) {
+        /* The domain grows twofold, up to the full grid */
+        for ( UInt iDir = 0; iDir < 2; iDir++ ) {
+            const int nInit = ( iDir == 0 ) ? Input_Opt.TRANSPORT_NX_INIT : Input_Opt.TRANSPORT_NY_INIT;
+            const int nFull = ( iDir == 0 ) ? Input_Opt.TRANSPORT_NX      : Input_Opt.TRANSPORT_NY;
+            int ratio = ( ( nInit >= 2 ) && ( nInit % 2 == 0 ) && ( nFull % nInit == 0 ) ) ? nFull / nInit : 0;
+            while ( ( ratio > 1 ) && ( ratio % 2 == 0 ) )
+                ratio /= 2;
+            if ( ratio != 1 ) {
+                std::cout << " Wrong input for " << variable << std::endl;
+                std::cout << " Initial number of cells needs to be even and the full number of cells divided by a power of 2" << std::endl;
+                exit(1);
+            }
+        }
+    } else {
+        Input_Opt.TRANSPORT_NX_INIT = Input_Opt.TRANSPORT_NX;
+        Input_Opt.TRANSPORT_NY_INIT = Input_Opt.TRANSPORT_NY;
+    }
+
     /* Return success */
     RC = SUCCESS;
 
@@ -5709,6 +5939,14 @@ void Read_Transport_Menu( OptInput &Input_Opt, bool &RC )
     std::cout << " Turn on plume updraft?  : " << Input_Opt.TRANSPORT_UPDRAFT                        << std::endl;
     std::cout << "  => Updraft timescale[s]: " << Input_Opt.TRANSPORT_UPDRAFT_TIMESCALE              << std::endl;
     std::cout << "  => Updraft vel.   [m/s]: " << Input_Opt.TRANSPORT_UPDRAFT_VELOCITY               << std::endl;
+    std::cout << " Single prec. species?   : " << Input_Opt.TRANSPORT_SINGLE_SPECIES                 << std::endl;
+    std::cout << " Single prec. aerosols?  : " << Input_Opt.TRANSPORT_SINGLE_AEROSOL                 << std::endl;
+    std::cout << " Single prec. rings?     : " << Input_Opt.TRANSPORT_SINGLE_RINGS                   << std::endl;
+    std::cout << " Grid size NX/NY [-]     : " << Input_Opt.TRANSPORT_NX << " "                      \
+                                            << Input_Opt.TRANSPORT_NY                             << std::endl;
+    std::cout << " Grow domain?            : " << Input_Opt.TRANSPORT_GROW_DOMAIN                    << std::endl;
+    std::cout << "  => Initial NX/NY [-]   : " << Input_Opt.TRANSPORT_NX_INIT << " "                 \
+                                            << Input_Opt.TRANSPORT_NY_INIT                        << std::endl;
 
 } /* End of Read_Transport_Menu */
 
@@ -5817,6 +6055,166 @@ void Read_Chemistry_Menu( OptInput &Input_Opt, bool &RC )
         exit(1);
     }
 
+    /* ==================================================== */
+    /* Skip backgrd cells?                                  */
+    /* ==================================================== */
+
+    variable = "Skip backgrd cells?";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable range */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    if ( ( strcmp(tokens[0].c_str(), "T" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "t" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "1" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "TRUE" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "true" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "True" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "YES" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Y" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "y" )    == 0 ) )
+        Input_Opt.CHEMISTRY_SKIP_BACKG = 1;
+    else if ( ( strcmp(tokens[0].c_str(), "F" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "f" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "0" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "FALSE" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "false" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "False" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "NO" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "No" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "no" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "N" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "n" )     == 0 ) )
+        Input_Opt.CHEMISTRY_SKIP_BACKG = 0;
+    else {
+        std::cout << " Wrong input for: " << variable << std::endl;
+        exit(1);
+    }
+
+    /* ==================================================== */
+    /* Scheduled LU decomp.?                                */
+    /* ==================================================== */
+
+    variable = "Scheduled LU decomp.?";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable range */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    if ( ( strcmp(tokens[0].c_str(), "T" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "t" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "1" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "TRUE" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "true" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "True" ) == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "YES" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "yes" )  == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "Y" )    == 0 ) || \
+         ( strcmp(tokens[0].c_str(), "y" )    == 0 ) )
+        Input_Opt.CHEMISTRY_LU_SCHED = 1;
+    else if ( ( strcmp(tokens[0].c_str(), "F" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "f" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "0" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "FALSE" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "false" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "False" ) == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "NO" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "No" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "no" )    == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "N" )     == 0 ) || \
+              ( strcmp(tokens[0].c_str(), "n" )     == 0 ) )
+        Input_Opt.CHEMISTRY_LU_SCHED = 0;
+    else {
+        std::cout << " Wrong input for: " << variable << std::endl;
+        exit(1);
+    }
+
+    /* ==================================================== */
+    /* Jacobian ThetaMin                                    */
+    /* ==================================================== */
+
+    variable = "Jacobian ThetaMin";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    try {
+        value = std::stod( tokens[0] );
+        if ( value >= 0.0E+00 )
+            Input_Opt.CHEMISTRY_JAC_THETAMIN = value;
+        else {
+            std::cout << " Wrong input for: " << variable << std::endl;
+            std::cout << " ThetaMin needs to be positive or zero" << std::endl;
+            exit(1);
+        }
+    } catch(std::exception& e) {
+        std::cout << " Could not convert string to double for " << variable << std::endl;
+        exit(1);
+    }
+
+    /* ==================================================== */
+    /* Cell clustering tol.                                 */
+    /* ==================================================== */
+
+    variable = "Cell clustering tol.";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    try {
+        value = std::stod( tokens[0] );
+        if ( value >= 0.0E+00 )
+            Input_Opt.CHEMISTRY_CLUSTER_TOL = value;
+        else {
+            std::cout << " Wrong input for: " << variable << std::endl;
+            std::cout << " Clustering tolerance needs to be positive or zero" << std::endl;
+            exit(1);
+        }
+    } catch(std::exception& e) {
+        std::cout << " Could not convert string to double for " << variable << std::endl;
+        exit(1);
+    }
+
+    /* ==================================================== */
+    /* Reduced chem. tol.                                   */
+    /* ==================================================== */
+
+    variable = "Reduced chem. tol.";
+    getline( inputFile, line, '\n' );
+    if ( VERBOSE )
+        std::cout << line << std::endl;
+
+    /* Extract variable */
+    tokens = Split_Line( line.substr(FIRSTCOL), SPACE );
+
+    try {
+        value = std::stod( tokens[0] );
+        if ( value >= 0.0E+00 )
+            Input_Opt.CHEMISTRY_REDUCED_TOL = value;
+        else {
+            std::cout << " Wrong input for: " << variable << std::endl;
+            std::cout << " Reduced chemistry tolerance needs to be positive or zero" << std::endl;
+            exit(1);
+        }
+    } catch(std::exception& e) {
+        std::cout << " Could not convert string to double for " << variable << std::endl;
+        exit(1);
+    }
+
     /* ==================================================== */
     /* Chemistry Timestep                                   */
     /* ==================================================== */
@@ -5871,6 +6269,11 @@ void Read_Chemistry_Menu( OptInput &Input_Opt, bool &RC )
     std::cout << " ------------------------+------------------------------------------------------ " << std::endl;
     std::cout << " Turn on Chemistry?      : " << Input_Opt.CHEMISTRY_CHEMISTRY                      << std::endl;
     std::cout << " Perform het. chem.?     : " << Input_Opt.CHEMISTRY_HETCHEM                        << std::endl;
+    std::cout << " Skip backgrd cells?     : " << Input_Opt.CHEMISTRY_SKIP_BACKG                     << std::endl;
+    std::cout << " Scheduled LU decomp.?   : " << Input_Opt.CHEMISTRY_LU_SCHED                       << std::endl;
+    std::cout << " Jacobian ThetaMin       : " << Input_Opt.CHEMISTRY_JAC_THETAMIN                   << std::endl;
+    std::cout << " Cell clustering tol.    : " << Input_Opt.CHEMISTRY_CLUSTER_TOL                    << std::endl;
+    std::cout << " Reduced chem. tol.      : " << Input_Opt.CHEMISTRY_REDUCED_TOL                    << std::endl;
     std::cout << " Chemistry Timestep [min]: " << Input_Opt.CHEMISTRY_TIMESTEP                       << std::endl;
     std::cout << " Photolysis rates folder : " << Input_Opt.CHEMISTRY_JRATE_FOLDER                   << std::endl;
 
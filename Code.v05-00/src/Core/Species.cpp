@@ -36,6 +36,8 @@ SpeciesArray::SpeciesArray( const UInt nRing_, const UInt nTime_, const bool hal
     for ( UInt N = 0; N < NSPECREACT; N++ )
         Species.push_back( v2d );
 
+    chemStep = v1d;
+
     for ( UInt i = 0; i < nTime; i++ ) {
         sootDens.push_back( v1d );
         sootRadi.push_back( v1d );
@@ -59,6 +61,7 @@ SpeciesArray::SpeciesArray( const SpeciesArray &sp )
     halfRing = sp.gethalfRing();
 
     Species  = sp.Species;
+    chemStep = sp.chemStep;
 
     sootDens = sp.sootDens;
     sootRadi = sp.sootRadi;
@@ -84,6 +87,7 @@ SpeciesArray& SpeciesArray::operator=( const SpeciesArray &sp )
     halfRing = sp.gethalfRing();
 
     Species  = sp.Species;
+    chemStep = sp.chemStep;
 
     sootDens = sp.sootDens;
     sootRadi = sp.sootRadi;
@@ -193,11 +197,11 @@ void SpeciesArray::FillIn( Solution &Data,             \
         /* Precompute total weights */
         totW = 0.0E+00;
         for ( jNy = 0; jNy < Data.Species[0].size(); jNy++ ) {
-            for ( iNx = 0; iNx < Data.Species[0][0].size(); iNx++ )
+            for ( iNx = 0; iNx < Data.Species[0].Nx(); iNx++ )
                 totW += weights[iRing][jNy][iNx];
         }
         for ( jNy = 0; jNy < Data.Species[0].size(); jNy++ ) {
-            for ( iNx = 0; iNx < Data.Species[0][0].size(); iNx++ ) {
+            for ( iNx = 0; iNx < Data.Species[0].Nx(); iNx++ ) {
 
                 w = weights[iRing][jNy][iNx] / totW;
 
@@ -227,32 +231,32 @@ void SpeciesArray::FillIn( Solution &Data,             \
 
 } /* End of SpeciesArray::FillIn */
 
-void SpeciesArray::FillIn( UInt iTime, UInt iRing )
+void SpeciesArray::FillIn( KppContext &ctx, UInt iTime, UInt iRing )
 {
 
     /* Ensure positiveness */
     for ( UInt N = 0; N < NVAR; N++ ) {
-        if ( VAR[N] <= 0.0 ) {
-            VAR[N] = ZERO;
+        if ( ctx.VAR[N] <= 0.0 ) {
+            ctx.VAR[N] = ZERO;
         }
-        Species[N][iTime][iRing] = VAR[N];
+        Species[N][iTime][iRing] = ctx.VAR[N];
     }
 
 } /* End of SpeciesArray::FillIn */
 
-void SpeciesArray::getData( UInt iTime, UInt iRing )
+void SpeciesArray::getData( KppContext &ctx, UInt iTime, UInt iRing )
 {
 
     for ( UInt N = 0; N < NVAR; N++ )
-        VAR[N] = Species[N][iTime][iRing];
+        ctx.VAR[N] = Species[N][iTime][iRing];
 
     for ( UInt N = 0; N < NFIX; N++ )
-        FIX[N] = Species[NVAR+N][iTime][iRing];
+        ctx.FIX[N] = Species[NVAR+N][iTime][iRing];
 
     /* Ensure positiveness */
     for ( UInt N = 0; N < NVAR; N++ ) {
-        if ( VAR[N] <= 0.0 ) {
-            VAR[N] = ZERO;
+        if ( ctx.VAR[N] <= 0.0 ) {
+            ctx.VAR[N] = ZERO;
         }
     }
 
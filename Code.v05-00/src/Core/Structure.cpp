@@ -61,6 +61,17 @@ void Solution::SetShape( Vector_2D& vector_2D, \
 
 } /* End of Solution::SetShape */
 
+void Solution::SetShape( Field2D& field,  \
+                         const UInt n_x,  \
+                         const UInt n_y,  \
+                         const RealDouble value )
+{
+
+    /* Dimensions are transposed! */
+    field.Resize( n_y, n_x, value );
+
+} /* End of Solution::SetShape */
+
 void Solution::SetToValue( Vector_2D& vector_2D, \
                            const RealDouble value )
 {
@@ -73,6 +84,14 @@ void Solution::SetToValue( Vector_2D& vector_2D, \
 
 } /* End of Solution::SetToValue */
 
+void Solution::SetToValue( Field2D& field, \
+                           const RealDouble value )
+{
+
+    field.SetToValue( value );
+
+} /* End of Solution::SetToValue */
+
 void Solution::Print( const Vector_2D& vector_2D, \
                       const UInt i_max,           \
                       const UInt j_max ) const
@@ -181,6 +200,10 @@ void Solution::Initialize( char const *fileName,      \
 
     /* Initialize and allocate space for species */
 
+    /* The grid is that of the meteorological fields */
+    size_y = met.H2O_.size();
+    size_x = ( size_y > 0 ) ? met.H2O_[0].size() : 0;
+
     UInt actualX = size_x;
     UInt actualY = size_y;
     if ( !Input_Opt.CHEMISTRY_CHEMISTRY ) {
@@ -190,8 +213,9 @@ void Solution::Initialize( char const *fileName,      \
         reducedSize = 1;
     }
 
-    Vector_2D tmpArray( size_y, Vector_1D( size_x, 0.0E+00 ) );
-    Vector_2D tmpArray_Reduced( actualY, Vector_1D( actualX, 0.0E+00 ) );
+    /* All species share a single contiguous allocation */
+    Vector_1Dui speciesNy( NSPECALL, actualY );
+    Vector_1Dui speciesNx( NSPECALL, actualX );
 
     for ( UInt N = 0; N < NSPECALL; N++ ) {
         if ( ( N == ind_H2O      ) || \
@@ -199,14 +223,16 @@ void Solution::Initialize( char const *fileName,      \
              ( N == ind_H2Oplume ) || \
              ( N == ind_H2OL     ) || \
              ( N == ind_H2OS     ) ) {
-            SetShape( tmpArray, size_x, size_y, amb_Value[N] * airDens );
-            Species.push_back( tmpArray );
-        } else {
-            SetShape( tmpArray_Reduced, actualX, actualY, amb_Value[N] * airDens );
-            Species.push_back( tmpArray_Reduced );
+            speciesNy[N] = size_y;
+            speciesNx[N] = size_x;
         }
     }
 
+    Species.Resize( speciesNy, speciesNx );
+
+    for ( UInt N = 0; N < NSPECALL; N++ )
+        SetToValue( Species[N], amb_Value[N] * airDens );
+
     if ( Input_Opt.MET_LOADMET ) {
         /* Use meteorological input? */
         //H2O = met.H2O_;
@@ -290,6 +316,10 @@ void Solution::Initialize( char const *fileName,      \
     SetToValue( Species[ind_NIT]  , (RealDouble) stratData[ 9] );
     SetToValue( Species[ind_NAT]  , (RealDouble) stratData[10] );
 
+    /* No chemistry step size yet */
+    SetShape( chemStep , size_x, size_y, 0.0E+00 );
+    SetShape( chemCost , size_x, size_y, 0.0E+00 );
+    SetShape( chemFail , size_x, size_y, 0.0E+00 );
 
     /* Aerosols */
     /* Assume that soot particles are monodisperse */
@@ -412,76 +442,341 @@ void Solution::Initialize( char const *fileName,      \
         std::cout << "         " << solidAerosol.EffRadius( 0, 0 ) * 1.00E+09 << " v " << PA_rEff << " [nm]\n";
     }
 
+    /* Store background values */
+    backgSpecies.assign( NSPECALL, 0.0E+00 );
+    for ( UInt N = 0; N < NSPECALL; N++ )
+        backgSpecies[N] = Species[N][0][0];
+
+    backgSoot.assign( 3, 0.0E+00 );
+    backgSoot[0] = sootDens[0][0];
+    backgSoot[1] = sootRadi[0][0];
+    backgSoot[2] = sootArea[0][0];
+
+    backgLA.assign( liquidAerosol.pdf.size(), 0.0E+00 );
+    for ( UInt iBin = 0; iBin < liquidAerosol.pdf.size(); iBin++ )
+        backgLA[iBin] = liquidAerosol.pdf[iBin][0][0];
+
+    backgPA.assign( solidAerosol.pdf.size(), 0.0E+00 );
+    for ( UInt iBin = 0; iBin < solidAerosol.pdf.size(); iBin++ )
+        backgPA[iBin] = solidAerosol.pdf[iBin][0][0];
+
 } /* End of Solution::Initialize */
 
-void Solution::getData( const UInt i, \
-                        const UInt j )
+void Solution::Regrid( const UInt n_x, const UInt n_y,   \
+                       const UInt i0, const UInt j0,     \
+                       const Vector_1D &ambient,         \
+                       const Meteorology &met )
 {
 
-    for ( UInt N = 0; N < NVAR; N++ )
-        VAR[N] = Species[N][j][i];
+    if ( ( met.H2O_.size() != n_y ) || ( met.H2O_[0].size() != n_x ) ) {
+        std::cout << " In Solution::Regrid: Meteorology is not on the new grid!\n";
+        exit(-1);
+    }
+
+    Vector_1D fill( backgSpecies );
+    for ( UInt N = 0; ( N < NSPECREACT ) && ( N < ambient.size() ); N++ )
+        fill[N] = ambient[N];
+    fill[ind_H2Oplume] = 0.0E+00;
 
-    for ( UInt N = 0; N < NFIX; N++ )
-        FIX[N] = Species[N+NVAR][j][i];
+    /* Reduced species are left untouched */
+    Species.Embed( n_y, n_x, j0, i0, fill );
+
+    for ( UInt j = 0; j < n_y; j++ ) {
+        for ( UInt i = 0; i < n_x; i++ ) {
+            Species[ind_H2Omet][j][i] = met.H2O_[j][i];
+            Species[ind_H2O][j][i]    = Species[ind_H2Omet][j][i] \
+                                      + Species[ind_H2Oplume][j][i];
+        }
+    }
+
+    chemStep.Embed( n_y, n_x, j0, i0, 0.0E+00 );
+    chemCost.Embed( n_y, n_x, j0, i0, 0.0E+00 );
+    chemFail.Embed( n_y, n_x, j0, i0, 0.0E+00 );
+
+    sootDens.Embed( n_y, n_x, j0, i0, backgSoot[0] );
+    sootRadi.Embed( n_y, n_x, j0, i0, backgSoot[1] );
+    sootArea.Embed( n_y, n_x, j0, i0, backgSoot[2] );
+
+    /* Aerosols that were not set up keep their default shape */
+    if ( ( liquidAerosol.pdf.size() > 0 ) && ( liquidAerosol.pdf[0].Nx() == size_x ) \
+                                          && ( liquidAerosol.pdf[0].Ny() == size_y ) )
+        liquidAerosol.Regrid( n_x, n_y, i0, j0, backgLA );
+    if ( ( solidAerosol.pdf.size() > 0 ) && ( solidAerosol.pdf[0].Nx() == size_x ) \
+                                         && ( solidAerosol.pdf[0].Ny() == size_y ) )
+        solidAerosol.Regrid( n_x, n_y, i0, j0, backgPA );
+
+    size_x = n_x;
+    size_y = n_y;
+
+} /* End of Solution::Regrid */
+
+void Solution::getData( KppContext &ctx, \
+                        const UInt i,    \
+                        const UInt j )
+{
+
+    Species.getCell( j, i, ctx.VAR, 0   , NVAR );
+    Species.getCell( j, i, ctx.FIX, NVAR, NFIX );
 
 } /* End of Solution::getData */
 
-void Solution::applyData( const UInt i, \
+void Solution::applyData( const KppContext &ctx, \
+                          const UInt i,          \
                           const UInt j )
 {
 
-    for ( UInt N = 0; N < NVAR; N++ )
-        Species[N][j][i] = VAR[N];
+    Species.setCell( j, i, ctx.VAR, 0, NVAR );
 
 } /* End of Solution::applyData */
 
-void Solution::applyRing( RealDouble tempArray[],        \
-                          const Vector_2Dui &mapIndices, \
-                          const UInt iRing )
+void Solution::applyRing( const KppContext &ctx,  \
+                          RealDouble tempArray[], \
+                          const Vector_1Dui &cells )
+{
+
+    UInt iCell = 0;
+    UInt N     = 0;
+
+    const UInt nCell = cells.size();
+
+    const RealDouble *ringVAR = ctx.VAR;
+    Vector_1D ratio( NVAR, 0.0E+00 );
+    for ( N = 0; N < NVAR; N++ )
+        ratio[N] = ringVAR[N] / tempArray[N];
+
+#pragma omp parallel for                 \
+    if       ( !PARALLEL_CASES         ) \
+    default  ( shared                  ) \
+    private  ( iCell, N                ) \
+    schedule ( static                  )
+    for ( iCell = 0; iCell < nCell; iCell++ ) {
+
+        const UInt index = cells[iCell];
+
+        for ( N = 0; N < NVAR; N++ ) {
+            if ( ( N == ind_N ) || ( N == ind_O ) || ( N == ind_O1D ) ) {
+                /* Special handlings! */
+                Species[N].data()[index] = ringVAR[N];
+            } else
+                Species[N].data()[index] *= ratio[N];
+        }
+
+    }
+
+} /* End of Solution::applyRing */
+
+void Solution::applyAmbient( const KppContext &ctx, \
+                             const Vector_1Dui &cells )
+{
+
+    UInt iCell = 0;
+    UInt N     = 0;
+
+    const UInt nCell = cells.size();
+
+    const RealDouble *ambVAR = ctx.VAR;
+
+#pragma omp parallel for                 \
+    if       ( !PARALLEL_CASES         ) \
+    default  ( shared                  ) \
+    private  ( iCell, N                ) \
+    schedule ( static                  )
+    for ( iCell = 0; iCell < nCell; iCell++ ) {
+        for ( N = 0; N < NVAR; N++ )
+            Species[N].data()[cells[iCell]] = ambVAR[N];
+    }
+
+} /* End of Solution::applyAmbient */
+
+/* Bin of x, on a logarithmic scale. Values below floor share a bin */
+static long ClusterBin( const RealDouble x, const RealDouble floor, \
+                        const RealDouble invWidth )
+{
+
+    return (long) std::floor( std::log( std::max( x, floor ) ) * invWidth );
+
+} /* End of ClusterBin */
+
+UInt Solution::ClusterCells( const Vector_1Dui &cells,   \
+                             const Meteorology &met,     \
+                             const RealDouble tol,       \
+                             const bool hetChem,         \
+                             Vector_1Dui &clusterPtr,    \
+                             Vector_1Dui &clusterCell ) const
+{
+
+    /* Species that drive the chemical regime of the plume */
+    static const UInt keySpec[] = { ind_O3,   ind_NO,    ind_NO2,  ind_NO3,  \
+                                    ind_HNO3, ind_N2O5,  ind_HNO2, ind_CO,   \
+                                    ind_OH,   ind_HO2,   ind_H2O2, ind_SO2,  \
+                                    ind_H2O,  ind_HCl,   ind_ClNO3, ind_BrNO3 };
+    const UInt nKeySpec = sizeof( keySpec ) / sizeof( keySpec[0] );
+
+    const UInt nCell = cells.size();
+    const RealDouble invWidth = 1.0E+00 / std::log1p( tol );
+
+    /* Aerosol areas and ice volume, if set up on this grid */
+    Vector_2D solidArea, solidVol, liquidArea;
+    bool hasAer = hetChem;
+    if ( hasAer ) {
+        solidArea  = solidAerosol.Moment( 2 );
+        solidVol   = solidAerosol.Moment( 3 );
+        liquidArea = liquidAerosol.Moment( 2 );
+        hasAer = ( solidArea.size() == size_y )  && ( size_y > 0 )              \
+              && ( solidArea[0].size() == size_x )                              \
+              && ( liquidArea.size() == size_y ) && ( liquidArea[0].size() == size_x );
+    }
+
+    /* Cluster index of each bin, in order of first appearance */
+    std::map<std::vector<long>, UInt> bins;
+    std::vector<long> key;
+    key.reserve( nKeySpec + 6 );
+
+    Vector_1Dui clusterOf( nCell, 0 );
+    Vector_1Dui clusterSize;
+
+    for ( UInt iCell = 0; iCell < nCell; iCell++ ) {
+
+        const UInt iNx = cells[iCell] % size_x;
+        const UInt jNy = cells[iCell] / size_x;
+
+        key.clear();
+        for ( UInt iSpec = 0; iSpec < nKeySpec; iSpec++ )
+            key.push_back( ClusterBin( Species[keySpec[iSpec]][jNy][iNx], \
+                                       CLUSTER_SPC_FLOOR, invWidth ) );
+        key.push_back( ClusterBin( met.temp(jNy,iNx), 0.0E+00, invWidth ) );
+        key.push_back( ClusterBin( met.press(jNy)   , 0.0E+00, invWidth ) );
+        if ( hasAer ) {
+            key.push_back( ClusterBin( solidArea[jNy][iNx] , CLUSTER_AER_FLOOR, invWidth ) );
+            key.push_back( ClusterBin( solidVol[jNy][iNx]  , CLUSTER_AER_FLOOR, invWidth ) );
+            key.push_back( ClusterBin( liquidArea[jNy][iNx], CLUSTER_AER_FLOOR, invWidth ) );
+            key.push_back( ClusterBin( sootArea[jNy][iNx]  , CLUSTER_AER_FLOOR, invWidth ) );
+        }
+
+        std::pair<std::map<std::vector<long>, UInt>::iterator, bool> bin = \
+            bins.insert( std::make_pair( key, (UInt) clusterSize.size() ) );
+        if ( bin.second )
+            clusterSize.push_back( 0 );
+
+        clusterOf[iCell] = bin.first->second;
+        clusterSize[clusterOf[iCell]]++;
+
+    }
+
+    /* Cells of each cluster, in the order of cells */
+    const UInt nCluster = clusterSize.size();
+    clusterPtr.assign( nCluster + 1, 0 );
+    for ( UInt iCluster = 0; iCluster < nCluster; iCluster++ )
+        clusterPtr[iCluster+1] = clusterPtr[iCluster] + clusterSize[iCluster];
+
+    Vector_1Dui next( clusterPtr.begin(), clusterPtr.end() - 1 );
+    clusterCell.assign( nCell, 0 );
+    for ( UInt iCell = 0; iCell < nCell; iCell++ )
+        clusterCell[next[clusterOf[iCell]]++] = cells[iCell];
+
+    return nCluster;
+
+} /* End of Solution::ClusterCells */
+
+void Solution::applyCluster( const KppContext &ctx,        \
+                             const RealDouble tempArray[], \
+                             const Vector_1Dui &cells,     \
+                             const UInt iBegin,            \
+                             const UInt iEnd )
+{
+
+    const RealDouble *repVAR = ctx.VAR;
+
+    for ( UInt N = 0; N < NVAR; N++ ) {
+
+        /* Special handlings, as in applyRing */
+        const bool setValue = ( N == ind_N ) || ( N == ind_O ) || ( N == ind_O1D ) \
+                           || ( tempArray[N] <= 0.0E+00 );
+        const RealDouble ratio = setValue ? 0.0E+00 : repVAR[N] / tempArray[N];
+
+        RealDouble *data = Species[N].data();
+        for ( UInt iCell = iBegin; iCell < iEnd; iCell++ ) {
+            if ( setValue )
+                data[cells[iCell]] = repVAR[N];
+            else
+                data[cells[iCell]] *= ratio;
+        }
+
+    }
+
+} /* End of Solution::applyCluster */
+
+UInt Solution::ActiveCells( const Vector_1D &ambient, \
+                            Vector_2Dui &active,      \
+                            const RealDouble rtol ) const
 {
 
     UInt iNx = 0;
     UInt jNy = 0;
     UInt N   = 0;
 
-    for ( jNy = 0; jNy < NY; jNy++ ) {
-        for ( iNx = 0; iNx < NX; iNx++ ) {
-            if ( mapIndices[jNy][iNx] == iRing ) {
+    UInt nActive = 0;
 
-                for ( N = 0; N < NVAR; N++ ) {
-                    if ( ( N == ind_N ) || ( N == ind_O ) || ( N == ind_O1D ) ) {
-                        /* Special handlings! */
-                        Species[ind_N][jNy][iNx]     = VAR[ind_N];
-                        Species[ind_O][jNy][iNx]     = VAR[ind_O];
-                        Species[ind_O1D][jNy][iNx]   = VAR[ind_O1D];
-                    } else
-                        Species[N][jNy][iNx] *= VAR[N] / tempArray[N];
-                }
+    const Vector_2D iceNum = solidAerosol.TotalNumber();
+    const bool hasIce = ( iceNum.size() == size_y ) && \
+                        ( size_y > 0 ) && ( iceNum[0].size() == size_x );
+
+    active.assign( size_y, Vector_1Dui( size_x, 0 ) );
+
+#pragma omp parallel for                 \
+    if       ( !PARALLEL_CASES         ) \
+    default  ( shared                  ) \
+    private  ( iNx, jNy, N             ) \
+    reduction( +:nActive               ) \
+    schedule ( dynamic, 1              )
+    for ( jNy = 0; jNy < size_y; jNy++ ) {
+        for ( iNx = 0; iNx < size_x; iNx++ ) {
 
+            if ( hasIce && ( iceNum[jNy][iNx] > ACTIVE_ICE_NUM ) )
+                active[jNy][iNx] = 1;
+
+            for ( N = 0; ( N < NVAR ) && !active[jNy][iNx]; N++ ) {
+                if ( N == ind_H2O )
+                    continue;
+                if ( std::abs( Species[N][jNy][iNx] - ambient[N] ) > \
+                     ACTIVE_ATOL + rtol * std::abs( ambient[N] ) )
+                    active[jNy][iNx] = 1;
             }
+
+            nActive += active[jNy][iNx];
+
         }
     }
 
-} /* End of Solution::applyRing */
+    return nActive;
+
+} /* End of Solution::ActiveCells */
 
-void Solution::applyAmbient( const Vector_2Dui &mapIndices, \
-                             const UInt iRing )
+void Solution::applyBackground( const Vector_1D &ambient, \
+                                const Vector_2Dui &active )
 {
 
     UInt iNx = 0;
     UInt jNy = 0;
     UInt N   = 0;
 
-    for ( jNy = 0; jNy < NY; jNy++ ) {
-        for ( iNx = 0; iNx < NX; iNx++ ) {
-            if ( mapIndices[jNy][iNx] == iRing ) {
-                for ( N = 0; N < NVAR; N++ )
-                    Species[N][jNy][iNx] = VAR[N];
+#pragma omp parallel for                 \
+    if       ( !PARALLEL_CASES         ) \
+    default  ( shared                  ) \
+    private  ( iNx, jNy, N             ) \
+    schedule ( dynamic, 1              )
+    for ( jNy = 0; jNy < size_y; jNy++ ) {
+        for ( iNx = 0; iNx < size_x; iNx++ ) {
+            if ( !active[jNy][iNx] ) {
+                for ( N = 0; N < NVAR; N++ ) {
+                    if ( N != ind_H2O )
+                        Species[N][jNy][iNx] = ambient[N];
+                }
             }
         }
     }
 
-} /* End of Solution::applyAmbient */
+} /* End of Solution::applyBackground */
 
 
 void Solution::addEmission( const Emission &EI, const Aircraft &AC,        \
@@ -552,8 +847,8 @@ void Solution::addEmission( const Emission &EI, const Aircraft &AC,        \
         /* Full rings */
         innerRing = 0;
         nCell     = nCellMap[innerRing];
-        for ( jNy = 0; jNy < NY; jNy++ ) {
-            for ( iNx = 0; iNx < NX; iNx++ ) {
+        for ( jNy = 0; jNy < size_y; jNy++ ) {
+            for ( iNx = 0; iNx < size_x; iNx++ ) {
 
                 Species[ind_H2Omet][jNy][iNx] = met.H2O_[jNy][iNx];
 
@@ -616,8 +911,8 @@ void Solution::addEmission( const Emission &EI, const Aircraft &AC,        \
              * full rings. Therefore, make sure that nCell is doubled when
              * using half-rings! */
             nCell     = 2.0 * nCellMap[innerRing];
-            for ( jNy = 0; jNy < NY; jNy++ ) {
-                for ( iNx = 0; iNx < NX; iNx++ ) {
+            for ( jNy = 0; jNy < size_y; jNy++ ) {
+                for ( iNx = 0; iNx < size_x; iNx++ ) {
 
                     Species[ind_H2Omet][jNy][iNx] = met.H2O_[jNy][iNx];
 
@@ -672,8 +967,8 @@ void Solution::addEmission( const Emission &EI, const Aircraft &AC,        \
 
     }
 
-    for ( jNy = 0; jNy < NY; jNy++ ) {
-        for ( iNx = 0; iNx < NX; iNx++ ) {
+    for ( jNy = 0; jNy < size_y; jNy++ ) {
+        for ( iNx = 0; iNx < size_x; iNx++ ) {
             Species[ind_H2O][jNy][iNx] = Species[ind_H2Omet][jNy][iNx] + Species[ind_H2Oplume][jNy][iNx];
         }
     }
@@ -780,8 +1075,8 @@ void Solution::getAerosolProp( RealDouble ( &radi )[4], \
     Vector_1D aerosolProp( 4, 0.0E+00 );
     RealDouble totalWeight = 0.0E+00;
 
-    for ( jNy = 0; jNy < NY; jNy++ ) {
-        for ( iNx = 0; iNx < NX; iNx++ )
+    for ( jNy = 0; jNy < size_y; jNy++ ) {
+        for ( iNx = 0; iNx < size_x; iNx++ )
             totalWeight += weights[jNy][iNx];
     }
 
@@ -808,8 +1103,8 @@ void Solution::getAerosolProp( RealDouble ( &radi )[4], \
     radi[3] = 0.0E+00;
     area[3] = 0.0E+00;
 
-    for ( jNy = 0; jNy < NY; jNy++ ) {
-        for ( iNx = 0; iNx < NX; iNx++ ) {
+    for ( jNy = 0; jNy < size_y; jNy++ ) {
+        for ( iNx = 0; iNx < size_x; iNx++ ) {
             area[3] += sootDens[jNy][iNx] * 4.0 * physConst::PI * \
                        sootRadi[jNy][iNx] * sootRadi[jNy][iNx] *  \
                        weights[jNy][iNx] / totalWeight;
@@ -848,25 +1143,17 @@ int Solution::SpinUp( Vector_1D &amb_Value,       \
     /* Convert to seconds */
     RunUntil *= 3600.0;
 
-    /* Allocate arrays for KPP */
+    /* Chemistry context for the spin-up */
     int IERR = 0;
-    RealDouble STEPMIN = (RealDouble)0.0;
-
-    RealDouble RTOL[NVAR];
-    RealDouble ATOL[NVAR];
-
-    for( UInt i = 0; i < NVAR; i++ ) {
-        RTOL[i] = KPP_RTOLS;
-        ATOL[i] = KPP_ATOLS;
-    }
-
+    KppContext kpp;
+    kpp.SetTolerances( KPP_RTOLS, KPP_ATOLS, 0.0E+00 );
 
     /* Initialize arrays */
     for ( UInt iVar = 0; iVar < NVAR; iVar++ )
-        VAR[iVar] = amb_Value[iVar] * airDens;
+        kpp.VAR[iVar] = amb_Value[iVar] * airDens;
 
     for ( UInt iFix = 0; iFix < NFIX; iFix++ )
-        FIX[iFix] = amb_Value[NVAR+iFix] * airDens;
+        kpp.FIX[iFix] = amb_Value[NVAR+iFix] * airDens;
 
     /* Define sun parameters */
     SZA *sun = new SZA( input.latitude_deg(), input.emissionDOY() );
@@ -880,29 +1167,28 @@ int Solution::SpinUp( Vector_1D &amb_Value,       \
         sun->Update( curr_Time_s + DT_CHEM/2 );
 
         for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-            PHOTOL[iPhotol] = 0.0E+00;
+            kpp.PHOTOL[iPhotol] = 0.0E+00;
 
         if ( sun->CSZA > 0.0E+00 )
-            Update_JRates( PHOTOL, sun->CSZA );
+            Update_JRates( kpp.PHOTOL, sun->CSZA );
 
         if ( DBG ) {
             std::cout << "\n DEBUG : (In SpinUp)\n";
             for ( UInt iPhotol = 0; iPhotol < NPHOTOL; iPhotol++ )
-                std::cout << "         PHOTOL[" << iPhotol << "] = " << PHOTOL[iPhotol] << "\n";
+                std::cout << "         PHOTOL[" << iPhotol << "] = " << kpp.PHOTOL[iPhotol] << "\n";
         }
 
         /* Update reaction rates */
         for ( UInt iReact = 0; iReact < NREACT; iReact++ )
-            RCONST[iReact] = 0.0E+00;
+            kpp.RCONST[iReact] = 0.0E+00;
 
-        Update_RCONST( input.temperature_K(), input.pressure_Pa(), airDens, VAR[ind_H2O] );
+        Update_RCONST( kpp, input.temperature_K(), input.pressure_Pa(), airDens, kpp.VAR[ind_H2O] );
 
         /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
         /* ~~~~~ Integration ~~~~~~ */
         /* ~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-        IERR = INTEGRATE( VAR, curr_Time_s, curr_Time_s + DT_CHEM, \
-                          ATOL, RTOL, STEPMIN );
+        IERR = INTEGRATE( kpp, curr_Time_s, curr_Time_s + DT_CHEM );
 
         if ( IERR < 0 ) {
             /* Integration failed */
@@ -916,11 +1202,11 @@ int Solution::SpinUp( Vector_1D &amb_Value,       \
             if ( DBG ) {
                 std::cout << " ~~~ Printing reaction rates:\n";
                 for ( UInt iReact = 0; iReact < NREACT; iReact++ ) {
-                    std::cout << "Reaction " << iReact << ": " << RCONST[iReact] << " [molec/cm^3/s]\n";
+                    std::cout << "Reaction " << iReact << ": " << kpp.RCONST[iReact] << " [molec/cm^3/s]\n";
                 }
                 std::cout << " ~~~ Printing concentrations:\n";
                 for ( UInt iSpec = 0; iSpec < NVAR; iSpec++ ) {
-                    std::cout << "Species " << iSpec << ": " << VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
+                    std::cout << "Species " << iSpec << ": " << kpp.VAR[iSpec]/airDens*1.0E+09 << " [ppb]\n";
                 }
             }
 
@@ -932,7 +1218,7 @@ int Solution::SpinUp( Vector_1D &amb_Value,       \
     }
 
     for ( UInt iVar = 0; iVar < NVAR; iVar++ )
-        amb_Value[iVar] = VAR[iVar] / airDens;
+        amb_Value[iVar] = kpp.VAR[iVar] / airDens;
 
 
     /* Clear dynamically allocated variable(s) */
@@ -88,6 +88,35 @@ namespace util
         return temp;
     }
     
+    double* vect2double( const FieldStack &vals, unsigned int N, unsigned int M, \
+                         unsigned int L, double scalingFactor )
+    {
+        double* temp;
+        temp = new double[N*M*L];
+
+        for( unsigned int n = 0; n < N; n++ ) {
+            const double* src = vals[n].data();
+            for( unsigned int k = 0; k < M*L; k++ )
+                temp[k + L*M*n] = src[k] * scalingFactor;
+        }
+
+        return temp;
+    }
+    
+    double* vect2double( const Field2D &vals, unsigned int N, unsigned int M, \
+                         double scalingFactor )
+    {
+        double* temp;
+        temp = new double[N*M];
+
+        /* Field2D is already stored row-major */
+        const double* src = vals.data();
+        for( unsigned int k = 0; k < N*M; k++ )
+            temp[k] = src[k] * scalingFactor;
+
+        return temp;
+    }
+    
 //    double** vect2double( std::vector<std::vector<double> > &vals, unsigned int N, unsigned int M, double scalingFactor )
 //    {
 //        double** temp;
@@ -160,6 +189,34 @@ namespace util
 
         return temp;
     }
+    
+    float* vect2float( const FieldStack &vals, unsigned int N, unsigned int M, \
+                       unsigned int L, double scalingFactor )
+    {
+        float* temp;
+        temp = new float[N*M*L];
+
+        for( unsigned int n = 0; n < N; n++ ) {
+            const double* src = vals[n].data();
+            for( unsigned int k = 0; k < M*L; k++ )
+                temp[k + L*M*n] = src[k] * scalingFactor;
+        }
+
+        return temp;
+    }
+    
+    float* vect2float( const Field2D &vals, unsigned int N, unsigned int M, \
+                       double scalingFactor )
+    {
+        float* temp;
+        temp = new float[N*M];
+
+        const double* src = vals.data();
+        for( unsigned int k = 0; k < N*M; k++ )
+            temp[k] = (float) src[k] * scalingFactor;
+
+        return temp;
+    }
 
 //    float** vect2float( std::vector<std::vector<double> > &vals, unsigned int N, unsigned int M, double scalingFactor )
 //    {
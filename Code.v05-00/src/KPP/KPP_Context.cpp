@@ -0,0 +1,134 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* KPP_Context Program File                                         */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : KPP_Context.cpp                           */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <string.h>
+#include <iostream>
+
+#include "KPP/KPP.hpp"
+#include "KPP/KPP_Context.hpp"
+
+void Fun( double V[], double F[], double RCT[], double Vdot[] );
+void Jac_SP( double V[], double F[], double RCT[], double JVS[] );
+
+KppContext::KppContext( )
+{
+
+    /* All members are plain arrays and scalars */
+    memset( static_cast<void*>( this ), 0, sizeof( KppContext ) );
+
+    VAR = &C[0];
+    FIX = &C[NVAR];
+
+} /* End of KppContext::KppContext */
+
+KppContext::KppContext( const KppContext &ctx )
+{
+
+    memcpy( static_cast<void*>( this ), &ctx, sizeof( KppContext ) );
+
+    VAR = &C[0];
+    FIX = &C[NVAR];
+
+} /* End of KppContext::KppContext */
+
+KppContext& KppContext::operator=( const KppContext &ctx )
+{
+
+    if ( &ctx == this )
+        return *this;
+
+    memcpy( static_cast<void*>( this ), &ctx, sizeof( KppContext ) );
+
+    VAR = &C[0];
+    FIX = &C[NVAR];
+
+    return *this;
+
+} /* End of KppContext::operator= */
+
+void KppContext::SetTolerances( const double RTOLS, const double ATOLS, \
+                                const double STEPMIN_ )
+{
+
+    for ( unsigned int i = 0; i < NVAR; i++ ) {
+        RTOL[i] = RTOLS;
+        ATOL[i] = ATOLS;
+    }
+
+    STEPMIN = STEPMIN_;
+
+} /* End of KppContext::SetTolerances */
+
+void KppContext::ResetStats( )
+{
+
+    Nfun = 0; Njac = 0; Nstp = 0; Nacc = 0;
+    Nrej = 0; Ndec = 0; Nsol = 0; Nsng = 0;
+    Nreu = 0; Nfrz = 0;
+
+    Ns = 0; Na = 0; Nr = 0; Ng = 0;
+
+    NfunTot = 0; NjacTot = 0; NdecTot = 0;
+    NsolTot = 0; NreuTot = 0; NfrzTot = 0;
+
+} /* End of KppContext::ResetStats */
+
+void KppContext::GetStats( unsigned long ISTAT[] ) const
+{
+
+    ISTAT[KPP_NFUN] = NfunTot; ISTAT[KPP_NJAC] = NjacTot;
+    ISTAT[KPP_NSTP] = Ns;      ISTAT[KPP_NACC] = Na;
+    ISTAT[KPP_NREJ] = Nr;      ISTAT[KPP_NDEC] = NdecTot;
+    ISTAT[KPP_NSOL] = NsolTot; ISTAT[KPP_NSNG] = Ng;
+    ISTAT[KPP_NREU] = NreuTot; ISTAT[KPP_NFRZ] = NfrzTot;
+
+} /* End of KppContext::GetStats */
+
+void KppContext::AddStats( const unsigned long ISTAT[] )
+{
+
+    NfunTot += ISTAT[KPP_NFUN]; NjacTot += ISTAT[KPP_NJAC];
+    Ns      += ISTAT[KPP_NSTP]; Na      += ISTAT[KPP_NACC];
+    Nr      += ISTAT[KPP_NREJ]; NdecTot += ISTAT[KPP_NDEC];
+    NsolTot += ISTAT[KPP_NSOL]; Ng      += ISTAT[KPP_NSNG];
+    NreuTot += ISTAT[KPP_NREU]; NfrzTot += ISTAT[KPP_NFRZ];
+
+} /* End of KppContext::AddStats */
+
+void KppContext::PrintCost( ) const
+{
+
+    std::cout << " ** Chemistry cost: " << "\n";
+    std::cout << " ** -> Functions  : " << NfunTot << "\n";
+    std::cout << " ** -> Jacobians  : " << NjacTot << " (+ " << NfrzTot << " steps on a previous one)\n";
+    std::cout << " ** -> LU decomp. : " << NdecTot << " (+ " << NreuTot << " reused)\n";
+    std::cout << " ** -> Solves     : " << NsolTot << "\n";
+    std::cout << std::endl;
+
+} /* End of KppContext::PrintCost */
+
+void Fun( KppContext &ctx, double Y[], double Ydot[] )
+{
+
+    Fun( Y, ctx.FIX, ctx.RCONST, Ydot );
+
+} /* End of Fun */
+
+void Jac_SP( KppContext &ctx, double Y[], double JVS[] )
+{
+
+    Jac_SP( Y, ctx.FIX, ctx.RCONST, JVS );
+
+} /* End of Jac_SP */
+
+/* End of KPP_Context.cpp */
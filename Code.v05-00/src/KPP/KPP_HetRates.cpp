@@ -100,17 +100,21 @@ double HETHOBr_PSC( const double A, const double B, const double KHETI_SLA[11],
                     bool IS_STRAT,                  bool NATSURFACE );
 
 
-void GC_SETHET( const double TEMP, const double PATM, const double AIRDENS, \
-                const double RELHUM, const unsigned int STATE_PSC,          \
-                const double SPC[], const double AREA[NAERO],               \
-                const double RADI[NAERO], const double IWC,                 \
-                const double KHETI_SLA[11] )
+static void GC_SETHET( double HET[][3],                                    \
+                       const double TEMP, const double PATM,                \
+                       const double AIRDENS, const double RELHUM,           \
+                       const unsigned int STATE_PSC,                        \
+                       const double SPC[], const double AREA[NAERO],        \
+                       const double RADI[NAERO], const double IWC,          \
+                       const double KHETI_SLA[11] )
 {
 
     /* Sets up the array of heterogeneous chemistry rates for the KPP chemistry solver */
 
     /* INPUT PARAMETERS:
      *
+     * double HET[][3]            : Heterogeneous rates (output). Shadows
+     *                              the global array of the same name.
      * const double TEMP          : Temperature in K 
      * const double PATM          : Pressure in Pa 
      * const double AIRDENS       : Air density in molec/cm^3 
@@ -519,6 +523,20 @@ void GC_SETHET( const double TEMP, const double PATM, const double AIRDENS, \
 
 } /* End of GC_SETHET */
 
+void GC_SETHET( KppContext &ctx,                                    \
+                const double TEMP, const double PATM,               \
+                const double AIRDENS, const double RELHUM,          \
+                const unsigned int STATE_PSC,                       \
+                const double AREA[NAERO], const double RADI[NAERO], \
+                const double IWC, const double KHETI_SLA[11] )
+{
+
+    /* Uses the variable species of the context */
+    GC_SETHET( ctx.HET, TEMP, PATM, AIRDENS, RELHUM, STATE_PSC, \
+               ctx.VAR, AREA, RADI, IWC, KHETI_SLA );
+
+} /* End of GC_SETHET */
+
 void CHECK_NAT( bool &IS_NAT, bool &IS_PSC, bool &IS_STRAT, \
                 const unsigned int STATE_PSC, const double PATM )
 {
@@ -26,7 +26,6 @@
 
 #include "KPP/KPP.hpp"
 #include "KPP/KPP_Parameters.h"
-#include "KPP/KPP_Global.h"
 #include "KPP/KPP_Sparse.h"
 
 
@@ -52,23 +51,21 @@
  #define  HALF     (double)0.5
  #define  DeltaMin (double)1.0e-6    
    
-/*~~~> Collect statistics: global variables */   
- int Nfun,Njac,Nstp,Nacc,Nrej,Ndec,Nsol,Nsng;
+/*~~~> Statistics and all integration state are held in the KppContext
+        passed to each routine: there is no global state in this file */
 
 
 /*~~~> Function headers */   
- void FunTemplate(double, double [], double []); 
- void JacTemplate(double, double [], double []) ;
- int Rosenbrock(double Y[], double Tstart, double Tend,
+ int Rosenbrock(KppContext *ctx, double Y[], double Tstart, double Tend,
      double AbsTol[], double RelTol[],
-     void (*ode_Fun)(double, double [], double []), 
-     void (*ode_Jac)(double, double [], double []),
+     void (*ode_Fun)(KppContext*, double, double [], double []), 
+     void (*ode_Jac)(KppContext*, double, double [], double []),
      double RPAR[], int IPAR[]);
- int RosenbrockIntegrator(
+ int RosenbrockIntegrator( KppContext *ctx,
      double Y[], double Tstart, double Tend ,     
      double  AbsTol[], double  RelTol[],
-     void (*ode_Fun)(double, double [], double []), 
-     void (*ode_Jac)(double, double [], double []),
+     void (*ode_Fun)(KppContext*, double, double [], double []), 
+     void (*ode_Jac)(KppContext*, double, double [], double []),
      int ros_S,
      double ros_M[], double ros_E[], 
      double ros_A[], double ros_C[],
@@ -77,27 +74,29 @@
      char Autonomous, char VectorTol, int Max_no_steps,  
      double Roundoff, double Hmin, double Hmax, double Hstart,
      double FacMin, double FacMax, double FacRej, double FacSafe, 
+     double ThetaMin, int JacMaxAge,
      double *Texit, double *Hexit ); 
- char ros_PrepareMatrix (
+ double ros_JacChange ( double Jac0[],
+     double Yold[], double Y[], double Fold[], double Fcn0[],
+     double AbsTol[], double RelTol[], char VectorTol );
+ char ros_PrepareMatrix ( KppContext *ctx,
      double* H, 
      int Direction,  double gam, double Jac0[], 
-     double Ghimj[], int Pivot[] );
+     double Ghimj[], int Pivot[], double *GamLU );
  double ros_ErrorNorm ( 
      double Y[], double Ynew[], double Yerr[], 
      double AbsTol[], double RelTol[], 
      char VectorTol );
  int  ros_ErrorMsg(int Code, double T, double H);
- void ros_FunTimeDerivative ( 
+ void ros_FunTimeDerivative ( KppContext *ctx,
      double T, double Roundoff, 
      double Y[], double Fcn0[], 
-     void ode_Fun(double, double [], double []), 
+     void ode_Fun(KppContext*, double, double [], double []), 
      double dFdT[] );
- void Fun( double Y[], double FIX[], double RCONST[], double Ydot[] );
- void Jac_SP( double Y[], double FIX[], double RCONST[], double Ydot[] );
- void FunTemplate( double T, double Y[], double Ydot[] );
- void JacTemplate( double T, double Y[], double Ydot[] );
- void DecompTemplate( double A[], int Pivot[], int* ising );
- void SolveTemplate( double A[], int Pivot[], double b[] );
+ void FunTemplate( KppContext *ctx, double T, double Y[], double Ydot[] );
+ void JacTemplate( KppContext *ctx, double T, double Y[], double Ydot[] );
+ void DecompTemplate( KppContext *ctx, double A[], int Pivot[], int* ising );
+ void SolveTemplate( KppContext *ctx, double A[], int Pivot[], double b[] );
  void WCOPY(int N, double X[], int incX, double Y[], int incY);
  void WAXPY(int N, double Alpha, double X[], int incX, double Y[], int incY );
  void WSCAL(int N, double Alpha, double X[], int incX);
@@ -123,19 +122,20 @@
 	     double ros_Alpha[], double ros_Gamma[], 
 	     char ros_NewF[], double *ros_ELO, char* ros_Name );
  int  KppDecomp( double A[] );
+ int  KppDecompScheduled( double A[] );
  void KppSolve ( double A[], double b[] );
  
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-int INTEGRATE( double VAR[] , double TIN   , double TOUT,
-               double ATOL[], double RTOL[], double STEPMIN )
-/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+int INTEGRATE( KppContext &ctx, double TIN, double TOUT )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Integrates ctx.VAR from TIN to TOUT with the rate constants, fixed
+    species and tolerances of the context. Only ctx is read and written,
+    so that distinct contexts can be integrated concurrently.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 {
-    static double  RPAR[20];
-    static int  i, IERR, IPAR[20];
-    static int Ns=0, Na=0, Nr=0, Ng=0;
-    #pragma omp threadprivate( RPAR )
-    #pragma omp threadprivate( i, IERR, IPAR )
-    #pragma omp threadprivate( Ns, Na, Nr, Ng )
+    int i, IERR;
+    double *RPAR = ctx.RPAR;
+    int    *IPAR = ctx.IPAR;
 
    for ( i = 0; i < 20; i++ ) {
      IPAR[i] = 0;
@@ -145,27 +145,30 @@ int INTEGRATE( double VAR[] , double TIN   , double TOUT,
    
    IPAR[0] = 0;    /* non-autonomous */
    IPAR[1] = 1;    /* vector tolerances */
-   RPAR[2] = STEPMIN; /* starting step */
-   IPAR[3] = 5;    /* choice of the method */
+   RPAR[2] = ctx.STEPMIN; /* starting step */
+   IPAR[3] = ctx.METHOD ? ctx.METHOD : KPP_RODAS4; /* choice of the method */
+   IPAR[4] = ctx.DECOMP; /* choice of the LU decomposition */
+   RPAR[7] = ctx.THETAMIN; /* Jacobian reuse threshold */
 
-   IERR = Rosenbrock(VAR, TIN, TOUT,
-           ATOL, RTOL,
+   IERR = Rosenbrock(&ctx, ctx.VAR, TIN, TOUT,
+           ctx.ATOL, ctx.RTOL,
            &FunTemplate, &JacTemplate,
            RPAR, IPAR);
 
 	     
-   Ns=Ns+IPAR[12];
-   Na=Na+IPAR[13];
-   Nr=Nr+IPAR[14];
-   Ng=Ng+IPAR[17];
-//   printf("\n Step=%d  Acc=%d  Rej=%d  Singular=%d\n",Ns,Na,Nr,Ng);
-
-//   if (IERR < 0)
-//     printf("\n Rosenbrock: Unsucessful step at T=%g: IERR=%d\n",
-//         TIN,IERR);
-   
-   TIN = RPAR[10];      /* Exit time */
-   STEPMIN = RPAR[11];  /* Last step */
+   ctx.Ns += IPAR[12];
+   ctx.Na += IPAR[13];
+   ctx.Nr += IPAR[14];
+   ctx.Ng += IPAR[17];
+
+   ctx.NfunTot += IPAR[10];
+   ctx.NjacTot += IPAR[11];
+   ctx.NdecTot += IPAR[15];
+   ctx.NsolTot += IPAR[16];
+   ctx.NreuTot += IPAR[18];
+   ctx.NfrzTot += IPAR[19];
+
+   /* Exit time and last step are left in RPAR[10] and RPAR[11] */
   
    return IERR;
 
@@ -173,10 +176,65 @@ int INTEGRATE( double VAR[] , double TIN   , double TOUT,
 
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-int Rosenbrock(double Y[], double Tstart, double Tend,
+int INTEGRATE_FALLBACK( KppContext &ctx, const double VAR0[],
+                        double TIN, double TOUT, int *RUNG )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Recovers from a failed integration: integrates again from VAR0 over
+    [TIN,TOUT], with increasingly robust settings, until one succeeds
+      RUNG 1: the method of the context, from a starting step of
+              KPP_FALLBACK_STEP and with a new Jacobian at every step
+      RUNG 2: same, with Ros2 (L-stable, order 2)
+      RUNG 3: same as 2, over KPP_FALLBACK_NSUB sub-intervals
+    RUNG is set to zero if all fail, in which case ctx.VAR is reset to
+    VAR0. The settings of the context are restored on return.
+    Returns the IERR of the last attempt.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int i, iSub, IERR = -1;
+   const double STEPMIN0  = ctx.STEPMIN;
+   const double THETAMIN0 = ctx.THETAMIN;
+   const int    METHOD0   = ctx.METHOD;
+   const double DT        = ( TOUT - TIN ) / KPP_FALLBACK_NSUB;
+
+   ctx.STEPMIN  = KPP_FALLBACK_STEP;
+   ctx.THETAMIN = ZERO;
+
+   for ( *RUNG = 1; ( *RUNG <= 3 ) && ( IERR < 0 ); (*RUNG)++ ) {
+
+     for ( i = 0; i < NVAR; i++ )
+       ctx.VAR[i] = VAR0[i];
+
+     ctx.METHOD = ( *RUNG == 1 ) ? METHOD0 : KPP_ROS2;
+
+     if ( *RUNG < 3 )
+       IERR = INTEGRATE( ctx, TIN, TOUT );
+     else
+       for ( iSub = 0, IERR = 0; ( iSub < KPP_FALLBACK_NSUB ) && ( IERR >= 0 ); iSub++ )
+         IERR = INTEGRATE( ctx, TIN + iSub*DT, TIN + (iSub+1)*DT );
+
+   } /* for */
+
+   if ( IERR < 0 ) {
+     *RUNG = 0;
+     for ( i = 0; i < NVAR; i++ )
+       ctx.VAR[i] = VAR0[i];
+   } else
+     (*RUNG)--;
+
+   ctx.STEPMIN  = STEPMIN0;
+   ctx.THETAMIN = THETAMIN0;
+   ctx.METHOD   = METHOD0;
+
+   return IERR;
+
+} /* INTEGRATE_FALLBACK */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+int Rosenbrock(KppContext *ctx, double Y[], double Tstart, double Tend,
         double AbsTol[], double RelTol[],
-        void (*ode_Fun)(double, double [], double []), 
-	void (*ode_Jac)(double, double [], double []),
+        void (*ode_Fun)(KppContext*, double, double [], double []), 
+	void (*ode_Jac)(KppContext*, double, double [], double []),
         double RPAR[], int IPAR[])
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
    
@@ -257,6 +315,13 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
         = 4 :  method is  Rodas3
         = 5:   method is  Rodas4
 
+    IPAR[4]  -> selection of the LU decomposition
+        = KPP_DECOMP_GENERATED : KppDecomp
+        = KPP_DECOMP_SCHEDULED : KppDecompScheduled
+
+    IPAR[5]  -> maximum number of consecutive steps taken with the same
+        Jacobian. For IPAR[5]=0 the default value of KPP_JAC_MAXAGE is used
+
     RPAR[0]  -> Hmin, lower bound for the integration step size
           It is strongly recommended to keep Hmin = ZERO 
     RPAR[1]  -> Hmax, upper bound for the integration step size
@@ -268,6 +333,10 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
             (default=0.1)
     RPAR[6]  -> FacSafe, by which the new step is slightly smaller 
          than the predicted value  (default=0.9)
+    RPAR[7]  -> ThetaMin. If the relative error of the linearization of
+         F by the current Jacobian over the last step is smaller than
+         ThetaMin, the Jacobian is not recomputed (default=0, the
+         Jacobian is recomputed at every step)
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  
   *~~~>     OUTPUT PARAMETERS:
@@ -284,6 +353,8 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
     IPAR[15] = No. of LU decompositions
     IPAR[16] = No. of forward/backward substitutions
     IPAR[17] = No. of singular matrix decompositions
+    IPAR[18] = No. of reused LU decompositions
+    IPAR[19] = No. of steps taken with a previous Jacobian
 
     RPAR[10]  -> Texit, the time corresponding to the 
             computed Y upon return
@@ -301,20 +372,23 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
    char ros_NewF[Smax], ros_Name[12];
   /*~~~>  Local variables    */  
    int Max_no_steps, IERR, i, UplimTol;
+   int JacMaxAge;
    char Autonomous, VectorTol;
-   double Roundoff,FacMin,FacMax,FacRej,FacSafe;
+   double Roundoff,FacMin,FacMax,FacRej,FacSafe,ThetaMin;
    double Hmin, Hmax, Hstart, Hexit, Texit;
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
   /*~~~>  Initialize statistics */
-   Nfun = IPAR[10];
-   Njac = IPAR[11];
-   Nstp = IPAR[12];
-   Nacc = IPAR[13];
-   Nrej = IPAR[14];
-   Ndec = IPAR[15];
-   Nsol = IPAR[16];
-   Nsng = IPAR[17];
+   ctx->Nfun = IPAR[10];
+   ctx->Njac = IPAR[11];
+   ctx->Nstp = IPAR[12];
+   ctx->Nacc = IPAR[13];
+   ctx->Nrej = IPAR[14];
+   ctx->Ndec = IPAR[15];
+   ctx->Nsol = IPAR[16];
+   ctx->Nsng = IPAR[17];
+   ctx->Nreu = IPAR[18];
+   ctx->Nfrz = IPAR[19];
    
   /*~~~>  Autonomous or time dependent ODE. Default is time dependent. */
    Autonomous = !(IPAR[0] == 0);
@@ -409,6 +483,20 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
       printf("\n User-selected FacSafe: RPAR[6]=%e\n", RPAR[6]);
       return ros_ErrorMsg(-4,Tstart,ZERO);
    } /* end if */
+  /*~~~>   ThetaMin and JacMaxAge: Jacobian reuse */
+   ThetaMin = RPAR[7];
+   if (RPAR[7] < ZERO) {
+      printf("\n User-selected ThetaMin: RPAR[7]=%e\n", RPAR[7]);
+      return ros_ErrorMsg(-4,Tstart,ZERO);
+   } /* end if */
+   if (IPAR[5] == 0)
+      JacMaxAge = KPP_JAC_MAXAGE;
+   else
+      JacMaxAge = IPAR[5];
+   if (IPAR[5] < 0) {
+      printf("\n User-selected JacMaxAge: IPAR[5]=%d\n", IPAR[5]);
+      return ros_ErrorMsg(-4,Tstart,ZERO);
+   } /* end if */
   /*~~~>  Check if tolerances are reasonable */
     for (i = 0; i < UplimTol; i++) {
       if ( (AbsTol[i] <= ZERO)  ||  (RelTol[i] <= 10.0*Roundoff)
@@ -448,7 +536,7 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
    } /* end switch */
 
   /*~~~>  Rosenbrock method   */
-   IERR = RosenbrockIntegrator( Y,Tstart,Tend,
+   IERR = RosenbrockIntegrator( ctx, Y,Tstart,Tend,
         AbsTol, RelTol,
         ode_Fun,ode_Jac ,
       /*  Rosenbrock method coefficients  */     
@@ -458,19 +546,22 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
         Autonomous, VectorTol, Max_no_steps,
         Roundoff, Hmin, Hmax, Hstart,
         FacMin, FacMax, FacRej, FacSafe, 
+        ThetaMin, JacMaxAge,
       /* Output parameters */ 
 	&Texit, &Hexit );
 
 
   /*~~~>  Collect run statistics */
-   IPAR[10] = Nfun;
-   IPAR[11] = Njac;
-   IPAR[12] = Nstp;
-   IPAR[13] = Nacc;
-   IPAR[14] = Nrej;
-   IPAR[15] = Ndec;
-   IPAR[16] = Nsol;
-   IPAR[17] = Nsng;
+   IPAR[10] = ctx->Nfun;
+   IPAR[11] = ctx->Njac;
+   IPAR[12] = ctx->Nstp;
+   IPAR[13] = ctx->Nacc;
+   IPAR[14] = ctx->Nrej;
+   IPAR[15] = ctx->Ndec;
+   IPAR[16] = ctx->Nsol;
+   IPAR[17] = ctx->Nsng;
+   IPAR[18] = ctx->Nreu;
+   IPAR[19] = ctx->Nfrz;
   /*~~~> Last T and H */
    RPAR[10] = Texit;
    RPAR[11] = Hexit;    
@@ -482,6 +573,8 @@ int Rosenbrock(double Y[], double Tstart, double Tend,
    
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 int RosenbrockIntegrator(
+  /*~~~> Input/Output: integration context (statistics) */
+     KppContext *ctx,
   /*~~~> Input: the initial condition at Tstart; Output: the solution at T */  
      double Y[],
   /*~~~> Input: integration interval */   
@@ -489,8 +582,8 @@ int RosenbrockIntegrator(
   /*~~~> Input: tolerances  */        
      double  AbsTol[], double  RelTol[],
   /*~~~> Input: ode function and its Jacobian */      
-     void (*ode_Fun)(double, double [], double []), 
-     void (*ode_Jac)(double, double [], double []) ,
+     void (*ode_Fun)(KppContext*, double, double [], double []), 
+     void (*ode_Jac)(KppContext*, double, double [], double []) ,
   /*~~~> Input: The Rosenbrock method parameters */   
      int ros_S,
      double ros_M[], double ros_E[], 
@@ -502,6 +595,8 @@ int RosenbrockIntegrator(
      int Max_no_steps,  
      double Roundoff, double Hmin, double Hmax, double Hstart,
      double FacMin, double FacMax, double FacRej, double FacSafe, 
+  /*~~~> Input: Jacobian reuse threshold and maximum age */
+     double ThetaMin, int JacMaxAge,
   /*~~~> Output: time at which the solution is returned (T=Tend  if success)   
              and last accepted step  */     
      double *Texit, double *Hexit ) 
@@ -521,6 +616,9 @@ int RosenbrockIntegrator(
    double Err, Yerr[127];
    int Pivot[127], Direction, ioffset, j, istage;
    char RejectLastH, RejectMoreH;
+   double GamLU;
+   double Yold[127], Fold[127];
+   int JacAge;
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
    
@@ -538,13 +636,14 @@ int RosenbrockIntegrator(
    } /* end if */		
 
    RejectLastH=0; RejectMoreH=0;
+   JacAge = 0; GamLU = ZERO;
    
   /*~~~> Time loop begins below  */ 
 
    while ( ( (Direction > 0) && ((T-Tend)+Roundoff <= ZERO) )
        || ( (Direction < 0) && ((Tend-T)+Roundoff <= ZERO) ) ) { 
       
-   if ( Nstp > Max_no_steps )  {                /* Too many steps */
+   if ( ctx->Nstp > Max_no_steps )  {                /* Too many steps */
         *Texit = T;
 	return ros_ErrorMsg(-6,T,H);
    }	
@@ -558,21 +657,33 @@ int RosenbrockIntegrator(
    H = MIN(H,ABS(Tend-T));
 
   /*~~~>   Compute the function at current time  */
-   (*ode_Fun)(T,Y,Fcn0);
+   (*ode_Fun)(ctx,T,Y,Fcn0);
 
   /*~~~>  Compute the function derivative with respect to T  */
    if (!Autonomous) 
-      ros_FunTimeDerivative ( T, Roundoff, Y, Fcn0, ode_Fun, dFdT );
+      ros_FunTimeDerivative ( ctx, T, Roundoff, Y, Fcn0, ode_Fun, dFdT );
   
-  /*~~~>   Compute the Jacobian at current time  */
-   (*ode_Jac)(T,Y,Jac0);
+  /*~~~>   Compute the Jacobian at current time, unless the previous
+             one still linearizes F accurately over the last step */
+   if ( ( JacAge > 0 ) && ( JacAge < JacMaxAge ) && ( ThetaMin > ZERO )
+     && ( ros_JacChange( Jac0, Yold, Y, Fold, Fcn0,
+                         AbsTol, RelTol, VectorTol ) < ThetaMin ) ) {
+      JacAge++;
+      ctx->Nfrz++;
+   } else {
+      (*ode_Jac)(ctx,T,Y,Jac0);
+      JacAge = 1;
+      GamLU = ZERO; /* Ghimj no longer matches Jac0 */
+   }
+   WCOPY(127,Y,1,Yold,1);
+   WCOPY(127,Fcn0,1,Fold,1);
  
   /*~~~>  Repeat step calculation until current step accepted  */
    while (1) { /* WHILE STEP NOT ACCEPTED */
 
    
-   if( ros_PrepareMatrix( &H, Direction, ros_Gamma[0],
-          Jac0, Ghimj, Pivot) ) { /* More than 5 consecutive failed decompositions */
+   if( ros_PrepareMatrix( ctx, &H, Direction, ros_Gamma[0],
+          Jac0, Ghimj, Pivot, &GamLU ) ) { /* More than 5 consecutive failed decompositions */
        *Texit = T;
        return ros_ErrorMsg(-8,T,H);
    }
@@ -593,7 +704,7 @@ int RosenbrockIntegrator(
 	     WAXPY(127,ros_A[(istage-1)*(istage-2)/2+j-1],
                    &K[127*(j-1)],1,Ynew,1); 
 	   Tau = T + ros_Alpha[istage-1]*Direction*H;
-           (*ode_Fun)(Tau,Ynew,Fcn);
+           (*ode_Fun)(ctx,Tau,Ynew,Fcn);
 	} /*end if ros_NewF(istage)*/
       } /* end if istage */
 	 
@@ -608,7 +719,7 @@ int RosenbrockIntegrator(
 	WAXPY(127,HG,dFdT,1,&K[ioffset],1);
       } /* end if !Autonomous */
       
-      SolveTemplate(Ghimj, Pivot, &K[ioffset]);
+      SolveTemplate(ctx, Ghimj, Pivot, &K[ioffset]);
 	 
    } /* for istage */	    
 	    
@@ -629,9 +740,9 @@ int RosenbrockIntegrator(
    Hnew = H*Fac;  
 
   /*~~~>  Check the error magnitude and adjust step size  */
-   Nstp++;
+   ctx->Nstp++;
    if ( (Err <= ONE) || (H <= Hmin) ) {    /*~~~> Accept step  */
-      Nacc++;
+      ctx->Nacc++;
       WCOPY(127,Ynew,1,Y,1);
       T += Direction*H;
       Hnew = MAX(Hmin,MIN(Hnew,Hmax));
@@ -642,12 +753,18 @@ int RosenbrockIntegrator(
       H = Hnew;
 	 break; /* EXIT THE LOOP: WHILE STEP NOT ACCEPTED */
    } else {             /*~~~> Reject step  */
-      if (Nacc >= 1) 
-         Nrej++;    
+      if (ctx->Nacc >= 1) 
+         ctx->Nrej++;    
       if (RejectMoreH) 
          Hnew=H*FacRej;   
       RejectMoreH = RejectLastH; RejectLastH = 1;
       H = Hnew;
+      /* The step may have failed because of a previous Jacobian */
+      if (JacAge > 1) {
+         (*ode_Jac)(ctx,T,Y,Jac0);
+         JacAge = 1;
+         GamLU = ZERO;
+      } /* end if JacAge */
    } /* end if Err <= 1 */
 
    } /* while LOOP: WHILE STEP NOT ACCEPTED */
@@ -693,12 +810,53 @@ double ros_ErrorNorm (
 } /* ros_ErrorNorm */
 
 
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+double ros_JacChange ( 
+  /*~~~> Input arguments */  
+     double Jac0[],
+     double Yold[], double Y[], double Fold[], double Fcn0[],
+     double AbsTol[], double RelTol[], char VectorTol )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+        Estimates how far Jac0 is from the current Jacobian, as the
+        scaled norm of the linearization error over the last step
+           | F(Y) - F(Yold) - Jac0*(Y-Yold) | / | F(Y) - F(Yold) |
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
+{   	 
+  /*~~~> Local variables */     
+   double R[127], Num, Den, Scale;
+   int i, k;
+   
+   for (i=0; i<127; i++)
+     R[i] = Fcn0[i]-Fold[i];
+   for (k=0; k<LU_NONZERO; k++)
+     R[LU_IROW[k]] -= Jac0[k]*(Y[LU_ICOL[k]]-Yold[LU_ICOL[k]]);
+
+   Num = ZERO;
+   Den = ZERO;
+   for (i=0; i<127; i++) {
+     if (VectorTol) {
+       Scale = AbsTol[i]+RelTol[i]*MAX(ABS(Y[i]),ABS(Yold[i]));
+     } else {
+       Scale = AbsTol[0]+RelTol[0]*MAX(ABS(Y[i]),ABS(Yold[i]));
+     } /* end if */
+     Num = Num+(R[i]*R[i])/(Scale*Scale);
+     Den = Den+((Fcn0[i]-Fold[i])*(Fcn0[i]-Fold[i]))/(Scale*Scale);
+   } /* for i */
+
+   if (Den == ZERO)
+     return (Num == ZERO) ? ZERO : ONE;
+
+   return SQRT(Num/Den);
+   
+} /* ros_JacChange */
+
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 void ros_FunTimeDerivative ( 
     /*~~~> Input arguments: */ 
-        double T, double Roundoff, 
+        KppContext *ctx, double T, double Roundoff, 
         double Y[], double Fcn0[], 
-	void (*ode_Fun)(double, double [], double []), 
+	void (*ode_Fun)(KppContext*, double, double [], double []), 
     /*~~~> Output arguments: */ 
         double dFdT[] )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -709,7 +867,7 @@ void ros_FunTimeDerivative (
    double Delta;    
    
    Delta = SQRT(Roundoff)*MAX(DeltaMin,ABS(T));
-   (*ode_Fun)(T+Delta,Y,dFdT);
+   (*ode_Fun)(ctx,T+Delta,Y,dFdT);
    WAXPY(127,(-ONE),Fcn0,1,dFdT,1);
    WSCAL(127,(ONE/Delta),dFdT,1);
 
@@ -718,12 +876,17 @@ void ros_FunTimeDerivative (
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
 char ros_PrepareMatrix (
+       /* Inout argument: integration context (statistics) */
+           KppContext *ctx,
        /* Inout argument: (step size is decreased when LU fails) */  
            double* H, 
        /* Input arguments: */    
            int Direction,  double gam, double Jac0[], 
        /* Output arguments: */	  
-           double Ghimj[], int Pivot[] )
+           double Ghimj[], int Pivot[],
+       /* Inout argument: Direction*H*gam of the factorization held in
+          Ghimj, ZERO if Ghimj does not hold a factorization of Jac0 */
+           double *GamLU )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   Prepares the LHS matrix for stage calculations
   1.  Construct Ghimj = 1/(H*ham) - Jac0
@@ -732,6 +895,8 @@ char ros_PrepareMatrix (
        -half the step size if LU decomposition fails and retry
        -exit after 5 consecutive fails
 
+  The factorization is reused as is if Jac0 and H*gam are unchanged.
+
   Return value:       Singular (true=1=failed_LU or false=0=successful_LU)
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
 {   
@@ -739,7 +904,13 @@ char ros_PrepareMatrix (
    int i, ising, Nconsecutive;
    double ghinv;
    
+   if ( ( *GamLU != ZERO ) && ( *GamLU == Direction*(*H)*gam ) ) {
+      ctx->Nreu++;
+      return 0;
+   }
+
    Nconsecutive = 0;
+   *GamLU = ZERO;
    
    while (1) {  /* while Singular */
    
@@ -751,13 +922,14 @@ char ros_PrepareMatrix (
        Ghimj[LU_DIAG[i]] = Ghimj[LU_DIAG[i]]+ghinv;
      } /* for i */
   /*~~~>    Compute LU decomposition  */
-     DecompTemplate( Ghimj, Pivot, &ising );
+     DecompTemplate( ctx, Ghimj, Pivot, &ising );
      if (ising == 0) {
   /*~~~>    if successful done  */
+        *GamLU = Direction*(*H)*gam;
         return 0;  /* Singular = false */
      } else { /* ising .ne. 0 */
   /*~~~>    if unsuccessful half the step size; if 5 consecutive fails return */
-        Nsng++; Nconsecutive++;
+        ctx->Nsng++; Nconsecutive++;
         printf("\nWarning: LU Decomposition returned ising = %d\n",ising);
         if (Nconsecutive <= 5) { /* Less than 5 consecutive failed LUs */
           *H = (*H)*HALF;
@@ -1185,21 +1357,24 @@ void Rodas4 ( int *ros_S, double ros_A[], double ros_C[],
    
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
-void DecompTemplate( double A[], int Pivot[], int* ising )
+void DecompTemplate( KppContext *ctx, double A[], int Pivot[], int* ising )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  
         Template for the LU decomposition   
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
 {   
-   *ising = KppDecomp ( A );
+   if ( ctx->IPAR[4] == KPP_DECOMP_SCHEDULED )
+     *ising = KppDecompScheduled ( A );
+   else
+     *ising = KppDecomp ( A );
   /*~~~> Note: for a full matrix use Lapack:
       DGETRF( 127, 127, A, 127, Pivot, ising ) */
     
-   Ndec++;
+   ctx->Ndec++;
 
 }  /*  DecompTemplate */
  
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
- void SolveTemplate( double A[], int Pivot[], double b[] )
+ void SolveTemplate( KppContext *ctx, double A[], int Pivot[], double b[] )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~  
      Template for the forward/backward substitution (using pre-computed LU decomposition)   
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
@@ -1209,13 +1384,13 @@ void DecompTemplate( double A[], int Pivot[], int* ising )
       NRHS = 1
       DGETRS( 'N', 127 , NRHS, A, 127, Pivot, b, 127, INFO ) */
      
-   Nsol++;
+   ctx->Nsol++;
 
 }  /*  SolveTemplate */
 
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
-void FunTemplate( double T, double Y[], double Ydot[] )
+void FunTemplate( KppContext *ctx, double T, double Y[], double Ydot[] )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ 
     Template for the ODE function call.
     Updates the rate coefficients (and possibly the fixed species) at each call    
@@ -1223,24 +1398,24 @@ void FunTemplate( double T, double Y[], double Ydot[] )
 {
    double Told;     
 
-   Told = TIME;
-   TIME = T;
+   Told = ctx->TIME;
+   ctx->TIME = T;
    /* 10/18/2018 - T.Fritz: Calls to Update_SUN and Update_RCONST have been removed.
     * SUN is now computed before calling KPP and incorporated in the photolysis rates
     * RCONST is also computed before calling KPP as the rates don't change during the integration.
     * see: http://wiki.seas.harvard.edu/geos-chem/index.php/FlexChem#Remove_calls_to_UPDATE_SUN.2C_UPDATE_RCONST_from_gckpp_Integrator.F90 */
    //Update_SUN();
    //Update_RCONST();
-   Fun( Y, FIX, RCONST, Ydot );
-   TIME = Told;
+   Fun( *ctx, Y, Ydot );
+   ctx->TIME = Told;
      
-   Nfun++;
+   ctx->Nfun++;
    
 }  /*  FunTemplate */
 
  
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/   
-void JacTemplate( double T, double Y[], double Jcb[] )
+void JacTemplate( KppContext *ctx, double T, double Y[], double Jcb[] )
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~   
     Template for the ODE Jacobian call.
     Updates the rate coefficients (and possibly the fixed species) at each call    
@@ -1249,18 +1424,18 @@ void JacTemplate( double T, double Y[], double Jcb[] )
   /*~~~> Local variables */
    double Told;     
 
-   Told = TIME;
-   TIME = T ; 
+   Told = ctx->TIME;
+   ctx->TIME = T ; 
    /* 10/18/2018 - T.Fritz: Calls to Update_SUN and Update_RCONST have been removed.
     * SUN is now computed before calling KPP and incorporated in the photolysis rates
     * RCONST is also computed before calling KPP as the rates don't change during the integration.
     * see: http://wiki.seas.harvard.edu/geos-chem/index.php/FlexChem#Remove_calls_to_UPDATE_SUN.2C_UPDATE_RCONST_from_gckpp_Integrator.F90 */
    //Update_SUN();
    //Update_RCONST();
-   Jac_SP( Y, FIX, RCONST, Jcb );
-   TIME = Told;
+   Jac_SP( *ctx, Y, Jcb );
+   ctx->TIME = Told;
      
-   Njac++;
+   ctx->Njac++;
 
 } /* JacTemplate   */                                    
 
@@ -0,0 +1,767 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* KPP_IntegratorBatch Program File                                 */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : KPP_IntegratorBatch.cpp                   */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+#include "KPP/KPP.hpp"
+#include "KPP/KPP_Parameters.h"
+#include "KPP/KPP_Global.h"
+#include "KPP/KPP_Sparse.h"
+
+ #define MAX(a,b) ( ((a) >= (b)) ?(a):(b)  )
+ #define MIN(b,c) ( ((b) <  (c)) ?(b):(c)  )
+ #define ABS(x)   ( ((x) >=  0 ) ?(x):(-x) )
+
+ #define  ZERO     (double)0.0
+ #define  ONE      (double)1.0
+ #define  HALF     (double)0.5
+ #define  DeltaMin (double)1.0e-6
+
+ /* Maximum number of reactant factors in a mass action term */
+ #define NFACMAX   4
+
+ /* Routines from the generated KPP files */
+ void ReactantProd( double V[], double F[], double ARP[] );
+ void Rodas4 ( int *ros_S, double ros_A[], double ros_C[],
+               double ros_M[], double ros_E[],
+               double ros_Alpha[], double ros_Gamma[],
+               char ros_NewF[], double *ros_ELO, char* ros_Name );
+ double WLAMCH( char C );
+ int ros_ErrorMsg( int Code, double T, double H );
+
+/* Lane-wise data is stored species-major, i.e. X[ N*NB + l ] is species N
+ * in lane l, so that every inner loop runs over contiguous lanes. */
+ #define NB KPP_NBATCH
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   Mass action tables
+
+   The generated Fun, Jac_SP and KppSolve are unrolled for one cell. The
+   batched kernels use the same mechanism and sparsity in table form:
+    - reaction r proceeds at RCT[r] * prod_p X[ BAT_FAC[r][p] ], where
+      factors < NVAR are variable species and the others fixed species
+      (offset by NVAR). The factors are recovered once from ReactantProd;
+    - Vdot and the Jacobian are gathered row by row through the
+      stoichiometric matrix (STOICM), onto the LU pattern of
+      KPP_JacobianSP;
+    - the LU elimination of KppDecomp is unrolled into a list of
+      in-place updates, which removes the dense work row.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+ static int BAT_NFAC[NREACT];
+ static int BAT_FAC[NREACT][NFACMAX];
+
+ /* Vdot[i] = sum over BAT_FUN_PTR[i] <= s < BAT_FUN_PTR[i+1] of
+  * BAT_FUN_COEF[s] * A[BAT_FUN_REACT[s]] */
+ static std::vector<int>    BAT_FUN_PTR, BAT_FUN_REACT;
+ static std::vector<double> BAT_FUN_COEF;
+
+ /* Partial derivatives dA_r/dV_j: reaction and factor position */
+ static std::vector<int>    BAT_DER_REACT, BAT_DER_FAC;
+
+ /* JVS[k] = sum over BAT_JAC_PTR[k] <= s < BAT_JAC_PTR[k+1] of
+  * BAT_JAC_COEF[s] * D[BAT_JAC_DER[s]] */
+ static std::vector<int>    BAT_JAC_PTR, BAT_JAC_DER;
+ static std::vector<double> BAT_JAC_COEF;
+
+ /* Elimination e of row BAT_LU_ROW[e] scales entry BAT_LU_MULT[e] by the
+  * pivot BAT_LU_PIV[e], then updates JVS[BAT_LU_DST[u]] -= JVS[mult] *
+  * JVS[BAT_LU_SRC[u]] for BAT_LU_PTR[e] <= u < BAT_LU_PTR[e+1] */
+ static std::vector<int>    BAT_LU_ROW, BAT_LU_MULT, BAT_LU_PIV, BAT_LU_PTR;
+ static std::vector<int>    BAT_LU_DST, BAT_LU_SRC;
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static int LU_Index( const int i, const int j )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Position of entry (i,j) in the LU pattern, exits if missing
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int kk;
+
+   for (kk = LU_CROW[i]; kk < LU_CROW[i+1]; kk++)
+     if ( LU_ICOL[kk] == j )
+       return kk;
+
+   printf("\n INTEGRATE_BATCH: entry (%d,%d) missing from the LU pattern\n", i, j);
+   exit(-1);
+
+}  /* LU_Index */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static int BatchTables_Init( )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Builds the tables. Each reactant product is a monomial, so doubling
+    one species at a time from unit concentrations returns
+    2^(order of that species) exactly. Returns 1
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   double V[NVAR], F[NFIX], ARP[NREACT];
+   int i, j, r, p, s, e, k, kk, jj;
+
+   for (r = 0; r < NREACT; r++)
+     BAT_NFAC[r] = 0;
+
+   for (j = 0; j < NVAR+NFIX; j++) {
+     for (i = 0; i < NVAR; i++) V[i] = ONE;
+     for (i = 0; i < NFIX; i++) F[i] = ONE;
+     if ( j < NVAR ) V[j] = 2.0;
+     else            F[j-NVAR] = 2.0;
+
+     ReactantProd( V, F, ARP );
+
+     for (r = 0; r < NREACT; r++) {
+       e = (int) floor( log( ARP[r] ) / log( 2.0 ) + HALF );
+       if ( ( e < 0 ) || ( ARP[r] != ldexp( ONE, e ) ) ) {
+         printf("\n INTEGRATE_BATCH: reaction %d is not of mass action type\n", r);
+         exit(-1);
+       }
+       for (p = 0; p < e; p++) {
+         if ( BAT_NFAC[r] >= NFACMAX ) {
+           printf("\n INTEGRATE_BATCH: reaction %d has more than %d reactants\n", r, NFACMAX);
+           exit(-1);
+         }
+         BAT_FAC[r][BAT_NFAC[r]++] = j;
+       }
+     }
+   }
+
+  /*~~~> Stoichiometric entries, by variable species */
+   std::vector<std::vector<int> > byRow( NVAR );
+   for (r = 0; r < NREACT; r++)
+     for (s = CCOL_STOICM[r]; s < CCOL_STOICM[r+1]; s++)
+       if ( IROW_STOICM[s] < NVAR )
+         byRow[IROW_STOICM[s]].push_back( s );
+
+   BAT_FUN_PTR.assign( 1, 0 );
+   for (i = 0; i < NVAR; i++) {
+     for (kk = 0; kk < (int) byRow[i].size(); kk++) {
+       s = byRow[i][kk];
+       BAT_FUN_REACT.push_back( ICOL_STOICM[s] );
+       BAT_FUN_COEF.push_back( STOICM[s] );
+     }
+     BAT_FUN_PTR.push_back( BAT_FUN_REACT.size() );
+   }
+
+  /*~~~> Reactant derivatives, by LU entry */
+   std::vector<std::vector<std::pair<int,double> > > byEntry( LU_NONZERO );
+   for (r = 0; r < NREACT; r++) {
+     for (p = 0; p < BAT_NFAC[r]; p++) {
+       j = BAT_FAC[r][p];
+       if ( j >= NVAR )
+         continue;
+       BAT_DER_REACT.push_back( r );
+       BAT_DER_FAC.push_back( p );
+       for (s = CCOL_STOICM[r]; s < CCOL_STOICM[r+1]; s++) {
+         i = IROW_STOICM[s];
+         if ( i < NVAR )
+           byEntry[LU_Index( i, j )].push_back( \
+                std::make_pair( (int) BAT_DER_REACT.size() - 1, STOICM[s] ) );
+       }
+     }
+   }
+
+   BAT_JAC_PTR.assign( 1, 0 );
+   for (k = 0; k < LU_NONZERO; k++) {
+     for (kk = 0; kk < (int) byEntry[k].size(); kk++) {
+       BAT_JAC_DER.push_back( byEntry[k][kk].first );
+       BAT_JAC_COEF.push_back( byEntry[k][kk].second );
+     }
+     BAT_JAC_PTR.push_back( BAT_JAC_DER.size() );
+   }
+
+  /*~~~> LU elimination, in the order of KppDecomp */
+   BAT_LU_PTR.assign( 1, 0 );
+   for (k = 0; k < NVAR; k++) {
+     for (kk = LU_CROW[k]; kk < LU_DIAG[k]; kk++) {
+       j = LU_ICOL[kk];
+       BAT_LU_ROW.push_back( k );
+       BAT_LU_MULT.push_back( kk );
+       BAT_LU_PIV.push_back( LU_DIAG[j] );
+       for (jj = LU_DIAG[j]+1; jj < LU_CROW[j+1]; jj++) {
+         BAT_LU_DST.push_back( LU_Index( k, LU_ICOL[jj] ) );
+         BAT_LU_SRC.push_back( jj );
+       }
+       BAT_LU_PTR.push_back( BAT_LU_DST.size() );
+     }
+   }
+
+   return 1;
+
+}  /* BatchTables_Init */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static inline const double* Factor( const double V[], const double F[], const int j )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   return ( j < NVAR ) ? &V[j*NB] : &F[(j-NVAR)*NB];
+}
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static void FunBatch( const double V[], const double F[], const double RCT[],
+                      double A[], double Vdot[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Batched counterpart of Fun. A(NREACT*NB) is workspace.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int r, p, i, s, l;
+   double acc[NB];
+
+   for (r = 0; r < NREACT; r++) {
+     for (l = 0; l < NB; l++)
+       acc[l] = RCT[r*NB+l];
+     for (p = 0; p < BAT_NFAC[r]; p++) {
+       const double *x = Factor( V, F, BAT_FAC[r][p] );
+       for (l = 0; l < NB; l++)
+         acc[l] *= x[l];
+     }
+     for (l = 0; l < NB; l++)
+       A[r*NB+l] = acc[l];
+   }
+
+   for (i = 0; i < NVAR; i++) {
+     for (l = 0; l < NB; l++)
+       acc[l] = ZERO;
+     for (s = BAT_FUN_PTR[i]; s < BAT_FUN_PTR[i+1]; s++) {
+       const double *a = &A[BAT_FUN_REACT[s]*NB];
+       const double c  = BAT_FUN_COEF[s];
+       for (l = 0; l < NB; l++)
+         acc[l] += c * a[l];
+     }
+     for (l = 0; l < NB; l++)
+       Vdot[i*NB+l] = acc[l];
+   }
+
+}  /* FunBatch */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static void JacBatch( const double V[], const double F[], const double RCT[],
+                      double D[], double JVS[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Batched counterpart of Jac_SP, on the LU pattern (fill-in entries
+    are zero). D(nDer*NB) is workspace.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int d, p, k, s, l;
+   double acc[NB];
+
+   const int nDer = BAT_DER_REACT.size();
+   for (d = 0; d < nDer; d++) {
+     const int r = BAT_DER_REACT[d];
+     for (l = 0; l < NB; l++)
+       acc[l] = RCT[r*NB+l];
+     for (p = 0; p < BAT_NFAC[r]; p++) {
+       if ( p == BAT_DER_FAC[d] )
+         continue;
+       const double *x = Factor( V, F, BAT_FAC[r][p] );
+       for (l = 0; l < NB; l++)
+         acc[l] *= x[l];
+     }
+     for (l = 0; l < NB; l++)
+       D[d*NB+l] = acc[l];
+   }
+
+   for (k = 0; k < LU_NONZERO; k++) {
+     for (l = 0; l < NB; l++)
+       acc[l] = ZERO;
+     for (s = BAT_JAC_PTR[k]; s < BAT_JAC_PTR[k+1]; s++) {
+       const double *dr = &D[BAT_JAC_DER[s]*NB];
+       const double c   = BAT_JAC_COEF[s];
+       for (l = 0; l < NB; l++)
+         acc[l] += c * dr[l];
+     }
+     for (l = 0; l < NB; l++)
+       JVS[k*NB+l] = acc[l];
+   }
+
+}  /* JacBatch */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static void KppDecompBatch( double JVS[], char Sing[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Batched counterpart of KppDecomp. Lanes cannot leave early, so a
+    zero pivot only flags the lane (Sing[l] = 1) and the elimination
+    carries on.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int k, e, u, l;
+   double m[NB];
+
+   for (l = 0; l < NB; l++)
+     Sing[l] = 0;
+
+   const int nElim = BAT_LU_ROW.size();
+   for (k = 0, e = 0; k < NVAR; k++) {
+     /* Same test as KppDecomp, on the diagonal before elimination */
+     const double *dg = &JVS[LU_DIAG[k]*NB];
+     for (l = 0; l < NB; l++)
+       if ( ABS(dg[l]) < 1.00E-40 )
+         Sing[l] = 1;
+     for (; ( e < nElim ) && ( BAT_LU_ROW[e] == k ); e++) {
+       /* Entries of row k are only updated from rows j < k, so the
+        * lanes can be vectorized without alias checks */
+       double *mult      = &JVS[BAT_LU_MULT[e]*NB];
+       const double *piv = &JVS[BAT_LU_PIV[e]*NB];
+       #pragma omp simd
+       for (l = 0; l < NB; l++) {
+         mult[l] /= piv[l];
+         m[l] = mult[l];
+       }
+       for (u = BAT_LU_PTR[e]; u < BAT_LU_PTR[e+1]; u++) {
+         double *dst       = &JVS[BAT_LU_DST[u]*NB];
+         const double *src = &JVS[BAT_LU_SRC[u]*NB];
+         #pragma omp simd
+         for (l = 0; l < NB; l++)
+           dst[l] -= m[l]*src[l];
+       }
+     }
+   }
+
+}  /* KppDecompBatch */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static void KppSolveBatch( const double JVS[], double X[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Batched counterpart of KppSolve
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int i, j, l;
+   double acc[NB];
+
+   for (i = 0; i < NVAR; i++) {
+     for (l = 0; l < NB; l++)
+       acc[l] = X[i*NB+l];
+     for (j = LU_CROW[i]; j < LU_DIAG[i]; j++) {
+       const double *m = &JVS[j*NB];
+       const double *x = &X[LU_ICOL[j]*NB];
+       for (l = 0; l < NB; l++)
+         acc[l] -= m[l]*x[l];
+     }
+     for (l = 0; l < NB; l++)
+       X[i*NB+l] = acc[l];
+   }
+
+   for (i = NVAR-1; i >= 0; i--) {
+     for (l = 0; l < NB; l++)
+       acc[l] = X[i*NB+l];
+     for (j = LU_DIAG[i]+1; j < LU_CROW[i+1]; j++) {
+       const double *m = &JVS[j*NB];
+       const double *x = &X[LU_ICOL[j]*NB];
+       for (l = 0; l < NB; l++)
+         acc[l] -= m[l]*x[l];
+     }
+     const double *dg = &JVS[LU_DIAG[i]*NB];
+     for (l = 0; l < NB; l++)
+       X[i*NB+l] = acc[l]/dg[l];
+   }
+
+}  /* KppSolveBatch */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static void JacChangeBatch( const double Jac0[], const double Yold[],
+                            const double Y[], const double Fold[],
+                            const double Fcn0[], const double ATOL[],
+                            const double RTOL[], double R[], double Theta[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Lane-wise ros_JacChange: scaled norm of the linearization error of
+    Jac0 over the last step of each lane
+       | F(Y) - F(Yold) - Jac0*(Y-Yold) | / | F(Y) - F(Yold) |
+    R (NVAR*NB) is workspace
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   double Num[NB], Den[NB];
+   int i, k, l;
+
+   for (i = 0; i < NVAR*NB; i++)
+     R[i] = Fcn0[i]-Fold[i];
+   for (k = 0; k < LU_NONZERO; k++) {
+     double *r         = &R[LU_IROW[k]*NB];
+     const double *jac = &Jac0[k*NB];
+     const double *y   = &Y[LU_ICOL[k]*NB];
+     const double *y0  = &Yold[LU_ICOL[k]*NB];
+     for (l = 0; l < NB; l++)
+       r[l] -= jac[l]*(y[l]-y0[l]);
+   }
+
+   for (l = 0; l < NB; l++) {
+     Num[l] = ZERO;
+     Den[l] = ZERO;
+   }
+   for (i = 0; i < NVAR; i++) {
+     for (l = 0; l < NB; l++) {
+       const double Scale = ATOL[i]+RTOL[i]*MAX(ABS(Y[i*NB+l]),ABS(Yold[i*NB+l]));
+       const double dF    = Fcn0[i*NB+l]-Fold[i*NB+l];
+       Num[l] += (R[i*NB+l]*R[i*NB+l])/(Scale*Scale);
+       Den[l] += (dF*dF)/(Scale*Scale);
+     }
+   }
+
+   for (l = 0; l < NB; l++) {
+     if ( Den[l] == ZERO )
+       Theta[l] = ( Num[l] == ZERO ) ? ZERO : ONE;
+     else
+       Theta[l] = sqrt(Num[l]/Den[l]);
+   }
+
+}  /* JacChangeBatch */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+int INTEGRATE_BATCH( double VARB[], const double FIXB[], const double RCTB[],
+                     const int nLane, double TIN, double TOUT,
+                     double ATOL[], double RTOL[], double STEPMIN,
+                     double THETAMIN, double HB[], int IERRB[],
+                     int ISTATB[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Rodas4 integration of nLane <= KPP_NBATCH cells in lockstep, with
+    the same settings as INTEGRATE (vector tolerances, default step
+    controls). Inputs are species-major: VARB[N*KPP_NBATCH+l] is
+    variable species N in lane l, and similarly for FIXB (NFIX) and
+    RCTB (NREACT).
+
+    Every lane keeps its own time, step size and rejection history.
+    Lanes that are done or failed keep being computed with their last
+    state, but the results are masked out. Since the rate constants are
+    frozen over the call, F does not depend on T explicitly and the
+    dF/dT term of the non-autonomous formulation vanishes.
+
+    HB[l] is the starting step of lane l, or STEPMIN if zero. On return
+    it holds the last step size of the lane, as RPAR[11] of INTEGRATE,
+    to start the next call from.
+
+    THETAMIN enables Jacobian reuse as in INTEGRATE (RPAR[7]). The
+    Jacobian of all lanes is evaluated at once, so it is only kept when
+    every running lane can keep its own: at a new step, the previous
+    Jacobian still linearizes F to within THETAMIN over the last step
+    (for at most KPP_JAC_MAXAGE steps); when retrying a rejected step,
+    the Jacobian is not a previous one. Otherwise, all lanes get a new
+    one. The LU factorization is not reused.
+
+    IERRB[l] holds the status of each lane, as returned by INTEGRATE,
+    and ISTATB[i*KPP_NBATCH+l] its statistic i, in the KPP_NSTAT layout
+    of KPP.hpp (IPAR[10:19] of INTEGRATE). Evaluations are counted for
+    the lanes they are computed for, so that summing lanes gives the
+    cost of integrating them one by one. The return value is the
+    smallest status.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+
+  /*~~~>  The method parameters    */
+   int ros_S;
+   double ros_M[6], ros_E[6];
+   double ros_A[15], ros_C[15];
+   double ros_Alpha[6], ros_Gamma[6], ros_ELO;
+   char ros_NewF[6], ros_Name[12];
+  /*~~~>  Local variables    */
+   const int    Max_no_steps = 500000;
+   const double FacMin = 0.2, FacMax = 6.0, FacRej = 0.1, FacSafe = 0.9;
+   const double Hmin = ZERO;
+   double Roundoff, Hmax, Hstart;
+   double T[NB], H[NB], Hnew[NB], Hexit[NB], ghinv[NB], Err[NB], Theta[NB];
+   int Stat[KPP_NSTAT][NB], Nconsecutive[NB], JacAge[NB];
+   char RejectLastH[NB], RejectMoreH[NB], Running[NB], Fresh[NB], Sing[NB];
+   int Direction, istage, i, j, l, N, IERR;
+
+  /*~~~>  The tables are built by the first call. Initialization of a
+          local static is thread-safe, and only costs a check afterwards */
+   static const int BAT_INIT = BatchTables_Init();
+   (void) BAT_INIT;
+
+   if ( ( nLane < 1 ) || ( nLane > NB ) ) {
+     printf("\n INTEGRATE_BATCH: number of lanes %d not in [1, %d]\n", nLane, NB);
+     exit(-1);
+   }
+
+   std::vector<double> Y( NVAR*NB ), Ynew( NVAR*NB ), Fcn0( NVAR*NB ), Fcn( NVAR*NB );
+   std::vector<double> K( 6*NVAR*NB ), Yerr( NVAR*NB );
+   std::vector<double> FX( NFIX*NB ), RCT( NREACT*NB ), A( NREACT*NB );
+   std::vector<double> D( BAT_DER_REACT.size()*NB );
+   std::vector<double> Jac0( LU_NONZERO*NB ), Ghimj( LU_NONZERO*NB );
+   std::vector<double> Yold( NVAR*NB ), Fold( NVAR*NB ), R( NVAR*NB );
+
+  /*~~~>  Padding lanes replicate the first one, to keep arithmetic finite */
+   for (l = 0; l < NB; l++) {
+     const int src = ( l < nLane ) ? l : 0;
+     for (N = 0; N < NVAR; N++)
+       Y[N*NB+l] = VARB[N*NB+src];
+     for (N = 0; N < NFIX; N++)
+       FX[N*NB+l] = FIXB[N*NB+src];
+     for (N = 0; N < NREACT; N++)
+       RCT[N*NB+l] = RCTB[N*NB+src];
+   }
+
+   Rodas4(&ros_S, ros_A, ros_C, ros_M, ros_E,
+          ros_Alpha, ros_Gamma, ros_NewF, &ros_ELO, ros_Name);
+
+   Roundoff  = WLAMCH('E');
+   Direction = ( TOUT >= TIN ) ? +1 : -1;
+   Hmax      = ABS(TOUT-TIN);
+   Hstart    = ( STEPMIN == ZERO ) ? MAX(Hmin,DeltaMin) : MIN(ABS(STEPMIN),Hmax);
+   if ( ABS(Hstart) <= 10.0*Roundoff )
+     Hstart = DeltaMin;
+
+   for (l = 0; l < NB; l++) {
+     T[l]    = TIN;
+     H[l]    = ( ( l < nLane ) && ( HB[l] > ZERO ) ) ? MIN(HB[l],Hmax) : MIN(Hstart,Hmax);
+     Hexit[l] = ZERO;
+     for (i = 0; i < KPP_NSTAT; i++)
+       Stat[i][l] = 0;
+     JacAge[l] = 0;
+     RejectLastH[l] = 0;
+     RejectMoreH[l] = 0;
+     Running[l]     = ( l < nLane );
+     Fresh[l]       = 1;
+     IERRB[l]       = 1;
+   }
+
+  /*~~~> Time loop begins below  */
+   while (1) {
+
+     char anyRunning = 0, anyFresh = 0;
+
+     for (l = 0; l < NB; l++) {
+       if ( !Running[l] )
+         continue;
+       if ( !( ( (Direction > 0) && ((T[l]-TOUT)+Roundoff <= ZERO) )
+            || ( (Direction < 0) && ((TOUT-T[l])+Roundoff <= ZERO) ) ) ) {
+         Running[l] = 0;                             /* Lane is done */
+         continue;
+       }
+       if ( Stat[KPP_NSTP][l] > Max_no_steps ) {     /* Too many steps */
+         IERRB[l] = ros_ErrorMsg(-6,T[l],H[l]);
+         Running[l] = 0;
+         continue;
+       }
+       if ( ((T[l]+0.1*H[l]) == T[l]) || (H[l] <= Roundoff) ) { /* Step size too small */
+         IERRB[l] = ros_ErrorMsg(-7,T[l],H[l]);
+         Running[l] = 0;
+         continue;
+       }
+       if ( Fresh[l] ) {
+         /*~~~>  Limit H if necessary to avoid going beyond TOUT   */
+         Hexit[l] = H[l];
+         H[l] = MIN(H[l],ABS(TOUT-T[l]));
+         anyFresh = 1;
+       }
+       anyRunning = 1;
+     }
+
+     if ( !anyRunning )
+       break;
+
+    /*~~~>   Function at the current state. Lanes that are retrying a
+             step get back the same values */
+     if ( anyFresh ) {
+       FunBatch( &Y[0], &FX[0], &RCT[0], &A[0], &Fcn0[0] );
+       for (l = 0; l < NB; l++)
+         Stat[KPP_NFUN][l] += ( Running[l] && Fresh[l] );
+     }
+
+    /*~~~>   Jacobian at the current state, unless all running lanes can
+             keep the previous one. The linearization error is only
+             estimated if no lane needs a new Jacobian regardless */
+     char anyJac = 0;
+     for (l = 0; l < NB; l++) {
+       if ( !Running[l] )
+         continue;
+       if ( Fresh[l] )
+         anyJac |= !( ( JacAge[l] > 0 ) && ( JacAge[l] < KPP_JAC_MAXAGE )
+                   && ( THETAMIN > ZERO ) );
+       else
+         /* The step may have failed because of a previous Jacobian */
+         anyJac |= ( JacAge[l] > 1 );
+     }
+     if ( !anyJac && anyFresh ) {
+       JacChangeBatch( &Jac0[0], &Yold[0], &Y[0], &Fold[0], &Fcn0[0],
+                       ATOL, RTOL, &R[0], Theta );
+       for (l = 0; l < NB; l++)
+         anyJac |= ( Running[l] && Fresh[l] && !( Theta[l] < THETAMIN ) );
+     }
+
+     if ( anyJac ) {
+       JacBatch( &Y[0], &FX[0], &RCT[0], &D[0], &Jac0[0] );
+       for (l = 0; l < NB; l++) {
+         JacAge[l] = 1;
+         Stat[KPP_NJAC][l] += Running[l];
+       }
+     } else {
+       for (l = 0; l < NB; l++) {
+         if ( Running[l] && Fresh[l] ) {
+           JacAge[l]++;
+           Stat[KPP_NFRZ][l]++;
+         }
+       }
+     }
+
+     if ( anyFresh ) {
+       Yold = Y;
+       Fold = Fcn0;
+     }
+
+    /*~~~>  Ghimj = 1/(H*gam) - Jac0, halving H of singular lanes */
+     for (l = 0; l < NB; l++)
+       Nconsecutive[l] = 0;
+     while (1) {
+       char anySing = 0;
+       for (l = 0; l < NB; l++)
+         ghinv[l] = ONE/(Direction*H[l]*ros_Gamma[0]);
+       for (j = 0; j < LU_NONZERO*NB; j++)
+         Ghimj[j] = -Jac0[j];
+       for (N = 0; N < NVAR; N++)
+         for (l = 0; l < NB; l++)
+           Ghimj[LU_DIAG[N]*NB+l] += ghinv[l];
+       KppDecompBatch( &Ghimj[0], Sing );
+       for (l = 0; l < NB; l++) {
+         if ( !Running[l] )
+           continue;
+         Stat[KPP_NDEC][l]++;
+         if ( !Sing[l] )
+           continue;
+         Stat[KPP_NSNG][l]++;
+         printf("\nWarning: LU Decomposition returned ising != 0 for lane %d\n",l);
+         if ( ++Nconsecutive[l] <= 5 ) {
+           H[l] *= HALF;
+           anySing = 1;
+         } else {
+           IERRB[l] = ros_ErrorMsg(-8,T[l],H[l]);
+           Running[l] = 0;
+         }
+       }
+       if ( !anySing )
+         break;
+     }
+
+    /*~~~>   Compute the stages  */
+     for (istage = 1; istage <= ros_S; istage++) {
+
+       double *Ki = &K[NVAR*NB*(istage-1)];
+
+       if ( istage == 1 )
+         Fcn = Fcn0;
+       else if ( ros_NewF[istage-1] ) {
+         Ynew = Y;
+         for (j = 1; j <= istage-1; j++) {
+           const double a   = ros_A[(istage-1)*(istage-2)/2+j-1];
+           const double *Kj = &K[NVAR*NB*(j-1)];
+           for (N = 0; N < NVAR*NB; N++)
+             Ynew[N] += a*Kj[N];
+         }
+         FunBatch( &Ynew[0], &FX[0], &RCT[0], &A[0], &Fcn[0] );
+         for (l = 0; l < NB; l++)
+           Stat[KPP_NFUN][l] += Running[l];
+       }
+
+       for (N = 0; N < NVAR*NB; N++)
+         Ki[N] = Fcn[N];
+       for (j = 1; j <= istage-1; j++) {
+         const double c   = ros_C[(istage-1)*(istage-2)/2+j-1];
+         const double *Kj = &K[NVAR*NB*(j-1)];
+         double HC[NB];
+         for (l = 0; l < NB; l++)
+           HC[l] = c/(Direction*H[l]);
+         for (N = 0; N < NVAR; N++)
+           for (l = 0; l < NB; l++)
+             Ki[N*NB+l] += HC[l]*Kj[N*NB+l];
+       }
+
+       KppSolveBatch( &Ghimj[0], Ki );
+       for (l = 0; l < NB; l++)
+         Stat[KPP_NSOL][l] += Running[l];
+
+     }
+
+    /*~~~>  Compute the new solution and the error estimation  */
+     Ynew = Y;
+     for (N = 0; N < NVAR*NB; N++)
+       Yerr[N] = ZERO;
+     for (j = 1; j <= ros_S; j++) {
+       const double *Kj = &K[NVAR*NB*(j-1)];
+       for (N = 0; N < NVAR*NB; N++) {
+         Ynew[N] += ros_M[j-1]*Kj[N];
+         Yerr[N] += ros_E[j-1]*Kj[N];
+       }
+     }
+
+     for (l = 0; l < NB; l++)
+       Err[l] = ZERO;
+     for (N = 0; N < NVAR; N++) {
+       for (l = 0; l < NB; l++) {
+         const double Ymax  = MAX(ABS(Y[N*NB+l]),ABS(Ynew[N*NB+l]));
+         const double Scale = ATOL[N]+RTOL[N]*Ymax;
+         Err[l] += (Yerr[N*NB+l]*Yerr[N*NB+l])/(Scale*Scale);
+       }
+     }
+
+    /*~~~>  Accept or reject, lane by lane  */
+     for (l = 0; l < NB; l++) {
+
+       if ( !Running[l] )
+         continue;
+
+       Err[l] = sqrt(Err[l]/(double)NVAR);
+
+      /*~~~> New step size is bounded by FacMin <= Hnew/H <= FacMax  */
+       const double Fac = MIN(FacMax,MAX(FacMin,FacSafe/pow(Err[l],ONE/ros_ELO)));
+       Hnew[l] = H[l]*Fac;
+
+       Stat[KPP_NSTP][l]++;
+       if ( (Err[l] <= ONE) || (H[l] <= Hmin) ) {    /*~~~> Accept step  */
+         Stat[KPP_NACC][l]++;
+         for (N = 0; N < NVAR; N++)
+           Y[N*NB+l] = Ynew[N*NB+l];
+         T[l] += Direction*H[l];
+         Hnew[l] = MAX(Hmin,MIN(Hnew[l],Hmax));
+         /* No step size increase after a rejected step  */
+         if ( RejectLastH[l] )
+           Hnew[l] = MIN(Hnew[l],H[l]);
+         RejectLastH[l] = 0; RejectMoreH[l] = 0;
+         Fresh[l] = 1;
+       } else {                                     /*~~~> Reject step  */
+         if ( Stat[KPP_NACC][l] >= 1 )
+           Stat[KPP_NREJ][l]++;
+         if ( RejectMoreH[l] )
+           Hnew[l] = H[l]*FacRej;
+         RejectMoreH[l] = RejectLastH[l]; RejectLastH[l] = 1;
+         Fresh[l] = 0;
+       }
+       H[l] = Hnew[l];
+
+     }
+
+   } /* while: time loop */
+
+   IERR = 1;
+   for (l = 0; l < nLane; l++) {
+     for (N = 0; N < NVAR; N++)
+       VARB[N*NB+l] = Y[N*NB+l];
+     HB[l] = Hexit[l];
+     for (i = 0; i < KPP_NSTAT; i++)
+       ISTATB[i*NB+l] = Stat[i][l];
+     IERR = MIN(IERR,IERRB[l]);
+   }
+
+   return IERR;
+
+} /* INTEGRATE_BATCH */
+
+/* End of KPP_IntegratorBatch.cpp */
@@ -0,0 +1,155 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* KPP_LUSchedule Program File                                      */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : KPP_LUSchedule.cpp                        */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "KPP/KPP.hpp"
+#include "KPP/KPP_Parameters.h"
+#include "KPP/KPP_Sparse.h"
+
+ #define ABS(x)   ( ((x) >=  0 ) ?(x):(-x) )
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   Scheduled LU decomposition
+
+   KppDecomp scatters each row into a dense work row, eliminates it and
+   gathers it back, looking the pattern up through LU_ICOL on every
+   call. The pattern is fixed, so the symbolic part is done once:
+    - every elimination of row k by pivot row j is stored as the
+      multiplier and pivot positions, followed by the positions of the
+      updated entries of row k and of their sources in row j, which
+      removes the dense work row;
+    - the last rows of the mechanism form a dense block (the trailing
+      supernode), which is stored contiguously at the end of each row.
+      Eliminations inside that block are done by a dense kernel.
+   The operations and their order are those of KppDecomp, so that both
+   return the same factors.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+ /* Elimination e of row LUS_ROW[e] divides JVS[LUS_MULT[e]] by
+  * JVS[LUS_PIV[e]], then updates JVS[LUS_DST[u]] -= JVS[mult] *
+  * JVS[LUS_SRC[u]] for LUS_PTR[e] <= u < LUS_PTR[e+1] */
+ static std::vector<int> LUS_ROW, LUS_MULT, LUS_PIV, LUS_PTR;
+ static std::vector<int> LUS_DST, LUS_SRC;
+
+ /* Rows and columns LUS_DENSE0 to NVAR-1 form a dense block */
+ static int LUS_DENSE0 = NVAR;
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static int LUS_Index( const int i, const int j )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Position of entry (i,j) in the LU pattern, exits if missing
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int kk;
+
+   for (kk = LU_CROW[i]; kk < LU_CROW[i+1]; kk++)
+     if ( LU_ICOL[kk] == j )
+       return kk;
+
+   printf("\n KppDecompScheduled: entry (%d,%d) missing from the LU pattern\n", i, j);
+   exit(-1);
+
+}  /* LUS_Index */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static int LUSchedule_Init( )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int k, kk, j, jj, n;
+
+  /*~~~> Trailing dense block: row k holds columns LUS_DENSE0 to NVAR-1
+         as its last NVAR-LUS_DENSE0 entries */
+   for (n = 1; n <= NVAR; n++) {
+     const int k0 = NVAR - n;
+     char dense = 1;
+     for (k = k0; ( k < NVAR ) && dense; k++)
+       if ( ( LU_CROW[k+1] - LU_CROW[k] < n ) || ( LU_ICOL[LU_CROW[k+1]-n] != k0 ) )
+         dense = 0;
+     if ( !dense )
+       break;
+     LUS_DENSE0 = k0;
+   }
+
+  /*~~~> Sparse eliminations, in the order of KppDecomp */
+   LUS_PTR.assign( 1, 0 );
+   for (k = 0; k < NVAR; k++) {
+     for (kk = LU_CROW[k]; kk < LU_DIAG[k]; kk++) {
+       j = LU_ICOL[kk];
+       if ( ( k >= LUS_DENSE0 ) && ( j >= LUS_DENSE0 ) )
+         break;
+       LUS_ROW.push_back( k );
+       LUS_MULT.push_back( kk );
+       LUS_PIV.push_back( LU_DIAG[j] );
+       for (jj = LU_DIAG[j]+1; jj < LU_CROW[j+1]; jj++) {
+         LUS_DST.push_back( LUS_Index( k, LU_ICOL[jj] ) );
+         LUS_SRC.push_back( jj );
+       }
+       LUS_PTR.push_back( LUS_DST.size() );
+     }
+   }
+
+   return 1;
+
+}  /* LUSchedule_Init */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+int KppDecompScheduled( double JVS[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Drop-in replacement for KppDecomp: same factors, same return value
+    (0, or k+1 if the diagonal of row k is zero before elimination)
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int k, e, u, j, c;
+
+   /* Built once, on first use (thread-safe local static) */
+   static const int LUS_INIT = LUSchedule_Init();
+   (void) LUS_INIT;
+
+   const int nElim  = LUS_ROW.size();
+   const int nDense = NVAR - LUS_DENSE0;
+
+   for (k = 0, e = 0; k < NVAR; k++) {
+     if ( ABS(JVS[ LU_DIAG[k] ]) < 1.00E-40 )
+       return k+1;
+
+     for (; ( e < nElim ) && ( LUS_ROW[e] == k ); e++) {
+       const double m = JVS[LUS_MULT[e]] / JVS[LUS_PIV[e]];
+       JVS[LUS_MULT[e]] = m;
+       for (u = LUS_PTR[e]; u < LUS_PTR[e+1]; u++)
+         JVS[LUS_DST[u]] -= m*JVS[LUS_SRC[u]];
+     }
+
+     if ( k > LUS_DENSE0 ) {
+       /* Dense kernel: row k of the trailing block, eliminated by the
+        * rows above it in the block. Rows are contiguous in JVS */
+       double *rk = &JVS[LU_CROW[k+1] - nDense];
+       for (j = 0; j < k - LUS_DENSE0; j++) {
+         const double *rj = &JVS[LU_CROW[LUS_DENSE0+j+1] - nDense];
+         const double m   = rk[j] / rj[j];
+         rk[j] = m;
+         for (c = j+1; c < nDense; c++)
+           rk[c] -= m*rj[c];
+       }
+     }
+   }
+
+   return 0;
+
+}  /* KppDecompScheduled */
+
+/* End of KPP_LUSchedule.cpp */
@@ -0,0 +1,80 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* KPP_RateCache Program File                                       */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : KPP_RateCache.cpp                         */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "KPP/KPP.hpp"
+#include "KPP/KPP_RateCache.hpp"
+
+bool KppRateCache::Key::operator<( const Key &k ) const
+{
+
+    if ( TEMP != k.TEMP )
+        return TEMP < k.TEMP;
+    if ( PRESS != k.PRESS )
+        return PRESS < k.PRESS;
+    return AIRDENS < k.AIRDENS;
+
+} /* End of KppRateCache::Key::operator< */
+
+KppRateCache::KppRateCache( ):
+    index( ),
+    table( ),
+    nHit( 0 ),
+    nMiss( 0 )
+{
+
+    /* Default Constructor */
+
+} /* End of KppRateCache::KppRateCache */
+
+KppRateCache::~KppRateCache( )
+{
+
+    /* Destructor */
+
+} /* End of KppRateCache::~KppRateCache */
+
+unsigned int KppRateCache::Lookup( const double TEMP, const double PRESS, \
+                                   const double AIRDENS )
+{
+
+    Key key;
+    key.TEMP    = TEMP;
+    key.PRESS   = PRESS;
+    key.AIRDENS = AIRDENS;
+
+    std::map<Key, unsigned int>::const_iterator it = index.find( key );
+    if ( it != index.end() ) {
+        nHit++;
+        return it->second;
+    }
+
+    nMiss++;
+
+    const unsigned int iEntry = index.size();
+    table.resize( ( iEntry + 1 ) * NREACT, 0.0E+00 );
+    Update_RCONST_Thermal( &table[iEntry * NREACT], TEMP, PRESS, AIRDENS );
+    index[key] = iEntry;
+
+    return iEntry;
+
+} /* End of KppRateCache::Lookup */
+
+void KppRateCache::Clear( )
+{
+
+    index.clear();
+    table.clear();
+
+} /* End of KppRateCache::Clear */
+
+/* End of KPP_RateCache.cpp */
@@ -401,8 +401,18 @@ void Update_SUN( )
 /*                                                                  */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-void Update_RCONST( const double TEMP, const double PRESS,  \
-                    const double AIRDENS, const double H2O ) 
+/* The rate expressions below are shared by the context and legacy
+ * versions: RCONST, HET and PHOTOL are arguments that shadow the
+ * globals of the same name.
+ *
+ * They are split into the thermal rates, which only depend on TEMP,
+ * PRESS and AIRDENS and can be tabulated by KppRateCache, and the local
+ * rates, which also depend on the water vapour, heterogeneous and
+ * photolysis rates of the cell. */
+
+void Update_RCONST_Thermal( double RCONST[],                            \
+                            const double TEMP, const double PRESS,      \
+                            const double AIRDENS )
 {
 
 /* Begin INLINED RCONST                                             */
@@ -420,7 +430,6 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
     RCONST[  7] = (GCARR(4.80E-11, 0.0E+00, 250.0, TEMP));
     RCONST[  8] = (GCARR(1.80E-12, 0.0E+00, 0.0, TEMP));
     RCONST[  9] = (GCARR(3.30E-12, 0.0E+00, 270.0, TEMP));
-    RCONST[ 10] = (GC_HO2NO3(3.00E-13, 0.0E+00, 460.0, 2.1E-33, 0.0, 920.0, AIRDENS, TEMP, H2O));
     RCONST[ 11] = (GC_OHCO(1.50E-13, 0.0E+00, 0.0, PRESS, AIRDENS, TEMP));
     RCONST[ 12] = (GCARR(2.45E-12, 0.0E+00, -1775.0, TEMP));
     RCONST[ 13] = (GCARR(2.80E-12, 0.0E+00, 300.0, TEMP));
@@ -635,10 +644,6 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
     RCONST[222] = (GCJPLPR(1.05E-02, 4.8E+00, -11234.0, 7.58E16, 2.1E0, -11234.0, 0.6, 0.0, 0.0, AIRDENS, TEMP));
     RCONST[223] = (GCARR(1.06E-16, 0.0E+00, 0.0, TEMP));
     RCONST[224] = (GCARR(5.30E-17, 0.0E+00, 0.0, TEMP));
-    RCONST[225] = (HET[ind_HO2][0]);
-    RCONST[226] = (HET[ind_NO2][0]);
-    RCONST[227] = (HET[ind_NO3][0]);
-    RCONST[228] = (HET[ind_N2O5][0]);
     RCONST[229] = (GCJPLPR(3.30E-31, 4.3E+00, 0.0, 1.6E-12, 0.0, 0.0, 0.6, 0.0, 0.0, AIRDENS, TEMP));
     RCONST[230] = (GCARR(1.60E-11, 0.0E+00, -780.0, TEMP));
     RCONST[231] = (GCARR(4.50E-12, 0.0E+00, 460.0, TEMP));
@@ -660,11 +665,6 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
     RCONST[247] = (GCARR(8.77E-11, 0.0E+00, -4330.0, TEMP));
     RCONST[248] = (GCJPLPR(4.20E-31, 2.4E+00, 0.0, 2.7E-11, 0.0, 0.0, 0.6, 0.0, 0.0, AIRDENS, TEMP));
     RCONST[249] = (GCJPLPR(5.20E-31, 3.2E+00, 0.0, 6.9E-12, 2.9E0, 0.0, 0.6, 0.0, 0.0, AIRDENS, TEMP));
-    RCONST[250] = (HET[ind_BrNO3][0]);
-    RCONST[251] = (HET[ind_HOBr][0]);
-    RCONST[252] = (HET[ind_HBr][0]);
-    RCONST[253] = (HET[ind_HOBr][1]);
-    RCONST[254] = (HET[ind_HBr][1]);
     RCONST[255] = (GCARR(3.35E-11, 0.0E+00, 380.0, TEMP));
     RCONST[256] = (GC_RO2NO("B", 2.70E-12, 0.0E+00, 350.0, 5.0, 0.0, 0.0, AIRDENS, TEMP));
     RCONST[257] = (GC_RO2NO("A", 2.70E-12, 0.0E+00, 350.0, 5.0, 0.0, 0.0, AIRDENS, TEMP));
@@ -802,6 +802,25 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
     RCONST[389] = (GCARR(4.10E-13, 0.0E+00, 290.0, TEMP));
     RCONST[390] = (GCARR(3.60E-12, 0.0E+00, -840.0, TEMP));
     RCONST[391] = (GCARR(6.50E-12, 0.0E+00, 135.0, TEMP));
+
+}
+
+static void Update_RCONST_Local( double RCONST[], const double HET[][3], \
+                                 const double PHOTOL[],                  \
+                                 const double TEMP,                      \
+                                 const double AIRDENS, const double H2O )
+{
+
+    RCONST[ 10] = (GC_HO2NO3(3.00E-13, 0.0E+00, 460.0, 2.1E-33, 0.0, 920.0, AIRDENS, TEMP, H2O));
+    RCONST[225] = (HET[ind_HO2][0]);
+    RCONST[226] = (HET[ind_NO2][0]);
+    RCONST[227] = (HET[ind_NO3][0]);
+    RCONST[228] = (HET[ind_N2O5][0]);
+    RCONST[250] = (HET[ind_BrNO3][0]);
+    RCONST[251] = (HET[ind_HOBr][0]);
+    RCONST[252] = (HET[ind_HBr][0]);
+    RCONST[253] = (HET[ind_HOBr][1]);
+    RCONST[254] = (HET[ind_HBr][1]);
     RCONST[392] = (HET[ind_N2O5][1]);
     RCONST[393] = (HET[ind_ClNO3][0]);
     RCONST[394] = (HET[ind_ClNO3][1]);
@@ -888,6 +907,50 @@ void Update_RCONST( const double TEMP, const double PRESS,  \
 
 }
 
+static void Update_RCONST( double RCONST[], const double HET[][3],      \
+                           const double PHOTOL[],                       \
+                           const double TEMP, const double PRESS,       \
+                           const double AIRDENS, const double H2O )
+{
+
+    Update_RCONST_Thermal( RCONST, TEMP, PRESS, AIRDENS );
+    Update_RCONST_Local( RCONST, HET, PHOTOL, TEMP, AIRDENS, H2O );
+
+}
+
+void Update_RCONST( KppContext &ctx,                            \
+                    const double TEMP, const double PRESS,      \
+                    const double AIRDENS, const double H2O )
+{
+
+    Update_RCONST( ctx.RCONST, ctx.HET, ctx.PHOTOL, \
+                   TEMP, PRESS, AIRDENS, H2O );
+
+}
+
+void Update_RCONST( KppContext &ctx, const double RCT_T[],      \
+                    const double TEMP, const double AIRDENS,    \
+                    const double H2O )
+{
+
+    /* RCT_T holds the thermal rates at (TEMP, PRESS, AIRDENS) and
+     * zero for all other reactions */
+    memcpy( ctx.RCONST, RCT_T, NREACT * sizeof(double) );
+    Update_RCONST_Local( ctx.RCONST, ctx.HET, ctx.PHOTOL, \
+                         TEMP, AIRDENS, H2O );
+
+}
+
+/* Legacy version, on the threadprivate globals (adjoint driver) */
+void Update_RCONST( const double TEMP, const double PRESS,  \
+                    const double AIRDENS, const double H2O )
+{
+
+    Update_RCONST( RCONST, HET, PHOTOL, \
+                   TEMP, PRESS, AIRDENS, H2O );
+
+}
+
 /* End of Update_RCONST function                                    */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
@@ -0,0 +1,114 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* KPP_Reduced Program File                                         */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : KPP_Reduced.cpp                           */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <math.h>
+
+#include "KPP/KPP.hpp"
+#include "KPP/KPP_Parameters.h"
+#include "KPP/KPP_Sparse.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   Reduced chemistry for cells close to the ambient
+
+   Far from the plume, a cell only departs from the ambient by a small
+   perturbation D = Y - Ya. Over a step DT, D is advanced with the
+   Jacobian J of the ambient at the start of the step, by one implicit
+   Euler step:
+        ( I - DT*J ) D(t+DT) = D(t)
+   The matrix is factorized once per step, for all cells, and each cell
+   then costs one sparse solve. Implicit Euler damps the fast modes,
+   which leaves the short-lived radicals in equilibrium with the
+   long-lived species. These radicals are finally set to their quasi-
+   steady state, P/L, with the rates of the cell.
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+ int  KppDecomp( double A[] );
+ int  KppDecompScheduled( double A[] );
+ void KppSolve ( double A[], double b[] );
+
+ /* Short-lived radicals, set to quasi-steady state */
+ static const int QSSA_SPEC[] = { ind_O1D, ind_O, ind_N, ind_OH, ind_HO2, ind_NO3 };
+ static const int NQSSA       = sizeof( QSSA_SPEC ) / sizeof( QSSA_SPEC[0] );
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+int REDUCED_PREPARE( KppContext &ctx, double DT, double JVS[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Factorizes I - DT*J in JVS, J being the Jacobian at ctx.VAR.
+    Returns 0, or k+1 if row k is singular (see KppDecomp), in which
+    case JVS is set to the identity: cells then keep their departure
+    from the ambient
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int i, IER;
+
+   Jac_SP( ctx, ctx.VAR, JVS );
+
+   for (i = 0; i < LU_NONZERO; i++)
+     JVS[i] *= -DT;
+   for (i = 0; i < NVAR; i++)
+     JVS[ LU_DIAG[i] ] += 1.0;
+
+   if ( ctx.DECOMP == KPP_DECOMP_SCHEDULED )
+     IER = KppDecompScheduled( JVS );
+   else
+     IER = KppDecomp( JVS );
+
+   if ( IER != 0 ) {
+     for (i = 0; i < LU_NONZERO; i++)
+       JVS[i] = 0.0;
+     for (i = 0; i < NVAR; i++)
+       JVS[ LU_DIAG[i] ] = 1.0;
+   }
+
+   return IER;
+
+}  /* REDUCED_PREPARE */
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+void REDUCED_ADVANCE( KppContext &ctx, double JVS[],
+                      const double VAR0[], const double VAR1[] )
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    Advances the cell in ctx.VAR over the step factorized in JVS (by
+    REDUCED_PREPARE, not modified), the ambient going from VAR0 to VAR1.
+    The radicals are then set to quasi-steady state with the fixed
+    species and rate constants of ctx
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+{
+   int i, q, iter;
+   double D[NVAR], Vdot[NVAR], JAC[LU_NONZERO];
+
+  /*~~~> Perturbation from the ambient */
+   for (i = 0; i < NVAR; i++)
+     D[i] = ctx.VAR[i] - VAR0[i];
+
+   KppSolve( JVS, D );
+
+   for (i = 0; i < NVAR; i++)
+     ctx.VAR[i] = fmax( VAR1[i] + D[i], 0.0 );
+
+  /*~~~> Quasi-steady state: Y = P/L = Y + F/L, with L = -dF/dY */
+   for (iter = 0; iter < KPP_QSSA_ITER; iter++) {
+     Fun( ctx, ctx.VAR, Vdot );
+     Jac_SP( ctx, ctx.VAR, JAC );
+     for (q = 0; q < NQSSA; q++) {
+       const int    k = QSSA_SPEC[q];
+       const double L = -JAC[ LU_DIAG[k] ];
+       if ( L > 0.0 )
+         ctx.VAR[k] = fmax( ctx.VAR[k] + Vdot[k] / L, 0.0 );
+     }
+   }
+
+}  /* REDUCED_ADVANCE */
+
+/* End of KPP_Reduced.cpp */
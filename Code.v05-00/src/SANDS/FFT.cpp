@@ -261,96 +261,32 @@ FourierTransform_1D<double>::FourierTransform_1D( const bool MULTITHREADED_FFT,
     :   rows( rows_ ),
         rowsC( rows_/2 + 1 ),
         fftScaling( rows_ ),
-        THREADED_FFT( MULTITHREADED_FFT )
+        THREADED_FFT( MULTITHREADED_FFT ),
+        WISDOM_( WISDOM ),
+        FFTW_DIR_( FFTW_DIR )
 {
 
-    UInt nThreads = 0;
-    int wisdomExists = 0;
-
-    std::string fileName = FFTW_DIR;
-    std::string fileName_FFT, fileName_IFFT; 
-
-    fileName += "FFTW_1Dplan_" + std::to_string(rows);
-
-    if ( THREADED_FFT ) {
-        /* Performing the one-time initialization required to use threads with
-         * FFTW */
-        int Success = fftw_init_threads();
-        if ( Success == 0 ) {
-            std::cout << " Could not perform the initialization required by FFTW when using multiple threads" << std::endl;
-            exit(-1);
-        }
-    }
-
     /* Allocate the ins and outs */
     in_FFT   = (scalar_type*)  fftw_malloc( sizeof(scalar_type)  * rows  );
     out_FFT  = (complex_type*) fftw_malloc( sizeof(complex_type) * rowsC );
     in_IFFT  = (complex_type*) fftw_malloc( sizeof(complex_type) * rowsC );
     out_IFFT = (scalar_type*)  fftw_malloc( sizeof(scalar_type)  * rows  );
 
-    if ( THREADED_FFT ) {
-        int nThreads = omp_get_max_threads();
-
-        /* All plans subsequently created with any planner routine will use 
-         * that many threads */
-        fftw_plan_with_nthreads( nThreads );
-
-        fileName += "_" + std::to_string(nThreads);
-    }
-
-    fileName_FFT  = fileName + "_FFT.pl";
-    fileName_IFFT = fileName + "_IFFT.pl";
-
-    if ( WISDOM )
-        wisdomExists = fftw_import_wisdom_from_filename( fileName_FFT.c_str() );
-
-    /* Create FFT plan and compute the best FFT algorithm */
-    if ( wisdomExists )
-        plan_FFT = fftw_plan_dft_r2c_1d( rows, in_FFT, out_FFT, FFTW_WISDOM_ONLY );
-    else
-        plan_FFT = fftw_plan_dft_r2c_1d( rows, in_FFT, out_FFT, FFTW_PATIENT );
-
-    /* Check that plan was successfully created. 
-     * Otherwise exit. */
-    if ( plan_FFT == NULL ) {
-        std::cout << " In FourierTransform_1D: Plan creation failed!\n";
-        exit(-1);
-    }
-
-    if ( WISDOM && ( wisdomExists == 0 ) ) {
-        /* Export wisdom from FFTW plan */
-        fftw_export_wisdom_to_filename( fileName_FFT.c_str() );
-    }
-
-    if ( WISDOM )
-        wisdomExists = fftw_import_wisdom_from_filename( fileName_IFFT.c_str() );
-
-    /* Create IFFT plan and compute the best IFFT algorithm */
-    if ( wisdomExists )
-        plan_IFFT = fftw_plan_dft_c2r_1d( rows, in_IFFT, out_IFFT, FFTW_WISDOM_ONLY );
-    else
-        plan_IFFT = fftw_plan_dft_c2r_1d( rows, in_IFFT, out_IFFT, FFTW_PATIENT );
-
-    /* Check that plan was successfully created. 
-     * Otherwise exit. */
-    if ( plan_IFFT == NULL ) {
-        std::cout << " In FourierTransform_1D: Plan creation failed!\n";
-        exit(-1);
-    }
-
-    if ( WISDOM && ( wisdomExists == 0 ) ) {
-        /* Export wisdom from FFTW plan */
-        fftw_export_wisdom_to_filename( fileName_IFFT.c_str() );
-    }
+    /* Plans are shared with all other instances of the same size and are
+     * only executed on the arrays above */
+    plan_FFT  = FFT_PlanRegistry::Get( FFT_PlanRegistry::R2C, rows, 0, 1, \
+                                       THREADED_FFT, WISDOM, FFTW_DIR );
+    plan_IFFT = FFT_PlanRegistry::Get( FFT_PlanRegistry::C2R, rows, 0, 1, \
+                                       THREADED_FFT, WISDOM, FFTW_DIR );
 
 } /* End of FourierTransform_1D<double>::FourierTransform_1D */
 
 FourierTransform_1D<double>::~FourierTransform_1D()
 {
 
-    /* Free plan memory */
-    fftw_destroy_plan( plan_FFT );
-    fftw_destroy_plan( plan_IFFT );
+    /* Plans are owned by FFT_PlanRegistry */
+    plan_FFT  = NULL;
+    plan_IFFT = NULL;
 
     /* Free arrays */
     fftw_free( in_FFT ); 
@@ -362,11 +298,6 @@ FourierTransform_1D<double>::~FourierTransform_1D()
     fftw_free( out_IFFT ); 
     out_IFFT = NULL;
 
-    if ( THREADED_FFT ) {
-        /* Cleanup and get rid of all memory allocated by FFTW */
-        fftw_cleanup_threads();
-    }
-
 } /* End of FourierTransform_1D<double>::~FourierTransform_1D */
 
 //void FourierTransform_1D<double>::Forward( scalar_type* in, complex_type* out ) const
@@ -441,8 +372,9 @@ FourierTransform_1D<double>::~FourierTransform_1D()
 //
 //} /* End of FourierTransform_1D<double>::Scale */
 
+template <class Field>
 void FourierTransform_1D<double>::ApplyShear( const Vector_2Dc &shearFactor, \
-                                              Vector_2D &V ) const
+                                              Field &V ) const
 {
 
     /* It turns out that this function is much faster when running in serial */
@@ -459,7 +391,7 @@ void FourierTransform_1D<double>::ApplyShear( const Vector_2Dc &shearFactor, \
 //        private ( i          ) \
 //        schedule( dynamic, 1 ) \
 //        if ( !PARALLEL_CASES )
-        for ( i = 0; i < V[0].size(); i++ )
+        for ( i = 0; i < rows; i++ )
             in_FFT[i] = (scalar_type) V[j][i];
 
         /* Computes forward DFT */
@@ -487,13 +419,16 @@ void FourierTransform_1D<double>::ApplyShear( const Vector_2Dc &shearFactor, \
 //        private ( i          ) \
 //        schedule( dynamic, 1 ) \
 +/        if ( !PARALLEL_CASES )
-        for ( i = 0; i < V[0].size(); i++ )
+        for ( i = 0; i < rows; i++ )
             V[j][i] = out_IFFT[i] / fftScaling;
 
     }
 
 } /* End of FourierTransform_1D<double>::ApplyShear */
 
+template void FourierTransform_1D<double>::ApplyShear<Vector_2D>( const Vector_2Dc &shearFactor, Vector_2D &V ) const;
+template void FourierTransform_1D<double>::ApplyShear<Field2D>( const Vector_2Dc &shearFactor, Field2D &V ) const;
+
 FourierTransform_1D<long double>::FourierTransform_1D( const bool MULTITHREADED_FFT, \
                                                        const bool WISDOM,            \
                                                        const char* FFTW_DIR,         \
@@ -734,96 +669,408 @@ void FourierTransform_1D<long double>::ApplyShear( const Vector_2Dcl &shearFacto
 
 } /* End of FourierTransform_1D<long double>::ApplyShear */
 
-FourierTransform_2D<float>::FourierTransform_2D( const bool MULTITHREADED_FFT, \
-                                                 const bool WISDOM,            \
-                                                 const char* FFTW_DIR,         \
-                                                 const UInt rows_,             \
-                                                 const UInt cols_)
+/* Staging helpers for the 2D transforms. Contiguous fields are handed to
+ * FFTW as is; nested vectors are copied row by row into a contiguous
+ * buffer with the same row-major layout. Single precision buffers are
+ * converted on the fly. */
+
+static inline double* contiguousData( Field2D &V )
+{
+    return V.data();
+}
+
+/* Nested rows are not contiguous, the argument only selects the overload */
+static inline double* contiguousData( Vector_2D & )
+{
+    return NULL;
+}
+
+template <typename T>
+static inline void gatherField( const Field2D &V, T* buffer, \
+                                const UInt nx, const UInt ny )
+{
+    std::copy( V.data(), V.data() + nx * ny, buffer );
+}
+
+template <typename T>
+static inline void gatherField( const Vector_2D &V, T* buffer, \
+                                const UInt nx, const UInt ny )
+{
+    for ( UInt j = 0; j < ny; j++ )
+        std::copy( V[j].begin(), V[j].begin() + nx, buffer + j * nx );
+}
+
+template <typename T>
+static inline void scatterField( const T* buffer, Field2D &V, \
+                                 const UInt nx, const UInt ny )
+{
+    std::copy( buffer, buffer + nx * ny, V.data() );
+}
+
+template <typename T>
+static inline void scatterField( const T* buffer, Vector_2D &V, \
+                                 const UInt nx, const UInt ny )
+{
+    for ( UInt j = 0; j < ny; j++ )
+        std::copy( buffer + j * nx, buffer + ( j + 1 ) * nx, V[j].begin() );
+}
+
+template <class Field>
+void FourierTransform_1D<double>::ApplyShear( const Vector_2Dc &shearFactor, \
+                                              std::vector<Field*> &V ) const
+{
+
+    UInt k = 0;
+
+    const UInt nField = V.size();
+
+    if ( nField == 0 )
+        return;
+
+    /* Number of layers per field */
+    const UInt nLayer = shearFactor.size();
+
+    /* One transform per layer, all layers of a field at once */
+    fftw_plan plan_FFT_many  = FFT_PlanRegistry::Get( FFT_PlanRegistry::R2C, rows, 0, nLayer, \
+                                                      THREADED_FFT, WISDOM_, FFTW_DIR_.c_str() );
+    fftw_plan plan_IFFT_many = FFT_PlanRegistry::Get( FFT_PlanRegistry::C2R, rows, 0, nLayer, \
+                                                      THREADED_FFT, WISDOM_, FFTW_DIR_.c_str() );
+
+    /* Threaded plans already use all threads */
+#pragma omp parallel                                  \
+    default ( shared                                ) \
+    private ( k                                     ) \
+    if      ( !PARALLEL_CASES && !THREADED_FFT      )
+    {
+
+    /* Thread private buffers */
+    scalar_type*  real  = (scalar_type*)  fftw_malloc( sizeof(scalar_type)  * rows  * nLayer );
+    complex_type* cmplx = (complex_type*) fftw_malloc( sizeof(complex_type) * rowsC * nLayer );
+
+#pragma omp for schedule( dynamic, 1 )
+    for ( k = 0; k < nField; k++ ) {
+
+        gatherField( *V[k], real, rows, nLayer );
+
+        /* Computes forward DFTs */
+        fftw_execute_dft_r2c( plan_FFT_many, real, cmplx );
+
+        /* Convolve and scale the frequencies */
+        for ( UInt j = 0; j < nLayer; j++ ) {
+            complex_type* layer = cmplx + j * rowsC;
+            for ( UInt i = 0; i < rowsC; i++ ) {
+                const RealDouble re = layer[i][REAL];
+                const RealDouble im = layer[i][IMAG];
+                layer[i][REAL] = ( re * shearFactor[j][i].real() \
+                                 - im * shearFactor[j][i].imag() ) / fftScaling;
+                layer[i][IMAG] = ( re * shearFactor[j][i].imag() \
+                                 + im * shearFactor[j][i].real() ) / fftScaling;
+            }
+        }
+
+        /* Computes backward DFTs */
+        fftw_execute_dft_c2r( plan_IFFT_many, cmplx, real );
+
+        scatterField( real, *V[k], rows, nLayer );
+
+    }
+
+    fftw_free( real );
+    fftw_free( cmplx );
+
+    } /* pragma omp parallel */
+
+} /* End of FourierTransform_1D<double>::ApplyShear */
+
+template void FourierTransform_1D<double>::ApplyShear<Vector_2D>( const Vector_2Dc &shearFactor, std::vector<Vector_2D*> &V ) const;
+template void FourierTransform_1D<double>::ApplyShear<Field2D>( const Vector_2Dc &shearFactor, std::vector<Field2D*> &V ) const;
+
+FourierTransform_2D<double>::FourierTransform_2D( const bool MULTITHREADED_FFT, \
+                                                  const bool WISDOM,            \
+                                                  const char* FFTW_DIR,         \
+                                                  const UInt rows_,             \
+                                                  const UInt cols_,             \
+                                                  const UInt nBatch_ )
     :   rows( rows_ ),
         cols( cols_ ),
-        colsC( cols_/2 + 1 ),
+        rowsC( rows_/2 + 1 ),
         fftScaling( cols_ * rows_ ),
-        THREADED_FFT( MULTITHREADED_FFT )
+        nBatch( nBatch_ ),
+        THREADED_FFT( MULTITHREADED_FFT ),
+        in_FFT_many( NULL ),
+        out_FFT_many( NULL ),
+        plan_FFT_many( NULL ),
+        plan_IFFT_many( NULL )
 {
 
-    UInt nThreads = 0;
-    int wisdomExists = 0;
+    /* Allocate the ins and outs. in_FFT is only used to stage fields that
+     * are not contiguous in memory. The spectrum is multiplied in place, so
+     * that out_FFT is also the input of the backward transform. */
+    in_FFT  = (scalar_type*)  fftw_malloc( sizeof(scalar_type)  * rows  * cols );
+    out_FFT = (complex_type*) fftw_malloc( sizeof(complex_type) * rowsC * cols );
+    factorX = (complex_type*) fftw_malloc( sizeof(complex_type) * rowsC );
+    factorY = (complex_type*) fftw_malloc( sizeof(complex_type) * cols  );
+
+    for ( UInt i = 0; i < rowsC; i++ ) {
+        factorX[i][REAL] = 1.0E+00 / fftScaling;
+        factorX[i][IMAG] = 0.0E+00;
+    }
+    for ( UInt j = 0; j < cols; j++ ) {
+        factorY[j][REAL] = 1.0E+00;
+        factorY[j][IMAG] = 0.0E+00;
+    }
 
-    std::string fileName = FFTW_DIR;
-    std::string fileName_FFT, fileName_IFFT; 
+    /* Plans are shared with all other instances of the same size and are
+     * only executed on the arrays owned by this instance. The slowest
+     * varying dimension is y. */
+    plan_FFT  = FFT_PlanRegistry::Get( FFT_PlanRegistry::R2C, cols, rows, 1, \
+                                       THREADED_FFT, WISDOM, FFTW_DIR );
+    plan_IFFT = FFT_PlanRegistry::Get( FFT_PlanRegistry::C2R, cols, rows, 1, \
+                                       THREADED_FFT, WISDOM, FFTW_DIR );
 
-    fileName += "FFTW_2Dplan_" + std::to_string(rows) \
-                             + "_" + std::to_string(cols);
+    if ( nBatch > 1 ) {
 
-    if ( THREADED_FFT ) {
-        /* Performing the one-time initialization required to use threads with
-         * FFTW */
-        int Success = fftw_init_threads();
-        if ( Success == 0 ) {
-            std::cout << " Could not perform the initialization required by FFTW when using multiple threads" << std::endl;
-            exit(-1);
+        /* Batched plans: nBatch fields are stored one after the other, each
+         * with the same layout as in_FFT/out_FFT */
+        in_FFT_many  = (scalar_type*)  fftw_malloc( sizeof(scalar_type)  * nBatch * rows  * cols );
+        out_FFT_many = (complex_type*) fftw_malloc( sizeof(complex_type) * nBatch * rowsC * cols );
+
+        plan_FFT_many  = FFT_PlanRegistry::Get( FFT_PlanRegistry::R2C, cols, rows, nBatch, \
+                                                THREADED_FFT, WISDOM, FFTW_DIR );
+        plan_IFFT_many = FFT_PlanRegistry::Get( FFT_PlanRegistry::C2R, cols, rows, nBatch, \
+                                                THREADED_FFT, WISDOM, FFTW_DIR );
+
+    }
+
+} /* End of FourierTransform_2D<double>::FourierTransform_2D */
+
+FourierTransform_2D<double>::~FourierTransform_2D()
+{
+
+    /* Plans are owned by FFT_PlanRegistry */
+    plan_FFT       = NULL;
+    plan_IFFT      = NULL;
+    plan_FFT_many  = NULL;
+    plan_IFFT_many = NULL;
+
+    /* Free batched arrays */
+    fftw_free( in_FFT_many ); 
+    in_FFT_many = NULL;
+    fftw_free( out_FFT_many ); 
+    out_FFT_many = NULL;
+
+    /* Free arrays */
+    fftw_free( in_FFT ); 
+    in_FFT = NULL;
+    fftw_free( out_FFT ); 
+    out_FFT = NULL;
+    fftw_free( factorX ); 
+    factorX = NULL;
+    fftw_free( factorY ); 
+    factorY = NULL;
+
+} /* End of FourierTransform_2D<double>::~FourierTransform_2D */
+
+void FourierTransform_2D<double>::SetFactors( const Vector_1Dc &propX, \
+                                              const Vector_1Dc &propY )
+{
+
+    /* The half spectrum of the row-major transform holds all y-frequencies
+     * and the first rowsC x-frequencies */
+    for ( UInt i = 0; i < rowsC; i++ ) {
+        factorX[i][REAL] = propX[i].real() / fftScaling;
+        factorX[i][IMAG] = propX[i].imag() / fftScaling;
+    }
+
+    for ( UInt j = 0; j < cols; j++ ) {
+        factorY[j][REAL] = propY[j].real();
+        factorY[j][IMAG] = propY[j].imag();
+    }
+
+} /* End of FourierTransform_2D<double>::SetFactors */
+
+void FourierTransform_2D<double>::Convolve( complex_type* spectrum ) const
+{
+
+    /* Contiguous pass over the half spectrum. The 2D factor is the outer
+     * product of the per-axis propagators and is never stored. */
+    UInt i = 0;
+    UInt j = 0;
+    scalar_type re, im, fRe, fIm;
+
+    for ( j = 0; j < cols; j++ ) {
+        const scalar_type yRe = factorY[j][REAL];
+        const scalar_type yIm = factorY[j][IMAG];
+        complex_type* row = spectrum + j * rowsC;
+        for ( i = 0; i < rowsC; i++ ) {
+            fRe = yRe * factorX[i][REAL] - yIm * factorX[i][IMAG];
+            fIm = yRe * factorX[i][IMAG] + yIm * factorX[i][REAL];
+            re  = row[i][REAL];
+            im  = row[i][IMAG];
+            row[i][REAL] = re * fRe - im * fIm;
+            row[i][IMAG] = re * fIm + im * fRe;
         }
     }
 
-    /* Allocate the ins and outs */
-    in_FFT   = (scalar_type*)  fftwf_malloc( sizeof(scalar_type)  * rows * cols  );
-    out_FFT  = (complex_type*) fftwf_malloc( sizeof(complex_type) * rows * colsC );
-    in_IFFT  = (complex_type*) fftwf_malloc( sizeof(complex_type) * rows * colsC );
-    out_IFFT = (scalar_type*)  fftwf_malloc( sizeof(scalar_type)  * rows * cols  );
+} /* End of FourierTransform_2D<double>::Convolve */
 
-    if ( THREADED_FFT ) {
-        int nThreads = omp_get_max_threads();
+template <class Field>
+void FourierTransform_2D<double>::SANDS( Field &V ) const
+{
 
-        /* All plans subsequently created with any planner routine will use 
-         * that many threads */
-        fftw_plan_with_nthreads( nThreads );
+    /* Contiguous fields are transformed in place of the staging buffer.
+     * FFTW requires the new array to have the same alignment as the one
+     * used for planning. */
+    scalar_type* data = contiguousData( V );
 
-        fileName += "_" + std::to_string(nThreads);
+    if ( ( data == NULL ) || \
+         ( fftw_alignment_of( data ) != fftw_alignment_of( in_FFT ) ) ) {
+        gatherField( V, in_FFT, rows, cols );
+        data = in_FFT;
     }
 
-    fileName_FFT  = fileName + "_FFT.pl";
-    fileName_IFFT = fileName + "_IFFT.pl";
+    /* Computes forward DFT */
+    fftw_execute_dft_r2c( plan_FFT, data, out_FFT );
 
-    if ( WISDOM )
-        wisdomExists = fftw_import_wisdom_from_filename( fileName_FFT.c_str() );
+    /* Convolve and scale the frequencies */
+    Convolve( out_FFT );
 
-    /* Create FFT plan and compute the best FFT algorithm */
-    if ( wisdomExists )
-        plan_FFT = fftwf_plan_dft_r2c_2d( rows, cols, in_FFT, out_FFT, FFTW_WISDOM_ONLY );
-    else
-        plan_FFT = fftwf_plan_dft_r2c_2d( rows, cols, in_FFT, out_FFT, FFTW_PATIENT );
+    /* Computes backward DFT */
+    fftw_execute_dft_c2r( plan_IFFT, out_FFT, data );
 
-    /* Check that plan was successfully created. 
-     * Otherwise exit. */
-    if ( plan_FFT == NULL ) {
-        std::cout << " In FourierTransform_2D: Plan creation failed!\n";
-        exit(-1);
+    if ( data == in_FFT )
+        scatterField( in_FFT, V, rows, cols );
+
+} /* End of FourierTransform_2D<double>::SANDS */
+
+template <class Field>
+void FourierTransform_2D<double>::SANDS( std::vector<Field*> &V ) const
+{
+
+    UInt k = 0;
+
+    const UInt nField = V.size();
+
+    if ( ( plan_FFT_many == NULL ) || ( plan_IFFT_many == NULL ) ) {
+        /* No batched plans, transport fields one at a time */
+        for ( k = 0; k < nField; k++ )
+            SANDS( *V[k] );
+        return;
     }
 
-    if ( WISDOM && ( wisdomExists == 0 ) ) {
-        /* Export wisdom from FFTW plan */
-        fftw_export_wisdom_to_filename( fileName_FFT.c_str() );
+    const UInt dist  = rows  * cols;
+    const UInt distC = rowsC * cols;
+
+    UInt iField = 0;
+    UInt nCurr  = 0;
+
+    for ( iField = 0; iField < nField; iField += nBatch ) {
+
+        /* Number of fields in this batch */
+        nCurr = std::min( nBatch, nField - iField );
+
+        if ( nCurr == 1 ) {
+            /* Not worth going through the batched plan */
+            SANDS( *V[iField] );
+            continue;
+        }
+
+        /* Unused slots of the last batch are zeroed so that the extra
+         * transforms are cheap and well-defined */
+        if ( nCurr < nBatch )
+            std::fill( in_FFT_many + nCurr * dist, in_FFT_many + nBatch * dist, 0.0E+00 );
+
+        /* Fields are not equidistant in memory, so they are copied into the
+         * batch buffer. Both share the same row-major layout. */
+#pragma omp parallel for   \
+    default ( shared     ) \
+    private ( k          ) \
+    schedule( static     ) \
+    if ( !PARALLEL_CASES )
+        for ( k = 0; k < nCurr; k++ )
+            gatherField( *V[iField + k], in_FFT_many + k * dist, rows, cols );
+
+        /* Computes forward DFTs */
+        fftw_execute_dft_r2c( plan_FFT_many, in_FFT_many, out_FFT_many );
+
+        /* Convolve and scale the frequencies */
+#pragma omp parallel for   \
+    default ( shared     ) \
+    private ( k          ) \
+    schedule( static     ) \
+    if ( !PARALLEL_CASES )
+        for ( k = 0; k < nCurr; k++ )
+            Convolve( out_FFT_many + k * distC );
+
+        /* Computes backward DFTs */
+        fftw_execute_dft_c2r( plan_IFFT_many, out_FFT_many, in_FFT_many );
+
+#pragma omp parallel for   \
+    default ( shared     ) \
+    private ( k          ) \
+    schedule( static     ) \
+    if ( !PARALLEL_CASES )
+        for ( k = 0; k < nCurr; k++ )
+            scatterField( in_FFT_many + k * dist, *V[iField + k], rows, cols );
+
     }
 
-    if ( WISDOM )
-        wisdomExists = fftw_import_wisdom_from_filename( fileName_IFFT.c_str() );
+} /* End of FourierTransform_2D<double>::SANDS */
 
-    /* Create IFFT plan and compute the best IFFT algorithm */
-    if ( wisdomExists )
-        plan_IFFT = fftwf_plan_dft_c2r_2d( rows, cols, in_IFFT, out_IFFT, FFTW_WISDOM_ONLY );
-    else
-        plan_IFFT = fftwf_plan_dft_c2r_2d( rows, cols, in_IFFT, out_IFFT, FFTW_PATIENT );
+template void FourierTransform_2D<double>::SANDS<Vector_2D>( Vector_2D &V ) const;
+template void FourierTransform_2D<double>::SANDS<Field2D>( Field2D &V ) const;
+template void FourierTransform_2D<double>::SANDS<Vector_2D>( std::vector<Vector_2D*> &V ) const;
+template void FourierTransform_2D<double>::SANDS<Field2D>( std::vector<Field2D*> &V ) const;
 
-    /* Check that plan was successfully created. 
-     * Otherwise exit. */
-    if ( plan_IFFT == NULL ) {
-        std::cout << " In FourierTransform_2D: Plan creation failed!\n";
-        exit(-1);
+FourierTransform_2D<float>::FourierTransform_2D( const bool MULTITHREADED_FFT, \
+                                                 const bool WISDOM,            \
+                                                 const char* FFTW_DIR,         \
+                                                 const UInt rows_,             \
+                                                 const UInt cols_,             \
+                                                 const UInt nBatch_ )
+    :   rows( rows_ ),
+        cols( cols_ ),
+        rowsC( rows_/2 + 1 ),
+        fftScaling( cols_ * rows_ ),
+        nBatch( nBatch_ ),
+        THREADED_FFT( MULTITHREADED_FFT ),
+        in_FFT_many( NULL ),
+        out_FFT_many( NULL ),
+        plan_FFT_many( NULL ),
+        plan_IFFT_many( NULL )
+{
+
+    /* Allocate the ins and outs. Fields are always staged through in_FFT,
+     * where they are converted to single precision. */
+    in_FFT  = (scalar_type*)  fftwf_malloc( sizeof(scalar_type)  * rows  * cols );
+    out_FFT = (complex_type*) fftwf_malloc( sizeof(complex_type) * rowsC * cols );
+    factorX = (complex_type*) fftwf_malloc( sizeof(complex_type) * rowsC );
+    factorY = (complex_type*) fftwf_malloc( sizeof(complex_type) * cols  );
+
+    for ( UInt i = 0; i < rowsC; i++ ) {
+        factorX[i][REAL] = 1.0E+00 / fftScaling;
+        factorX[i][IMAG] = 0.0E+00;
+    }
+    for ( UInt j = 0; j < cols; j++ ) {
+        factorY[j][REAL] = 1.0E+00;
+        factorY[j][IMAG] = 0.0E+00;
     }
 
-    if ( WISDOM && ( wisdomExists == 0 ) ) {
-        /* Export wisdom from FFTW plan */
-        fftw_export_wisdom_to_filename( fileName_IFFT.c_str() );
+    plan_FFT  = FFT_PlanRegistry::GetSingle( FFT_PlanRegistry::R2C, cols, rows, 1, \
+                                             THREADED_FFT, WISDOM, FFTW_DIR );
+    plan_IFFT = FFT_PlanRegistry::GetSingle( FFT_PlanRegistry::C2R, cols, rows, 1, \
+                                             THREADED_FFT, WISDOM, FFTW_DIR );
+
+    if ( nBatch > 1 ) {
+
+        in_FFT_many  = (scalar_type*)  fftwf_malloc( sizeof(scalar_type)  * nBatch * rows  * cols );
+        out_FFT_many = (complex_type*) fftwf_malloc( sizeof(complex_type) * nBatch * rowsC * cols );
+
+        plan_FFT_many  = FFT_PlanRegistry::GetSingle( FFT_PlanRegistry::R2C, cols, rows, nBatch, \
+                                                      THREADED_FFT, WISDOM, FFTW_DIR );
+        plan_IFFT_many = FFT_PlanRegistry::GetSingle( FFT_PlanRegistry::C2R, cols, rows, nBatch, \
+                                                      THREADED_FFT, WISDOM, FFTW_DIR );
+
     }
 
 } /* End of FourierTransform_2D<float>::FourierTransform_2D */
@@ -831,406 +1078,159 @@ FourierTransform_2D<float>::FourierTransform_2D( const bool MULTITHREADED_FFT, \
 FourierTransform_2D<float>::~FourierTransform_2D()
 {
 
-    /* Free plan memory */
-    fftwf_destroy_plan( plan_FFT );
-    fftwf_destroy_plan( plan_IFFT );
+    /* Plans are owned by FFT_PlanRegistry */
+    plan_FFT       = NULL;
+    plan_IFFT      = NULL;
+    plan_FFT_many  = NULL;
+    plan_IFFT_many = NULL;
+
+    /* Free batched arrays */
+    fftwf_free( in_FFT_many ); 
+    in_FFT_many = NULL;
+    fftwf_free( out_FFT_many ); 
+    out_FFT_many = NULL;
 
     /* Free arrays */
     fftwf_free( in_FFT ); 
     in_FFT = NULL;
     fftwf_free( out_FFT ); 
     out_FFT = NULL;
-    fftwf_free( in_IFFT ); 
-    in_IFFT = NULL;
-    fftwf_free( out_IFFT ); 
-    out_IFFT = NULL;
-
-    if ( THREADED_FFT ) {
-        /* Cleanup and get rid of all memory allocated by FFTW */
-        fftw_cleanup_threads();
-    }
+    fftwf_free( factorX ); 
+    factorX = NULL;
+    fftwf_free( factorY ); 
+    factorY = NULL;
 
 } /* End of FourierTransform_2D<float>::~FourierTransform_2D */
 
-//void FourierTransform_2D<float>::Forward( scalar_type* in, complex_type* out ) const
-//{
-//
-//    /* Computes forward DFT */
-//    fftwf_execute_dft_r2c( plan_FFT, in, out );
-//
-//} /* End of FourierTransform_2D<float>::Forward */
-//
-//void FourierTransform_2D<float>::Forward( const Vector_2Df &V, complex_type* out ) const
-//{
-//
-//    UInt i = 0;
-//    UInt j = 0;
-//
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-//    for ( i = 0; i < rows; i++ ) {
-//        for ( j = 0; j < cols; j++ )
-//            in_FFT[i * cols + j] = (scalar_type) V[j][i];
-//    }
-//
-//    /* Computes forward DFT */
-//    fftwf_execute_dft_r2c( plan_FFT, in_FFT, out );
-//
-//} /* End of FourierTransform_2D<float>::Forward */
-//
-//void FourierTransform_2D<float>::Backward( complex_type* in, scalar_type* out ) const
-//{
-//
-//    /* Computes backward DFT */
-//    fftwf_execute_dft_c2r( plan_IFFT, in, out );
-//
-//} /* End of FourierTransform_2D<float>::Backward */
-//
-//void FourierTransform_2D<float>::Backward( complex_type* in, Vector_2Df &V ) const
-//{
-//
-//    UInt i = 0;
-//    UInt j = 0;
-//
-//    /* Computes backward DFT */
-//    fftwf_execute_dft_c2r( plan_IFFT, in, out_IFFT );
-//
-//    Scale( out_IFFT );
-//
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-//    for ( i = 0; i < rows; i++ ) {
-//        for ( j = 0; j < cols; j++ )
-//            V[j][i] = out_IFFT[i * cols + j];
-//    }
-//
-//
-//} /* End of FourierTransform_2D<float>::Backward */
-//
-//void FourierTransform_2D<float>::Scale( scalar_type* in ) const
-//{
-//
-//    UInt i = 0;
-//
-//    /* Scale output */
-//
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i          ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-//    for ( i = 0; i < cols * rows; i++ ) 
-//        in[i] /= fftScaling;
-//
-//} /* End of FourierTransform_2D<float>::Scale */
-
-void FourierTransform_2D<float>::SANDS( const Vector_2Df &diffFactor, \
-                                        const Vector_2Dcf &advFactor, \
-                                        Vector_2Df &V ) const
+void FourierTransform_2D<float>::SetFactors( const Vector_1Dc &propX, \
+                                             const Vector_1Dc &propY )
 {
 
-    /* It turns out that this function is much faster when running in serial */
-
-    UInt i = 0;
-    UInt j = 0;
-
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-    for ( i = 0; i < rows; i++ ) {
-        for ( j = 0; j < cols; j++ )
-            in_FFT[i * cols + j] = (scalar_type) V[j][i];
-    }
-
-    /* Computes forward DFT */
-    fftwf_execute_dft_r2c( plan_FFT, in_FFT, out_FFT );
-
-    /* Convolve and scale the frequencies */
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-    for ( i = 0; i < rows; i++ ) {
-        for ( j = 0; j < colsC; j++ ) {
-            in_IFFT[i * colsC + j][REAL] = ( out_FFT[i * colsC + j][REAL] * advFactor[j][i].real() \
-                                           - out_FFT[i * colsC + j][IMAG] * advFactor[j][i].imag() ) * diffFactor[j][i] ;
-            in_IFFT[i * colsC + j][IMAG] = ( out_FFT[i * colsC + j][REAL] * advFactor[j][i].imag() \
-                                           + out_FFT[i * colsC + j][IMAG] * advFactor[j][i].real() ) * diffFactor[j][i] ;
-        }
+    for ( UInt i = 0; i < rowsC; i++ ) {
+        factorX[i][REAL] = (scalar_type) ( propX[i].real() / fftScaling );
+        factorX[i][IMAG] = (scalar_type) ( propX[i].imag() / fftScaling );
     }
 
-    /* Computes backward DFT */
-    fftwf_execute_dft_c2r( plan_IFFT, in_IFFT, out_IFFT );
-
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-    for ( i = 0; i < rows; i++ ) {
-        for ( j = 0; j < cols; j++ )
-            V[j][i] = out_IFFT[i * cols + j] / fftScaling;
+    for ( UInt j = 0; j < cols; j++ ) {
+        factorY[j][REAL] = (scalar_type) propY[j].real();
+        factorY[j][IMAG] = (scalar_type) propY[j].imag();
     }
 
-} /* End of FourierTransform_2D<float>::SANDS */
+} /* End of FourierTransform_2D<float>::SetFactors */
 
-FourierTransform_2D<double>::FourierTransform_2D( const bool MULTITHREADED_FFT, \
-                                                  const bool WISDOM,            \
-                                                  const char* FFTW_DIR,         \
-                                                  const UInt rows_,             \
-                                                  const UInt cols_ )
-    :   rows( rows_ ),
-        cols( cols_ ),
-        colsC( cols_/2 + 1 ),
-        fftScaling( cols_ * rows_ ),
-        THREADED_FFT( MULTITHREADED_FFT )
+void FourierTransform_2D<float>::Convolve( complex_type* spectrum ) const
 {
 
-    UInt nThreads = 0;
-    int wisdomExists = 0;
-
-    std::string fileName = FFTW_DIR;
-    std::string fileName_FFT, fileName_IFFT; 
-
-    fileName += "FFTW_2Dplan_" + std::to_string(rows) \
-                             + "_" + std::to_string(cols);
+    UInt i = 0;
+    UInt j = 0;
+    scalar_type re, im, fRe, fIm;
 
-    if ( THREADED_FFT ) {
-        /* Performing the one-time initialization required to use threads with
-         * FFTW */
-        int Success = fftw_init_threads();
-        if ( Success == 0 ) {
-            std::cout << " Could not perform the initialization required by FFTW when using multiple threads" << std::endl;
-            exit(-1);
+    for ( j = 0; j < cols; j++ ) {
+        const scalar_type yRe = factorY[j][REAL];
+        const scalar_type yIm = factorY[j][IMAG];
+        complex_type* row = spectrum + j * rowsC;
+        for ( i = 0; i < rowsC; i++ ) {
+            fRe = yRe * factorX[i][REAL] - yIm * factorX[i][IMAG];
+            fIm = yRe * factorX[i][IMAG] + yIm * factorX[i][REAL];
+            re  = row[i][REAL];
+            im  = row[i][IMAG];
+            row[i][REAL] = re * fRe - im * fIm;
+            row[i][IMAG] = re * fIm + im * fRe;
         }
     }
 
-    /* Allocate the ins and outs */
-    in_FFT   = (scalar_type*)  fftw_malloc( sizeof(scalar_type)  * rows * cols  );
-    out_FFT  = (complex_type*) fftw_malloc( sizeof(complex_type) * rows * colsC );
-    in_IFFT  = (complex_type*) fftw_malloc( sizeof(complex_type) * rows * colsC );
-    out_IFFT = (scalar_type*)  fftw_malloc( sizeof(scalar_type)  * rows * cols  );
-
-    if ( THREADED_FFT ) {
-        nThreads = omp_get_max_threads();
-
-        /* All plans subsequently created with any planner routine will use 
-         * that many threads */
-        fftw_plan_with_nthreads( nThreads );
+} /* End of FourierTransform_2D<float>::Convolve */
 
-        fileName += "_" + std::to_string(nThreads);
-    }
-
-    fileName_FFT  = fileName + "_FFT.pl";
-    fileName_IFFT = fileName + "_IFFT.pl";
-
-    if ( WISDOM )
-        wisdomExists = fftw_import_wisdom_from_filename( fileName_FFT.c_str() );
-
-    /* Create FFT plan and compute the best FFT algorithm */
-    if ( wisdomExists )
-        plan_FFT = fftw_plan_dft_r2c_2d( rows, cols, in_FFT, out_FFT, FFTW_WISDOM_ONLY );
-    else
-        plan_FFT = fftw_plan_dft_r2c_2d( rows, cols, in_FFT, out_FFT, FFTW_PATIENT );
-
-    /* Check that plan was successfully created. 
-     * Otherwise exit. */
-    if ( plan_FFT == NULL ) {
-        std::cout << " In FourierTransform_2D: Plan creation failed!\n";
-        exit(-1);
-    }
+template <class Field>
+void FourierTransform_2D<float>::SANDS( Field &V ) const
+{
 
-    if ( WISDOM && ( wisdomExists == 0 ) ) {
-        /* Export wisdom from FFTW plan */
-        fftw_export_wisdom_to_filename( fileName_FFT.c_str() );
-    }
+    gatherField( V, in_FFT, rows, cols );
 
-    if ( WISDOM )
-        wisdomExists = fftw_import_wisdom_from_filename( fileName_IFFT.c_str() );
+    /* Computes forward DFT */
+    fftwf_execute_dft_r2c( plan_FFT, in_FFT, out_FFT );
 
-    /* Create IFFT plan and compute the best IFFT algorithm */
-    if ( wisdomExists )
-        plan_IFFT = fftw_plan_dft_c2r_2d( rows, cols, in_IFFT, out_IFFT, FFTW_WISDOM_ONLY );
-    else
-        plan_IFFT = fftw_plan_dft_c2r_2d( rows, cols, in_IFFT, out_IFFT, FFTW_PATIENT );
+    /* Convolve and scale the frequencies */
+    Convolve( out_FFT );
 
-    /* Check that plan was successfully created. 
-     * Otherwise exit. */
-    if ( plan_IFFT == NULL ) {
-        std::cout << " In FourierTransform_2D: Plan creation failed!\n";
-        exit(-1);
-    }
+    /* Computes backward DFT */
+    fftwf_execute_dft_c2r( plan_IFFT, out_FFT, in_FFT );
 
-    if ( WISDOM && ( wisdomExists == 0 ) ) {
-        /* Export wisdom from FFTW plan */
-        fftw_export_wisdom_to_filename( fileName_IFFT.c_str() );
-    }
+    scatterField( in_FFT, V, rows, cols );
 
-} /* End of FourierTransform_2D<double>::FourierTransform_2D */
+} /* End of FourierTransform_2D<float>::SANDS */
 
-FourierTransform_2D<double>::~FourierTransform_2D()
+template <class Field>
+void FourierTransform_2D<float>::SANDS( std::vector<Field*> &V ) const
 {
 
-    /* Free plan memory */
-    fftw_destroy_plan( plan_FFT );
-    fftw_destroy_plan( plan_IFFT );
+    UInt k = 0;
 
-    /* Free arrays */
-    fftw_free( in_FFT ); 
-    in_FFT = NULL;
-    fftw_free( out_FFT ); 
-    out_FFT = NULL;
-    fftw_free( in_IFFT ); 
-    in_IFFT = NULL;
-    fftw_free( out_IFFT ); 
-    out_IFFT = NULL;
+    const UInt nField = V.size();
 
-    if ( THREADED_FFT ) {
-        /* Cleanup and get rid of all memory allocated by FFTW */
-        fftw_cleanup_threads();
+    if ( ( plan_FFT_many == NULL ) || ( plan_IFFT_many == NULL ) ) {
+        for ( k = 0; k < nField; k++ )
+            SANDS( *V[k] );
+        return;
     }
 
-} /* End of FourierTransform_2D<double>::~FourierTransform_2D */
+    const UInt dist  = rows  * cols;
+    const UInt distC = rowsC * cols;
 
-//void FourierTransform_2D<double>::Forward( scalar_type* in, complex_type* out ) const
-//{
-//
-//    /* Computes forward DFT */
-//    fftw_execute_dft_r2c( plan_FFT, in, out );
-//
-//} /* End of FourierTransform_2D<double>::Forward */
-//
-//void FourierTransform_2D<double>::Forward( const Vector_2D &V, complex_type* out ) const
-//{
-//
-//    UInt i = 0;
-//    UInt j = 0;
-//
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-//    for ( i = 0; i < rows; i++ ) {
-//        for ( j = 0; j < cols; j++ )
-//            in_FFT[i * cols + j] = (scalar_type) V[j][i];
-//    }
-//
-//    /* Computes forward DFT */
-//    fftw_execute_dft_r2c( plan_FFT, in_FFT, out );
-//
-//} /* End of FourierTransform_2D<double>::Forward */
-//
-//void FourierTransform_2D<double>::Backward( complex_type* in, scalar_type* out ) const
-//{
-//
-//    /* Computes backward DFT */
-//    fftw_execute_dft_c2r( plan_IFFT, in, out );
-//
-//} /* End of FourierTransform_2D<double>::Backward */
-//
-//void FourierTransform_2D<double>::Backward( complex_type* in, Vector_2D &V ) const
-//{
-//
-//    UInt i = 0;
-//    UInt j = 0;
-//
-//    /* Computes backward DFT */
-//    fftw_execute_dft_c2r( plan_IFFT, in, out_IFFT );
-//
-//    Scale( out_IFFT );
-//
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-//    for ( i = 0; i < rows; i++ ) {
-//        for ( j = 0; j < cols; j++ )
-//            V[j][i] = out_IFFT[i * cols + j];
-//    }
-//
-//
-//} /* End of FourierTransform_2D<double>::Backward */
-//
-//void FourierTransform_2D<double>::Scale( scalar_type* in ) const
-//{
-//
-//    UInt i = 0;
-//
-//    /* Scale output */
-//
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i          ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-//    for ( i = 0; i < cols * rows; i++ ) 
-//        in[i] /= fftScaling;
-//
-//} /* End of FourierTransform_2D<double>::Scale */
+    UInt iField = 0;
+    UInt nCurr  = 0;
 
-void FourierTransform_2D<double>::SANDS( const Vector_2D &diffFactor, \
-                                         const Vector_2Dc &advFactor, \
-                                         Vector_2D &V ) const
-{
+    for ( iField = 0; iField < nField; iField += nBatch ) {
 
-    /* It turns out that this function is much faster when running in serial */
+        nCurr = std::min( nBatch, nField - iField );
 
-    UInt i = 0;
-    UInt j = 0;
+        if ( nCurr == 1 ) {
+            SANDS( *V[iField] );
+            continue;
+        }
 
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-    for ( i = 0; i < rows; i++ ) {
-        for ( j = 0; j < cols; j++ )
-            in_FFT[i * cols + j] = (scalar_type) V[j][i];
-    }
+        if ( nCurr < nBatch )
+            std::fill( in_FFT_many + nCurr * dist, in_FFT_many + nBatch * dist, 0.0E+00f );
 
-    /* Computes forward DFT */
-    fftw_execute_dft_r2c( plan_FFT, in_FFT, out_FFT );
+#pragma omp parallel for   \
+    default ( shared     ) \
+    private ( k          ) \
+    schedule( static     ) \
+    if ( !PARALLEL_CASES )
+        for ( k = 0; k < nCurr; k++ )
+            gatherField( *V[iField + k], in_FFT_many + k * dist, rows, cols );
 
-    /* Convolve and scale the frequencies */
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-    for ( i = 0; i < rows; i++ ) {
-        for ( j = 0; j < colsC; j++ ) {
-            in_IFFT[i * colsC + j][REAL] = ( out_FFT[i * colsC + j][REAL] * advFactor[j][i].real() \
-                                           - out_FFT[i * colsC + j][IMAG] * advFactor[j][i].imag() ) * diffFactor[j][i] ;
-            in_IFFT[i * colsC + j][IMAG] = ( out_FFT[i * colsC + j][REAL] * advFactor[j][i].imag() \
-                                           + out_FFT[i * colsC + j][IMAG] * advFactor[j][i].real() ) * diffFactor[j][i] ;
-        }
-    }
+        /* Computes forward DFTs */
+        fftwf_execute_dft_r2c( plan_FFT_many, in_FFT_many, out_FFT_many );
 
-    /* Computes backward DFT */
-    fftw_execute_dft_c2r( plan_IFFT, in_IFFT, out_IFFT );
+        /* Convolve and scale the frequencies */
+#pragma omp parallel for   \
+    default ( shared     ) \
+    private ( k          ) \
+    schedule( static     ) \
+    if ( !PARALLEL_CASES )
+        for ( k = 0; k < nCurr; k++ )
+            Convolve( out_FFT_many + k * distC );
+
+        /* Computes backward DFTs */
+        fftwf_execute_dft_c2r( plan_IFFT_many, out_FFT_many, in_FFT_many );
+
+#pragma omp parallel for   \
+    default ( shared     ) \
+    private ( k          ) \
+    schedule( static     ) \
+    if ( !PARALLEL_CASES )
+        for ( k = 0; k < nCurr; k++ )
+            scatterField( in_FFT_many + k * dist, *V[iField + k], rows, cols );
 
-//#pragma omp parallel for   \
-//    default ( shared     ) \
-//    private ( i, j       ) \
-//    schedule( dynamic, 1 ) \
-//    if ( !PARALLEL_CASES )
-    for ( i = 0; i < rows; i++ ) {
-        for ( j = 0; j < cols; j++ )
-            V[j][i] = out_IFFT[i * cols + j] / fftScaling;
     }
 
-} /* End of FourierTransform_2D<double>::SANDS */
+} /* End of FourierTransform_2D<float>::SANDS */
+
+template void FourierTransform_2D<float>::SANDS<Vector_2D>( Vector_2D &V ) const;
+template void FourierTransform_2D<float>::SANDS<Field2D>( Field2D &V ) const;
+template void FourierTransform_2D<float>::SANDS<Vector_2D>( std::vector<Vector_2D*> &V ) const;
+template void FourierTransform_2D<float>::SANDS<Field2D>( std::vector<Field2D*> &V ) const;
 
 
 FourierTransform_2D<long double>::FourierTransform_2D( const bool MULTITHREADED_FFT, \
@@ -0,0 +1,338 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*              Spectral Advection aNd Diffusion Solver             */
+/*                             (SANDS)                              */
+/*                                                                  */
+/* PlanRegistry Program File                                        */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : PlanRegistry.cpp                          */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <map>
+#include <set>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/stat.h>
+#ifdef OMP
+    #include "omp.h"
+#endif /* OMP */
+
+#include "SANDS/PlanRegistry.hpp"
+
+struct PlanKey
+{
+
+    int type;
+    UInt n0, n1;
+    UInt howMany;
+    UInt nThreads;
+
+    bool operator<( const PlanKey &rhs ) const
+    {
+        if ( type    != rhs.type    ) return type    < rhs.type;
+        if ( n0      != rhs.n0      ) return n0      < rhs.n0;
+        if ( n1      != rhs.n1      ) return n1      < rhs.n1;
+        if ( howMany != rhs.howMany ) return howMany < rhs.howMany;
+        return nThreads < rhs.nThreads;
+    }
+
+};
+
+/* Precision-specific FFTW entry points */
+template <typename T>
+struct FFTW_Traits;
+
+template <>
+struct FFTW_Traits<double>
+{
+
+    typedef fftw_plan    plan_type;
+    typedef double       scalar_type;
+    typedef fftw_complex complex_type;
+
+    static const char* WisdomFile( ) { return FFTW_WISDOM_FILE; }
+
+    static void* Malloc( const size_t n )             { return fftw_malloc( n ); }
+    static void  Free( void* p )                      { fftw_free( p ); }
+    static int   InitThreads( )                       { return fftw_init_threads(); }
+    static void  PlanWithNThreads( const int n )      { fftw_plan_with_nthreads( n ); }
+    static void  CleanupThreads( )                    { fftw_cleanup_threads(); }
+    static void  DestroyPlan( plan_type p )           { fftw_destroy_plan( p ); }
+    static int   ImportWisdom( const char* f )        { return fftw_import_wisdom_from_filename( f ); }
+    static int   ExportWisdom( const char* f )        { return fftw_export_wisdom_to_filename( f ); }
+
+    static plan_type PlanR2C( int rank, const int* n, int howMany, scalar_type* in, int dist,        \
+                              complex_type* out, int distC, unsigned flags )
+    { return fftw_plan_many_dft_r2c( rank, n, howMany, in, NULL, 1, dist, out, NULL, 1, distC, flags ); }
+
+    static plan_type PlanC2R( int rank, const int* n, int howMany, complex_type* in, int distC,      \
+                              scalar_type* out, int dist, unsigned flags )
+    { return fftw_plan_many_dft_c2r( rank, n, howMany, in, NULL, 1, distC, out, NULL, 1, dist, flags ); }
+
+};
+
+template <>
+struct FFTW_Traits<float>
+{
+
+    typedef fftwf_plan    plan_type;
+    typedef float         scalar_type;
+    typedef fftwf_complex complex_type;
+
+    static const char* WisdomFile( ) { return FFTW_WISDOM_FILE_F; }
+
+    static void* Malloc( const size_t n )             { return fftwf_malloc( n ); }
+    static void  Free( void* p )                      { fftwf_free( p ); }
+    static int   InitThreads( )                       { return fftwf_init_threads(); }
+    static void  PlanWithNThreads( const int n )      { fftwf_plan_with_nthreads( n ); }
+    static void  CleanupThreads( )                    { fftwf_cleanup_threads(); }
+    static void  DestroyPlan( plan_type p )           { fftwf_destroy_plan( p ); }
+    static int   ImportWisdom( const char* f )        { return fftwf_import_wisdom_from_filename( f ); }
+    static int   ExportWisdom( const char* f )        { return fftwf_export_wisdom_to_filename( f ); }
+
+    static plan_type PlanR2C( int rank, const int* n, int howMany, scalar_type* in, int dist,        \
+                              complex_type* out, int distC, unsigned flags )
+    { return fftwf_plan_many_dft_r2c( rank, n, howMany, in, NULL, 1, dist, out, NULL, 1, distC, flags ); }
+
+    static plan_type PlanC2R( int rank, const int* n, int howMany, complex_type* in, int distC,      \
+                              scalar_type* out, int dist, unsigned flags )
+    { return fftwf_plan_many_dft_c2r( rank, n, howMany, in, NULL, 1, distC, out, NULL, 1, dist, flags ); }
+
+};
+
+/* Registry state, one per precision. Only accessed inside the
+ * FFTW_PLANNER critical section. */
+template <typename T>
+struct RegistryState
+{
+
+    std::map<PlanKey, typename FFTW_Traits<T>::plan_type> plans;
+    std::set<std::string> importedWisdom;
+    bool threadsInitialized;
+
+    RegistryState( ): threadsInitialized( 0 ) { }
+
+    static RegistryState& Instance( )
+    {
+        static RegistryState state;
+        return state;
+    }
+
+};
+
+template <typename T>
+static void StoreWisdom( const std::string &fileName )
+{
+
+    /* Merge with whatever another process may have stored in the meantime */
+    struct stat sb;
+    if ( stat( fileName.c_str(), &sb ) == 0 )
+        FFTW_Traits<T>::ImportWisdom( fileName.c_str() );
+
+    /* Write to a temporary file and rename it, so that readers never see
+     * a partially written wisdom file */
+    const std::string tmpName = fileName + ".tmp." + std::to_string( getpid() );
+
+    if ( FFTW_Traits<T>::ExportWisdom( tmpName.c_str() ) == 0 ) {
+        std::cout << " In FFT_PlanRegistry: Could not write wisdom to " << tmpName << "\n";
+        std::remove( tmpName.c_str() );
+        return;
+    }
+
+    if ( std::rename( tmpName.c_str(), fileName.c_str() ) != 0 ) {
+        std::cout << " In FFT_PlanRegistry: Could not move wisdom to " << fileName << "\n";
+        std::remove( tmpName.c_str() );
+    }
+
+} /* End of StoreWisdom */
+
+template <typename T>
+static typename FFTW_Traits<T>::plan_type GetPlan( const int type,                \
+                                                   const UInt n0,                 \
+                                                   const UInt n1,                 \
+                                                   const UInt howMany,            \
+                                                   const bool MULTITHREADED_FFT,  \
+                                                   const bool WISDOM,             \
+                                                   const char* FFTW_DIR )
+{
+
+    typedef FFTW_Traits<T> Traits;
+    typedef typename Traits::plan_type    plan_type;
+    typedef typename Traits::scalar_type  scalar_type;
+    typedef typename Traits::complex_type complex_type;
+
+    PlanKey key;
+    key.type     = type;
+    key.n0       = n0;
+    key.n1       = n1;
+    key.howMany  = howMany;
+    key.nThreads = 1;
+#ifdef OMP
+    if ( MULTITHREADED_FFT )
+        key.nThreads = omp_get_max_threads();
+#endif /* OMP */
+
+    plan_type plan = NULL;
+
+    #pragma omp critical ( FFTW_PLANNER )
+    {
+
+        RegistryState<T> &state = RegistryState<T>::Instance();
+
+        typename std::map<PlanKey, plan_type>::const_iterator it = state.plans.find( key );
+
+        if ( it != state.plans.end() ) {
+            plan = it->second;
+        } else {
+
+            const std::string fileName = std::string( FFTW_DIR ) + Traits::WisdomFile();
+            int wisdomExists = 0;
+
+            if ( WISDOM ) {
+                if ( state.importedWisdom.count( fileName ) == 0 ) {
+                    Traits::ImportWisdom( fileName.c_str() );
+                    state.importedWisdom.insert( fileName );
+                }
+                wisdomExists = 1;
+            }
+
+            if ( MULTITHREADED_FFT && !state.threadsInitialized ) {
+                /* Performing the one-time initialization required to use
+                 * threads with FFTW */
+                if ( Traits::InitThreads() == 0 ) {
+                    std::cout << " Could not perform the initialization required by FFTW when using multiple threads" << std::endl;
+                    exit(-1);
+                }
+                state.threadsInitialized = 1;
+            }
+
+            /* All plans subsequently created with any planner routine will
+             * use that many threads */
+            if ( state.threadsInitialized )
+                Traits::PlanWithNThreads( key.nThreads );
+
+            const int rank  = ( n1 == 0 ) ? 1 : 2;
+            const int n[2]  = { (int) n0, (int) n1 };
+            const UInt nLast  = ( rank == 1 ) ? n0 : n1;
+            const int dist  = ( rank == 1 ) ? n0 : n0 * n1;
+            const int distC = ( rank == 1 ) ? ( nLast/2 + 1 ) : n0 * ( nLast/2 + 1 );
+
+            /* Planning buffers, only used to measure the best algorithm */
+            scalar_type*  real  = (scalar_type*)  Traits::Malloc( sizeof(scalar_type)  * howMany * dist  );
+            complex_type* cmplx = (complex_type*) Traits::Malloc( sizeof(complex_type) * howMany * distC );
+
+            for ( UInt iPass = ( wisdomExists ? 0 : 1 ); ( iPass < 2 ) && ( plan == NULL ); iPass++ ) {
+                /* First pass only uses wisdom, second pass measures */
+                const unsigned flags = ( iPass == 0 ) ? FFTW_WISDOM_ONLY : FFTW_PATIENT;
+
+                if ( type == FFT_PlanRegistry::R2C )
+                    plan = Traits::PlanR2C( rank, n, howMany, real, dist, cmplx, distC, flags );
+                else
+                    plan = Traits::PlanC2R( rank, n, howMany, cmplx, distC, real, dist, flags );
+
+                if ( ( plan != NULL ) && ( iPass == 1 ) && WISDOM )
+                    StoreWisdom<T>( fileName );
+            }
+
+            Traits::Free( real );
+            Traits::Free( cmplx );
+
+            /* Check that plan was successfully created.
+             * Otherwise exit. */
+            if ( plan == NULL ) {
+                std::cout << " In FFT_PlanRegistry: Plan creation failed!\n";
+                exit(-1);
+            }
+
+            state.plans[key] = plan;
+
+        }
+
+    }
+
+    return plan;
+
+} /* End of GetPlan */
+
+template <typename T>
+static void ClearPlans( )
+{
+
+    typedef FFTW_Traits<T> Traits;
+
+    RegistryState<T> &state = RegistryState<T>::Instance();
+
+    typename std::map<PlanKey, typename Traits::plan_type>::iterator it;
+    for ( it = state.plans.begin(); it != state.plans.end(); ++it )
+        Traits::DestroyPlan( it->second );
+
+    state.plans.clear();
+    state.importedWisdom.clear();
+
+    if ( state.threadsInitialized ) {
+        /* Cleanup and get rid of all memory allocated by FFTW */
+        Traits::CleanupThreads();
+        state.threadsInitialized = 0;
+    }
+
+} /* End of ClearPlans */
+
+fftw_plan FFT_PlanRegistry::Get( const PlanType type,             \
+                                 const UInt n0,                   \
+                                 const UInt n1,                   \
+                                 const UInt howMany,              \
+                                 const bool MULTITHREADED_FFT,    \
+                                 const bool WISDOM,               \
+                                 const char* FFTW_DIR )
+{
+
+    return GetPlan<double>( type, n0, n1, howMany, \
+                            MULTITHREADED_FFT, WISDOM, FFTW_DIR );
+
+} /* End of FFT_PlanRegistry::Get */
+
+fftwf_plan FFT_PlanRegistry::GetSingle( const PlanType type,             \
+                                        const UInt n0,                   \
+                                        const UInt n1,                   \
+                                        const UInt howMany,              \
+                                        const bool MULTITHREADED_FFT,    \
+                                        const bool WISDOM,               \
+                                        const char* FFTW_DIR )
+{
+
+    return GetPlan<float>( type, n0, n1, howMany, \
+                           MULTITHREADED_FFT, WISDOM, FFTW_DIR );
+
+} /* End of FFT_PlanRegistry::GetSingle */
+
+UInt FFT_PlanRegistry::Size( )
+{
+
+    UInt size = 0;
+
+    #pragma omp critical ( FFTW_PLANNER )
+    {
+        size = RegistryState<double>::Instance().plans.size() \
+             + RegistryState<float>::Instance().plans.size();
+    }
+
+    return size;
+
+} /* End of FFT_PlanRegistry::Size */
+
+void FFT_PlanRegistry::Clear( )
+{
+
+    #pragma omp critical ( FFTW_PLANNER )
+    {
+        ClearPlans<double>();
+        ClearPlans<float>();
+    }
+
+} /* End of FFT_PlanRegistry::Clear */
+
+/* End of PlanRegistry.cpp */
@@ -0,0 +1,153 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*              Spectral Advection aNd Diffusion Solver             */
+/*                             (SANDS)                              */
+/*                                                                  */
+/* PrecisionCheck Program File                                      */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : PrecisionCheck.cpp                        */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <algorithm>
+
+#include "Core/Parameters.hpp"
+#include "Core/Mesh.hpp"
+#include "Util/Field.hpp"
+#include "SANDS/Solver.hpp"
+#include "SANDS/PrecisionCheck.hpp"
+
+namespace SANDS
+{
+
+    static RealDouble Mass( const Field2D &V, const Vector_2D &cellAreas )
+    {
+
+        RealDouble mass = 0.0E+00;
+
+        for ( UInt jNy = 0; jNy < V.Ny(); jNy++ ) {
+            for ( UInt iNx = 0; iNx < V.Nx(); iNx++ )
+                mass += V[jNy][iNx] * cellAreas[jNy][iNx];
+        }
+
+        return mass;
+
+    } /* End of Mass */
+
+    RealDouble PrecisionCheck( const bool MULTITHREADED_FFT, \
+                               const bool WISDOM,            \
+                               const char* FFTW_DIR )
+    {
+
+        /* Representative transport parameters */
+        const RealDouble dt     = 600.0;    /* [s] */
+        const RealDouble dH     = 15.0;     /* [m^2/s] */
+        const RealDouble dV     = 0.15;     /* [m^2/s] */
+        const RealDouble vFall  = -5.0E-03; /* [m/s] */
+        const RealDouble shear  = 2.0E-03;  /* [1/s] */
+        const UInt nStep        = 36;
+        const UInt nPrint       = 6;
+
+        /* Initial plume dimensions */
+        const RealDouble sigmaX = 200.0;    /* [m] */
+        const RealDouble sigmaY = 50.0;     /* [m] */
+
+        const char* names[3] = { "Species", "Aerosols", "Ring weights" };
+
+        Mesh m;
+        const Vector_2D &cellAreas = m.areas();
+
+        Solver Solver;
+        Solver.Initialize( /* Use threaded FFT?    */ MULTITHREADED_FFT, \
+                           /* Use FFTW wisdom?     */ WISDOM,            \
+                           /* FFTW Directory       */ FFTW_DIR,          \
+                           /* Fill negative values */ 0,                 \
+                           /* Fill with this value */ 0.0E+00,           \
+                           /* Fill option          */ 1,                 \
+                           /* Single precision?    */ 1 );
+        Solver.UpdateTimeStep( dt );
+
+        Field2D V_d( NY, NX ), V_f( NY, NX );
+
+        RealDouble maxL2 = 0.0E+00;
+
+        std::cout << "\n Single vs. double precision transport on a ";
+        std::cout << NX << "x" << NY << " grid" << std::endl;
+        std::cout << std::setw(14) << "Class"  << std::setw(6) << "Step";
+        std::cout << std::setw(14) << "dMass (dbl)" << std::setw(14) << "dMass (sgl)";
+        std::cout << std::setw(14) << "L2 error" << std::setw(14) << "Max error" << std::endl;
+        std::cout << std::scientific << std::setprecision(3);
+
+        for ( UInt iClass = 0; iClass < 3; iClass++ ) {
+
+            /* Species diffuse, aerosols diffuse and settle, ring weights
+             * are only sheared */
+            if ( iClass == 2 ) {
+                Solver.UpdateDiff( 0.0E+00, 0.0E+00 );
+                Solver.UpdateAdv ( 0.0E+00, 0.0E+00 );
+            } else {
+                Solver.UpdateDiff( dH, dV );
+                Solver.UpdateAdv ( 0.0E+00, ( iClass == 1 ) ? vFall : 0.0E+00 );
+            }
+            Solver.UpdateShear( shear, m.y() );
+
+            for ( UInt jNy = 0; jNy < NY; jNy++ ) {
+                for ( UInt iNx = 0; iNx < NX; iNx++ ) {
+                    const RealDouble x = m.x()[iNx] / sigmaX;
+                    const RealDouble y = m.y()[jNy] / sigmaY;
+                    V_d[jNy][iNx] = 1.0E+12 * exp( -0.5 * ( x * x + y * y ) );
+                }
+            }
+            V_f = V_d;
+
+            const RealDouble mass0 = Mass( V_d, cellAreas );
+
+            for ( UInt iStep = 1; iStep <= nStep; iStep++ ) {
+
+                /* No filling, so that only the transform error is seen */
+                Solver.Run( V_d, cellAreas, -1, 0 );
+                Solver.Run( V_f, cellAreas, -1, 1 );
+
+                if ( ( iStep % nPrint ) != 0 )
+                    continue;
+
+                RealDouble err2 = 0.0E+00, norm2 = 0.0E+00;
+                RealDouble errMax = 0.0E+00, normMax = 0.0E+00;
+
+                for ( UInt jNy = 0; jNy < NY; jNy++ ) {
+                    for ( UInt iNx = 0; iNx < NX; iNx++ ) {
+                        const RealDouble diff = V_f[jNy][iNx] - V_d[jNy][iNx];
+                        err2   += diff * diff;
+                        norm2  += V_d[jNy][iNx] * V_d[jNy][iNx];
+                        errMax  = std::max( errMax, std::fabs( diff ) );
+                        normMax = std::max( normMax, std::fabs( V_d[jNy][iNx] ) );
+                    }
+                }
+
+                const RealDouble L2 = sqrt( err2 / norm2 );
+                maxL2 = std::max( maxL2, L2 );
+
+                std::cout << std::setw(14) << names[iClass] << std::setw(6) << iStep;
+                std::cout << std::setw(14) << ( Mass( V_d, cellAreas ) - mass0 ) / mass0;
+                std::cout << std::setw(14) << ( Mass( V_f, cellAreas ) - mass0 ) / mass0;
+                std::cout << std::setw(14) << L2;
+                std::cout << std::setw(14) << errMax / normMax << std::endl;
+
+            }
+
+        }
+
+        std::cout << " Largest relative L2 error: " << maxL2 << std::endl;
+
+        return maxL2;
+
+    } /* End of PrecisionCheck */
+
+} /* SANDS */
+
+/* End of PrecisionCheck.cpp */
@@ -31,12 +31,19 @@ namespace SANDS
         doFill( 1 ),
         fillOpt( 1 ),
         fillVal( 0.0E+00 ),
+        factorsChanged( 1 ),
+        multiThreadedFFT( 0 ),
+        useWisdom( 0 ),
         FFT_1D( NULL ),
-        FFT_2D( NULL )
+        FFT_2D( NULL ),
+        FFT_2Df( NULL ),
+        nRun( 0 ),
+        nSkipped( 0 )
     {
 
         /* Constructor */
 
+        dt    = 0.0E+00;
         shear = 0.0E+00;
         dH    = 0.0E+00;
         dV    = 0.0E+00;
@@ -50,18 +57,15 @@ namespace SANDS
                              const char* FFTW_DIR,         \
                              const bool fill_,             \
                              const RealDouble fillVal_,    \
-                             const UInt fillOpt_ )
+                             const UInt fillOpt_,          \
+                             const bool singlePrecision )
     {
     
-        FFT_1D = new FourierTransform_1D<RealDouble>( MULTITHREADED_FFT, \
-                                                      USE_FFTW_WISDOM,   \
-                                                      FFTW_DIR,          \
-                                                      n_x );
-        FFT_2D = new FourierTransform_2D<RealDouble>( MULTITHREADED_FFT, \
-                                                      USE_FFTW_WISDOM,   \
-                                                      FFTW_DIR,          \
-                                                      n_x,               \
-                                                      n_y );
+        multiThreadedFFT = MULTITHREADED_FFT;
+        useWisdom        = USE_FFTW_WISDOM;
+        wisdomDir        = FFTW_DIR;
+
+        CreateTransforms( singlePrecision );
 
         doFill  = fill_;
         fillOpt = fillOpt_;
@@ -77,18 +81,95 @@ namespace SANDS
         vH    = -1.234E+56;
         vV    = -1.234E+56;
 
-        /* Initialize diffusion and advection fields */
-        Vector_1D  tempRow( n_x, 0.0E+00 );
-        Vector_1Dc tempRowc( n_x, 0.0E+00 );
+        /* Initialize diffusion and advection propagators */
+        DiffX.assign( n_x, 1.0E+00 );
+        DiffY.assign( n_y, 1.0E+00 );
+        AdvX .assign( n_x, 1.0E+00 );
+        AdvY .assign( n_y, 1.0E+00 );
 
-        for ( UInt i = 0; i < n_y; i++ ) {
-            DiffFactor .push_back( tempRow );
-            AdvFactor  .push_back( tempRowc );
-            ShearFactor.push_back( tempRowc );
-        }
+        /* Initialize shear field */
+        ShearFactor.assign( n_y, Vector_1Dc( n_x, 0.0E+00 ) );
     
     } /* End of Solver::Initialize */
 
+    void Solver::CreateTransforms( const bool singlePrecision )
+    {
+
+        const char* FFTW_DIR = wisdomDir.c_str();
+
+        FFT_1D = new FourierTransform_1D<RealDouble>( multiThreadedFFT, \
+                                                      useWisdom,        \
+                                                      FFTW_DIR,         \
+                                                      n_x );
+        FFT_2D = new FourierTransform_2D<RealDouble>( multiThreadedFFT, \
+                                                      useWisdom,        \
+                                                      FFTW_DIR,         \
+                                                      n_x,              \
+                                                      n_y,              \
+                                                      SANDS_NBATCH );
+
+        /* Single precision transforms are only set up when at least one
+         * class of fields uses them */
+        if ( singlePrecision )
+            FFT_2Df = new FourierTransform_2D<float>( multiThreadedFFT, \
+                                                      useWisdom,        \
+                                                      FFTW_DIR,         \
+                                                      n_x,              \
+                                                      n_y,              \
+                                                      SANDS_NBATCH );
+
+    } /* End of Solver::CreateTransforms */
+
+    void Solver::Regrid( const Mesh &m )
+    {
+
+        n_x        = m.Nx();
+        n_y        = m.Ny();
+        xlim_left  = m.xlimLeft();
+        xlim_right = m.xlimRight();
+        ylim_down  = m.ylimDown();
+        ylim_up    = m.ylimUp();
+
+        /* Not initialized yet */
+        if ( FFT_2D == NULL )
+            return;
+
+        const bool singlePrecision = ( FFT_2Df != NULL );
+
+        delete FFT_1D;
+        delete FFT_2D;
+        if ( FFT_2Df != NULL )
+            delete FFT_2Df;
+
+        FFT_1D  = NULL;
+        FFT_2D  = NULL;
+        FFT_2Df = NULL;
+
+        /* Plans for the new dimensions come from the registry */
+        CreateTransforms( singlePrecision );
+
+        AssignFreq();
+
+        /* All propagators depend on the grid */
+        StepCache.clear();
+
+        shear = -1.234E+56;
+        dH    = -1.234E+56;
+        dV    = -1.234E+56;
+        vH    = -1.234E+56;
+        vV    = -1.234E+56;
+
+        DiffX.assign( n_x, 1.0E+00 );
+        DiffY.assign( n_y, 1.0E+00 );
+        AdvX .assign( n_x, 1.0E+00 );
+        AdvY .assign( n_y, 1.0E+00 );
+        ShearFactor.assign( n_y, Vector_1Dc( n_x, 0.0E+00 ) );
+        AdvYCache.clear();
+
+        factorsChanged = 1;
+
+    } /* End of Solver::Regrid */
+
     Solver::~Solver( )
     {
 
@@ -100,6 +181,9 @@ namespace SANDS
         delete FFT_2D;
         /* ^ Calls ~FFT_2D */
 
+        if ( FFT_2Df != NULL )
+            delete FFT_2Df;
+
     } /* End of Solver::~Solver */
 
     void Solver::AssignFreq( )
@@ -117,10 +201,13 @@ namespace SANDS
 
         /* TODO: Parallelize these blocks */
 
+        kx .assign( n_x, 0.0 );
+        kxx.assign( n_x, 0.0 );
+        ky .assign( n_y, 0.0 );
+        kyy.assign( n_y, 0.0 );
+
         i0 = n_x/2;
         for ( UInt i = 0; i < n_x; i++ ) {
-            kx.push_back( 0.0 );
-            kxx.push_back( 0.0 );
             k = (i0%n_x) - n_x/2;
             kx[i] = 2.0 * physConst::PI / ( xlim_left + xlim_right ) * k;
             kxx[i] = - kx[i] * kx[i];
@@ -129,8 +216,6 @@ namespace SANDS
 
         i0 = n_y/2;
         for ( UInt j = 0; j < n_y; j++ ) {
-            ky.push_back( 0.0 );
-            kyy.push_back( 0.0 );
             k = (i0%n_y) - n_y/2;
             ky[j] = 2.0 * physConst::PI / ( ylim_down + ylim_up ) * k;
             kyy[j] = - ky[j] * ky[j];
@@ -141,6 +226,13 @@ namespace SANDS
     
     Vector_2D Solver::getDiffFactor( ) const
     {
+
+        Vector_2D DiffFactor( n_y, Vector_1D( n_x, 0.0E+00 ) );
+
+        for ( UInt jNy = 0; jNy < n_y; jNy++ ) {
+            for ( UInt iNx = 0; iNx < n_x; iNx++ )
+                DiffFactor[jNy][iNx] = DiffX[iNx] * DiffY[jNy];
+        }
     
         return DiffFactor;
 
@@ -148,6 +240,13 @@ namespace SANDS
 
     Vector_2Dc Solver::getAdvFactor( ) const
     {
+
+        Vector_2Dc AdvFactor( n_y, Vector_1Dc( n_x, 0.0E+00 ) );
+
+        for ( UInt jNy = 0; jNy < n_y; jNy++ ) {
+            for ( UInt iNx = 0; iNx < n_x; iNx++ )
+                AdvFactor[jNy][iNx] = AdvX[iNx] * AdvY[jNy];
+        }
     
         return AdvFactor;
 
@@ -161,8 +260,67 @@ namespace SANDS
             exit(-1);
         }
 
+        if ( T == dt )
+            return;
+
+        /* Store propagators of the current time step */
+        if ( dt > 0.0E+00 ) {
+            if ( StepCache.size() >= SANDS_NTIMESTEP )
+                StepCache.clear();
+
+            StepPropagators &P = StepCache[dt];
+            P.dH    = dH;
+            P.dV    = dV;
+            P.vH    = vH;
+            P.vV    = vV;
+            P.shear = shear;
+            P.DiffX.swap( DiffX );
+            P.DiffY.swap( DiffY );
+            P.AdvX .swap( AdvX  );
+            P.AdvY .swap( AdvY  );
+            P.ShearFactor.swap( ShearFactor );
+            P.AdvYCache  .swap( AdvYCache   );
+        }
+
         dt = T;
 
+        std::map<RealDouble, StepPropagators>::iterator it = StepCache.find( dt );
+
+        if ( it != StepCache.end() ) {
+            /* Restore propagators of that time step */
+            StepPropagators &P = it->second;
+            dH    = P.dH;
+            dV    = P.dV;
+            vH    = P.vH;
+            vV    = P.vV;
+            shear = P.shear;
+            DiffX.swap( P.DiffX );
+            DiffY.swap( P.DiffY );
+            AdvX .swap( P.AdvX  );
+            AdvY .swap( P.AdvY  );
+            ShearFactor.swap( P.ShearFactor );
+            AdvYCache  .swap( P.AdvYCache   );
+
+            StepCache.erase( it );
+        } else {
+            /* Force the propagators to be recomputed */
+            shear = -1.234E+56;
+            dH    = -1.234E+56;
+            dV    = -1.234E+56;
+            vH    = -1.234E+56;
+            vV    = -1.234E+56;
+
+            DiffX.assign( n_x, 1.0E+00 );
+            DiffY.assign( n_y, 1.0E+00 );
+            AdvX .assign( n_x, 1.0E+00 );
+            AdvY .assign( n_y, 1.0E+00 );
+            ShearFactor.assign( n_y, Vector_1Dc( n_x, 0.0E+00 ) );
+            AdvYCache.clear();
+        }
+
+        /* FFT_2D holds the factors of the previous time step */
+        factorsChanged = 1;
+
     } /* End of Solver::UpdateTimeStep */
 
     void Solver::UpdateDiff( const RealDouble dH_, const RealDouble dV_ )
@@ -184,20 +342,22 @@ namespace SANDS
             exit(-1);
         }
 
-        if ( ( dH_ != dH ) || ( dV_ != dV ) ) {
+        if ( dH_ != dH ) {
             dH = dH_;
+
+            for ( iNx = 0; iNx < n_x; iNx++ )
+                DiffX[iNx] = exp( dt * dH * kxx[iNx] );
+
+            factorsChanged = 1;
+        }
+
+        if ( dV_ != dV ) {
             dV = dV_;
 
-#pragma omp parallel for                \
-            if      ( !PARALLEL_CASES ) \
-            default ( shared          ) \
-            private ( iNx, jNy        ) \
-            schedule( dynamic, 1      )
-            for ( iNx = 0; iNx < n_x; iNx++ ) {
-                for ( jNy = 0; jNy < n_y; jNy++ )
-                    DiffFactor[jNy][iNx] = \
-                            exp( dt * ( dH * kxx[iNx] + dV * kyy[jNy] ) );
-            }
+            for ( jNy = 0; jNy < n_y; jNy++ )
+                DiffY[jNy] = exp( dt * dV * kyy[jNy] );
+
+            factorsChanged = 1;
         }
 
     } /* End of Solver::UpdateDiff */
@@ -211,21 +371,32 @@ namespace SANDS
         // vH > 0 means left, < 0 means right
         // vV > 0 means downwards, < 0 means upwards
 
-        if ( ( vH_ != vH ) || ( vV_ != vV ) ) {
+        if ( vH_ != vH ) {
             vH = vH_;
+
+            for ( iNx = 0; iNx < n_x; iNx++ )
+                AdvX[iNx] = exp( physConst::_1j * dt * vH * kx[iNx] );
+
+            factorsChanged = 1;
+        }
+
+        if ( vV_ != vV ) {
             vV = vV_;
 
-#pragma omp parallel for                \
-            if      ( !PARALLEL_CASES ) \
-            default ( shared          ) \
-            private ( iNx, jNy        ) \
-            schedule( dynamic, 1      )
-            for ( iNx = 0; iNx < n_x; iNx++ ) {
+            std::map<RealDouble, Vector_1Dc>::const_iterator it = AdvYCache.find( vV );
+
+            if ( it != AdvYCache.end() ) {
+                AdvY = it->second;
+            } else {
                 for ( jNy = 0; jNy < n_y; jNy++ )
-                    AdvFactor[jNy][iNx] =                             \
-                            exp( physConst::_1j * dt * ( vH * kx[iNx] \
-                                                       + vV * ky[jNy] ) );
+                    AdvY[jNy] = exp( physConst::_1j * dt * vV * ky[jNy] );
+
+                if ( AdvYCache.size() >= SANDS_NSETTLING )
+                    AdvYCache.clear();
+                AdvYCache[vV] = AdvY;
             }
+
+            factorsChanged = 1;
         }
 
     } /* End of Solver::UpdateAdv */
@@ -268,7 +439,45 @@ namespace SANDS
 
     } /* End of Solver::UpdateShear */
 
-    void Solver::Run( Vector_2D &V, const Vector_2D &cellAreas, const int fillOpt_ )
+    void Solver::SetFactors( )
+    {
+
+        if ( !factorsChanged )
+            return;
+
+        Vector_1Dc propX( n_x, 0.0E+00 );
+        Vector_1Dc propY( n_y, 0.0E+00 );
+
+        for ( UInt iNx = 0; iNx < n_x; iNx++ )
+            propX[iNx] = DiffX[iNx] * AdvX[iNx];
+
+        for ( UInt jNy = 0; jNy < n_y; jNy++ )
+            propY[jNy] = DiffY[jNy] * AdvY[jNy];
+
+        FFT_2D->SetFactors( propX, propY );
+        if ( FFT_2Df != NULL )
+            FFT_2Df->SetFactors( propX, propY );
+
+        factorsChanged = 0;
+
+    } /* End of Solver::SetFactors */
+
+    FourierTransform_2D<float>* Solver::getFFT_2Df( ) const
+    {
+
+        if ( FFT_2Df == NULL ) {
+            std::cout << " In Solver::Run: Single precision transport was not initialized!\n";
+            std::cout << " Call Solver::Initialize with singlePrecision = 1\n";
+            exit(-1);
+        }
+
+        return FFT_2Df;
+
+    } /* End of Solver::getFFT_2Df */
+
+    template <class Field>
+    void Solver::Run( Field &V, const Vector_2D &cellAreas, const int fillOpt_, \
+                      const bool singlePrecision )
     {
 
         UInt iNx = 0;
@@ -290,6 +499,14 @@ namespace SANDS
             }
         }
 
+        /* Transport leaves a uniform field unchanged */
+        RealDouble backg = 0.0E+00;
+        if ( !Perturbation( V, backg ) ) {
+            nSkipped++;
+            return;
+        }
+        nRun++;
+
         /* Operator splitting approach:
          * 1) Solve outward diffusion and advection/settling
          * 2) Apply shear forces
@@ -297,13 +514,21 @@ namespace SANDS
          */
 
         /* 1) Apply diffusion and settling */
-        FFT_2D->SANDS( DiffFactor, AdvFactor, V );
+        if ( !Stationary( ) ) {
+            SetFactors( );
+            if ( singlePrecision )
+                getFFT_2Df()->SANDS( V );
+            else
+                FFT_2D->SANDS( V );
+        }
 
         /* 2) Apply shear forces */
         if ( shear != 0 ) {
             FFT_1D->ApplyShear( ShearFactor, V );
         }
 
+        AddBackground( V, backg );
+
         /* 3) Apply corrections */
         /* Fill negative values with fillVal */
         if ( doFill && ( fillOpt_ == 0 ) ) {
@@ -317,7 +542,192 @@ namespace SANDS
 
     } /* End of Solver::Run */
 
-    void Solver::Fill( Vector_2D &V, const RealDouble val, \
+    template <class Field>
+    void Solver::RunMany( std::vector<Field*> &V, const Vector_2D &cellAreas, \
+                          const int fillOpt_, const bool singlePrecision )
+    {
+
+        UInt iNx = 0;
+        UInt jNy = 0;
+        UInt k   = 0;
+
+        const UInt nField = V.size();
+
+        if ( nField == 0 )
+            return;
+
+        Vector_1D mass0( nField, 0.0E+00 );
+        RealDouble mass = 0.0E+00;
+
+        /* For diagnostic or enforce mass exact conservation, compute mass */
+        if ( doFill && fillOpt_ == 1 ) {
+            for ( k = 0; k < nField; k++ ) {
+                mass = 0.0E+00;
+#pragma omp parallel for                     \
+                if       ( !PARALLEL_CASES ) \
+                default  ( shared          ) \
+                private  ( iNx, jNy        ) \
+                reduction( +:mass          ) \
+                schedule ( dynamic, 1      )
+                for ( jNy = 0; jNy < n_y; jNy++ ) {
+                    for ( iNx = 0; iNx < n_x; iNx++ )
+                        mass += (*V[k])[jNy][iNx] * cellAreas[jNy][iNx];
+                }
+                mass0[k] = mass;
+            }
+        }
+
+        /* Only transport the departure of non-uniform fields from their
+         * far-field value */
+        Vector_1D backg( nField, 0.0E+00 );
+        std::vector<bool> active( nField, 0 );
+        std::vector<Field*> activeFields;
+        activeFields.reserve( nField );
+
+        for ( k = 0; k < nField; k++ ) {
+            active[k] = Perturbation( *V[k], backg[k] );
+            if ( active[k] )
+                activeFields.push_back( V[k] );
+        }
+
+        nRun     += activeFields.size();
+        nSkipped += nField - activeFields.size();
+
+        if ( activeFields.size() == 0 )
+            return;
+
+        /* Same operator splitting approach as in Solver::Run */
+
+        /* 1) Apply diffusion and settling to all fields at once */
+        if ( !Stationary( ) ) {
+            SetFactors( );
+            if ( singlePrecision )
+                getFFT_2Df()->SANDS( activeFields );
+            else
+                FFT_2D->SANDS( activeFields );
+        }
+
+        /* 2) Apply shear forces to all fields at once */
+        if ( shear != 0 ) {
+            FFT_1D->ApplyShear( ShearFactor, activeFields );
+        }
+
+        for ( k = 0; k < nField; k++ ) {
+
+            if ( !active[k] )
+                continue;
+
+            AddBackground( *V[k], backg[k] );
+
+            /* 3) Apply corrections */
+            /* Fill negative values with fillVal */
+            if ( doFill && ( fillOpt_ == 0 ) ) {
+                Fill( *V[k], fillVal );
+            }
+
+            /* Apply correction scheme to get rid of Gibbs oscillations */
+            if ( doFill && ( fillOpt_ == 1 ) ) {
+                ScinoccaCorr( *V[k], mass0[k], cellAreas );
+            }
+
+        }
+
+    } /* End of Solver::RunMany */
+
+    void Solver::RunMany( Vector_3D &V, const Vector_2D &cellAreas, \
+                          const int fillOpt_, const bool singlePrecision )
+    {
+
+        std::vector<Vector_2D*> fields( V.size(), NULL );
+
+        for ( UInt k = 0; k < V.size(); k++ )
+            fields[k] = &V[k];
+
+        RunMany( fields, cellAreas, fillOpt_, singlePrecision );
+
+    } /* End of Solver::RunMany */
+
+    void Solver::RunMany( FieldStack &V, const Vector_2D &cellAreas, \
+                          const int fillOpt_, const bool singlePrecision )
+    {
+
+        std::vector<Field2D*> fields( V.size(), NULL );
+
+        for ( UInt k = 0; k < V.size(); k++ )
+            fields[k] = &V[k];
+
+        RunMany( fields, cellAreas, fillOpt_, singlePrecision );
+
+    } /* End of Solver::RunMany */
+
+    template <class Field>
+    bool Solver::Perturbation( Field &V, RealDouble &backg ) const
+    {
+
+        UInt iNx = 0;
+        UInt jNy = 0;
+
+        RealDouble maxDev = 0.0E+00;
+
+        /* The corner cell is the furthest away from the plume */
+        backg = V[0][0];
+
+#pragma omp parallel for                 \
+            if       ( !PARALLEL_CASES ) \
+            default  ( shared          ) \
+            private  ( iNx, jNy        ) \
+            reduction( max:maxDev      ) \
+            schedule ( dynamic, 1      )
+        for ( jNy = 0; jNy < n_y; jNy++ ) {
+            for ( iNx = 0; iNx < n_x; iNx++ )
+                maxDev = std::max( maxDev, std::abs( V[jNy][iNx] - backg ) );
+        }
+
+        if ( maxDev <= SANDS_UNIFORM_TOL * std::abs( backg ) )
+            return 0;
+
+        /* Transforming the perturbation rather than the full field
+         * keeps round-off errors relative to the plume signal */
+        if ( backg != 0.0E+00 ) {
+#pragma omp parallel for                 \
+            if       ( !PARALLEL_CASES ) \
+            default  ( shared          ) \
+            private  ( iNx, jNy        ) \
+            schedule ( dynamic, 1      )
+            for ( jNy = 0; jNy < n_y; jNy++ ) {
+                for ( iNx = 0; iNx < n_x; iNx++ )
+                    V[jNy][iNx] -= backg;
+            }
+        }
+
+        return 1;
+
+    } /* End of Solver::Perturbation */
+
+    template <class Field>
+    void Solver::AddBackground( Field &V, const RealDouble backg ) const
+    {
+
+        UInt iNx = 0;
+        UInt jNy = 0;
+
+        if ( backg == 0.0E+00 )
+            return;
+
+#pragma omp parallel for                 \
+            if       ( !PARALLEL_CASES ) \
+            default  ( shared          ) \
+            private  ( iNx, jNy        ) \
+            schedule ( dynamic, 1      )
+        for ( jNy = 0; jNy < n_y; jNy++ ) {
+            for ( iNx = 0; iNx < n_x; iNx++ )
+                V[jNy][iNx] += backg;
+        }
+
+    } /* End of Solver::AddBackground */
+
+    template <class Field>
+    void Solver::Fill( Field &V, const RealDouble val, \
                        const RealDouble threshold )
     {
 
@@ -338,7 +748,8 @@ namespace SANDS
 
     } /* End of Solver::Fill */
 
-    void Solver::ScinoccaCorr( Vector_2D &V, const RealDouble mass0, \
+    template <class Field>
+    void Solver::ScinoccaCorr( Field &V, const RealDouble mass0, \
                                const Vector_2D &cellAreas )
     {
 
@@ -514,6 +925,20 @@ namespace SANDS
 
     } /* End of Solver::ScinoccaCorr */
 
+    /* Explicit instantiations for nested vectors and contiguous fields */
+    template void Solver::Run<Vector_2D>( Vector_2D &V, const Vector_2D &cellAreas, const int fillOpt_, const bool singlePrecision );
+    template void Solver::Run<Field2D>( Field2D &V, const Vector_2D &cellAreas, const int fillOpt_, const bool singlePrecision );
+    template void Solver::RunMany<Vector_2D>( std::vector<Vector_2D*> &V, const Vector_2D &cellAreas, const int fillOpt_, const bool singlePrecision );
+    template void Solver::RunMany<Field2D>( std::vector<Field2D*> &V, const Vector_2D &cellAreas, const int fillOpt_, const bool singlePrecision );
+    template bool Solver::Perturbation<Vector_2D>( Vector_2D &V, RealDouble &backg ) const;
+    template bool Solver::Perturbation<Field2D>( Field2D &V, RealDouble &backg ) const;
+    template void Solver::AddBackground<Vector_2D>( Vector_2D &V, const RealDouble backg ) const;
+    template void Solver::AddBackground<Field2D>( Field2D &V, const RealDouble backg ) const;
+    template void Solver::Fill<Vector_2D>( Vector_2D &V, const RealDouble val, const RealDouble threshold );
+    template void Solver::Fill<Field2D>( Field2D &V, const RealDouble val, const RealDouble threshold );
+    template void Solver::ScinoccaCorr<Vector_2D>( Vector_2D &V, const RealDouble mass0, const Vector_2D &cellAreas );
+    template void Solver::ScinoccaCorr<Field2D>( Field2D &V, const RealDouble mass0, const Vector_2D &cellAreas );
+
 
 } /* SANDS */
 
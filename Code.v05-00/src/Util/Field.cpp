@@ -0,0 +1,492 @@
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+/*                                                                  */
+/*     Aircraft Plume Chemistry, Emission and Microphysics Model    */
+/*                             (APCEMM)                             */
+/*                                                                  */
+/* Field Program File                                               */
+/*                                                                  */
+/* Author               : Thibaud M. Fritz                          */
+/* Time                 : 10/15/2026                                */
+/* File                 : Field.cpp                                 */
+/*                                                                  */
+/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cstring>
+#include <algorithm>
+#include "Util/Field.hpp"
+
+static RealDouble* alignedAlloc( const size_t nElem )
+{
+
+    void* ptr = NULL;
+
+    if ( nElem == 0 )
+        return NULL;
+
+    if ( posix_memalign( &ptr, FIELD_ALIGN, sizeof(RealDouble) * nElem ) != 0 ) {
+        std::cout << " In Field: Could not allocate " << nElem << " elements!\n";
+        exit(-1);
+    }
+
+    return (RealDouble*) ptr;
+
+} /* End of alignedAlloc */
+
+/* Number of elements, padded so that the next field starts on a
+ * FIELD_ALIGN boundary */
+static size_t paddedSize( const size_t nElem )
+{
+
+    const size_t align = FIELD_ALIGN / sizeof(RealDouble);
+    return ( ( nElem + align - 1 ) / align ) * align;
+
+} /* End of paddedSize */
+
+Field2D::Field2D( ):
+    ny( 0 ),
+    nx( 0 ),
+    data_( NULL ),
+    owner( 1 )
+{
+
+    /* Default constructor */
+
+} /* End of Field2D::Field2D */
+
+Field2D::Field2D( const UInt ny_, const UInt nx_, const RealDouble value ):
+    ny( 0 ),
+    nx( 0 ),
+    data_( NULL ),
+    owner( 1 )
+{
+
+    Resize( ny_, nx_, value );
+
+} /* End of Field2D::Field2D */
+
+Field2D::Field2D( const Vector_2D &V ):
+    ny( 0 ),
+    nx( 0 ),
+    data_( NULL ),
+    owner( 1 )
+{
+
+    Resize( V.size(), ( V.size() > 0 ) ? V[0].size() : 0 );
+    *this = V;
+
+} /* End of Field2D::Field2D */
+
+Field2D::Field2D( const Field2D &F ):
+    ny( 0 ),
+    nx( 0 ),
+    data_( NULL ),
+    owner( 1 )
+{
+
+    Resize( F.ny, F.nx );
+    if ( data_ != NULL )
+        std::memcpy( data_, F.data_, sizeof(RealDouble) * nElem() );
+
+} /* End of Field2D::Field2D */
+
+Field2D::~Field2D( )
+{
+
+    Release();
+
+} /* End of Field2D::~Field2D */
+
+Field2D& Field2D::operator=( const Field2D &F )
+{
+
+    if ( &F == this )
+        return *this;
+
+    if ( ( ny != F.ny ) || ( nx != F.nx ) ) {
+        if ( !owner ) {
+            std::cout << " In Field2D::operator=: Cannot reshape a view ( ";
+            std::cout << ny << "x" << nx << " != " << F.ny << "x" << F.nx << " )\n";
+            exit(-1);
+        }
+        Resize( F.ny, F.nx );
+    }
+
+    if ( data_ != NULL )
+        std::memcpy( data_, F.data_, sizeof(RealDouble) * nElem() );
+
+    return *this;
+
+} /* End of Field2D::operator= */
+
+Field2D& Field2D::operator=( const Vector_2D &V )
+{
+
+    const UInt ny_ = V.size();
+    const UInt nx_ = ( ny_ > 0 ) ? V[0].size() : 0;
+
+    if ( ( ny != ny_ ) || ( nx != nx_ ) ) {
+        if ( !owner ) {
+            std::cout << " In Field2D::operator=: Cannot reshape a view ( ";
+            std::cout << ny << "x" << nx << " != " << ny_ << "x" << nx_ << " )\n";
+            exit(-1);
+        }
+        Resize( ny_, nx_ );
+    }
+
+    for ( UInt j = 0; j < ny; j++ )
+        std::copy( V[j].begin(), V[j].begin() + nx, data_ + j * nx );
+
+    return *this;
+
+} /* End of Field2D::operator= */
+
+void Field2D::Resize( const UInt ny_, const UInt nx_, const RealDouble value )
+{
+
+    if ( !owner ) {
+        std::cout << " In Field2D::Resize: Cannot resize a view!\n";
+        exit(-1);
+    }
+
+    if ( ( ny_ != ny ) || ( nx_ != nx ) ) {
+        Release();
+        ny    = ny_;
+        nx    = nx_;
+        data_ = alignedAlloc( nElem() );
+    }
+
+    SetToValue( value );
+
+} /* End of Field2D::Resize */
+
+void Field2D::SetToValue( const RealDouble value )
+{
+
+    if ( data_ != NULL )
+        std::fill( data_, data_ + nElem(), value );
+
+} /* End of Field2D::SetToValue */
+
+/* Copies a ny x nx block into a larger row-major array */
+static void embedBlock( const RealDouble* src, const UInt ny, const UInt nx, \
+                        RealDouble* dst, const UInt nxDst,                   \
+                        const UInt j0, const UInt i0 )
+{
+
+    for ( UInt j = 0; j < ny; j++ )
+        std::memcpy( dst + ( j0 + j ) * nxDst + i0, src + j * nx, sizeof(RealDouble) * nx );
+
+} /* End of embedBlock */
+
+void Field2D::Embed( const UInt ny_, const UInt nx_, \
+                     const UInt j0, const UInt i0,   \
+                     const RealDouble fill )
+{
+
+    if ( !owner ) {
+        std::cout << " In Field2D::Embed: Cannot resize a view!\n";
+        exit(-1);
+    }
+
+    if ( ( j0 + ny > ny_ ) || ( i0 + nx > nx_ ) ) {
+        std::cout << " In Field2D::Embed: Block does not fit ( ";
+        std::cout << ny << "x" << nx << " at " << j0 << "," << i0;
+        std::cout << " in " << ny_ << "x" << nx_ << " )\n";
+        exit(-1);
+    }
+
+    RealDouble* newData = alignedAlloc( (size_t) ny_ * nx_ );
+    std::fill( newData, newData + (size_t) ny_ * nx_, fill );
+    embedBlock( data_, ny, nx, newData, nx_, j0, i0 );
+
+    Release();
+    ny    = ny_;
+    nx    = nx_;
+    data_ = newData;
+
+} /* End of Field2D::Embed */
+
+Vector_2D Field2D::toVector( ) const
+{
+
+    Vector_2D V( ny, Vector_1D( nx, 0.0E+00 ) );
+
+    for ( UInt j = 0; j < ny; j++ )
+        std::copy( data_ + j * nx, data_ + ( j + 1 ) * nx, V[j].begin() );
+
+    return V;
+
+} /* End of Field2D::toVector */
+
+void Field2D::Attach( RealDouble* ptr, const UInt ny_, const UInt nx_ )
+{
+
+    Release();
+
+    owner = 0;
+    data_ = ptr;
+    ny    = ny_;
+    nx    = nx_;
+
+} /* End of Field2D::Attach */
+
+void Field2D::Release( )
+{
+
+    if ( owner && ( data_ != NULL ) )
+        free( data_ );
+
+    data_ = NULL;
+    owner = 1;
+    ny    = 0;
+    nx    = 0;
+
+} /* End of Field2D::Release */
+
+FieldStack::FieldStack( ):
+    data_( NULL ),
+    uniform( 1 )
+{
+
+    /* Default constructor */
+
+} /* End of FieldStack::FieldStack */
+
+FieldStack::FieldStack( const UInt n, const UInt ny_, const UInt nx_, \
+                        const RealDouble value ):
+    data_( NULL ),
+    uniform( 1 )
+{
+
+    Resize( n, ny_, nx_, value );
+
+} /* End of FieldStack::FieldStack */
+
+FieldStack::FieldStack( const Vector_3D &V ):
+    data_( NULL ),
+    uniform( 1 )
+{
+
+    *this = V;
+
+} /* End of FieldStack::FieldStack */
+
+FieldStack::FieldStack( const FieldStack &S ):
+    data_( NULL ),
+    uniform( 1 )
+{
+
+    *this = S;
+
+} /* End of FieldStack::FieldStack */
+
+FieldStack::~FieldStack( )
+{
+
+    Free();
+
+} /* End of FieldStack::~FieldStack */
+
+FieldStack& FieldStack::operator=( const FieldStack &S )
+{
+
+    if ( &S == this )
+        return *this;
+
+    bool sameShape = ( S.size() == size() );
+    for ( UInt k = 0; sameShape && ( k < size() ); k++ )
+        sameShape = ( fields[k].Ny() == S[k].Ny() ) && ( fields[k].Nx() == S[k].Nx() );
+
+    if ( !sameShape ) {
+        Vector_1Dui nys( S.size(), 0 ), nxs( S.size(), 0 );
+        for ( UInt k = 0; k < S.size(); k++ ) {
+            nys[k] = S[k].Ny();
+            nxs[k] = S[k].Nx();
+        }
+        Allocate( nys, nxs );
+    }
+
+    for ( UInt k = 0; k < size(); k++ )
+        fields[k] = S[k];
+
+    return *this;
+
+} /* End of FieldStack::operator= */
+
+FieldStack& FieldStack::operator=( const Vector_3D &V )
+{
+
+    Vector_1Dui nys( V.size(), 0 ), nxs( V.size(), 0 );
+    for ( UInt k = 0; k < V.size(); k++ ) {
+        nys[k] = V[k].size();
+        nxs[k] = ( V[k].size() > 0 ) ? V[k][0].size() : 0;
+    }
+
+    bool sameShape = ( V.size() == size() );
+    for ( UInt k = 0; sameShape && ( k < size() ); k++ )
+        sameShape = ( fields[k].Ny() == nys[k] ) && ( fields[k].Nx() == nxs[k] );
+
+    if ( !sameShape )
+        Allocate( nys, nxs );
+
+    for ( UInt k = 0; k < size(); k++ )
+        fields[k] = V[k];
+
+    return *this;
+
+} /* End of FieldStack::operator= */
+
+void FieldStack::Resize( const UInt n, const UInt ny_, const UInt nx_, \
+                         const RealDouble value )
+{
+
+    Allocate( Vector_1Dui( n, ny_ ), Vector_1Dui( n, nx_ ) );
+
+    for ( UInt k = 0; k < n; k++ )
+        fields[k].SetToValue( value );
+
+} /* End of FieldStack::Resize */
+
+void FieldStack::Resize( const Vector_1Dui &nys, const Vector_1Dui &nxs )
+{
+
+    Allocate( nys, nxs );
+
+    for ( UInt k = 0; k < size(); k++ )
+        fields[k].SetToValue( 0.0E+00 );
+
+} /* End of FieldStack::Resize */
+
+void FieldStack::Embed( const UInt ny_, const UInt nx_, \
+                        const UInt j0, const UInt i0,   \
+                        const Vector_1D &fill )
+{
+
+    const UInt n = size();
+
+    if ( fill.size() != n ) {
+        std::cout << " In FieldStack::Embed: Fill values are misshaped ( ";
+        std::cout << fill.size() << " != " << n << " )\n";
+        exit(-1);
+    }
+
+    /* Reference shape is the largest one */
+    UInt nyOld = 0, nxOld = 0;
+    for ( UInt k = 0; k < n; k++ ) {
+        if ( fields[k].nElem() > nyOld * nxOld ) {
+            nyOld = fields[k].Ny();
+            nxOld = fields[k].Nx();
+        }
+    }
+
+    /* Keep a copy of the current storage while reallocating */
+    FieldStack old( *this );
+
+    Vector_1Dui nys( n, 0 ), nxs( n, 0 );
+    std::vector<bool> grow( n, 0 );
+    for ( UInt k = 0; k < n; k++ ) {
+        grow[k] = ( old[k].Ny() == nyOld ) && ( old[k].Nx() == nxOld );
+        nys[k]  = grow[k] ? ny_ : old[k].Ny();
+        nxs[k]  = grow[k] ? nx_ : old[k].Nx();
+    }
+
+    if ( ( j0 + nyOld > ny_ ) || ( i0 + nxOld > nx_ ) ) {
+        std::cout << " In FieldStack::Embed: Block does not fit ( ";
+        std::cout << nyOld << "x" << nxOld << " at " << j0 << "," << i0;
+        std::cout << " in " << ny_ << "x" << nx_ << " )\n";
+        exit(-1);
+    }
+
+    Allocate( nys, nxs );
+
+    for ( UInt k = 0; k < n; k++ ) {
+        if ( grow[k] ) {
+            fields[k].SetToValue( fill[k] );
+            embedBlock( old[k].data(), nyOld, nxOld, fields[k].data(), nx_, j0, i0 );
+        } else {
+            fields[k] = old[k];
+        }
+    }
+
+} /* End of FieldStack::Embed */
+
+void FieldStack::getCell( const UInt j, const UInt i, RealDouble* buffer, \
+                          const UInt first, const UInt count ) const
+{
+
+    for ( UInt k = 0; k < count; k++ )
+        buffer[k] = fields[first+k][j][i];
+
+} /* End of FieldStack::getCell */
+
+void FieldStack::setCell( const UInt j, const UInt i, const RealDouble* buffer, \
+                          const UInt first, const UInt count )
+{
+
+    for ( UInt k = 0; k < count; k++ )
+        fields[first+k][j][i] = buffer[k];
+
+} /* End of FieldStack::setCell */
+
+Vector_3D FieldStack::toVector( ) const
+{
+
+    Vector_3D V( size() );
+
+    for ( UInt k = 0; k < size(); k++ )
+        V[k] = fields[k].toVector();
+
+    return V;
+
+} /* End of FieldStack::toVector */
+
+void FieldStack::Allocate( const Vector_1Dui &nys, const Vector_1Dui &nxs )
+{
+
+    Free();
+
+    if ( nys.size() != nxs.size() ) {
+        std::cout << " In FieldStack::Allocate: Shapes are misshaped ( ";
+        std::cout << nys.size() << " != " << nxs.size() << " )\n";
+        exit(-1);
+    }
+
+    const UInt n = nys.size();
+
+    size_t total = 0;
+    uniform = 1;
+    for ( UInt k = 0; k < n; k++ ) {
+        total += paddedSize( (size_t) nys[k] * nxs[k] );
+        if ( ( nys[k] != nys[0] ) || ( nxs[k] != nxs[0] ) )
+            uniform = 0;
+    }
+
+    data_ = alignedAlloc( total );
+
+    /* Do not grow the vector after attaching views: a reallocation would
+     * deep-copy them */
+    fields.assign( n, Field2D() );
+
+    size_t offset = 0;
+    for ( UInt k = 0; k < n; k++ ) {
+        fields[k].Attach( data_ + offset, nys[k], nxs[k] );
+        offset += paddedSize( (size_t) nys[k] * nxs[k] );
+    }
+
+} /* End of FieldStack::Allocate */
+
+void FieldStack::Free( )
+{
+
+    /* Detach views first */
+    fields.clear();
+
+    if ( data_ != NULL )
+        free( data_ );
+
+    data_   = NULL;
+    uniform = 1;
+
+} /* End of FieldStack::Free */
+
+/* End of Field.cpp */
@@ -561,14 +561,9 @@ namespace physFunc
          * OUTPUT PARAMETERS:
          * - RealDouble :: Corrected water diffusion coefficient */
 
-        /* alpha represents the deposition coefficient for H2O molecules impinging on the 
-         * surface. It is experimentally derived */
-
-        static const RealDouble alpha = 0.5;
-
         return DiffCoef_H2O( T, P ) \
             / ( r / ( r + lambda( T, P ) ) \
-              + DiffCoef_H2O( T, P ) / ( alpha * r * thermalSpeed( T, MW_H2O / physConst::Na ) ) );
+              + DiffCoef_H2O( T, P ) / ( physConst::ALPHA_H2O * r * thermalSpeed( T, MW_H2O / physConst::Na ) ) );
 
     } /* End of CorrDiffCoef_H2O */
     
@@ -647,14 +642,9 @@ namespace physFunc
          * (H.R. Prupparcher and J.D. Klett, Microphysics of Clouds and Precipitation,
          *  Kluwer Academic Publishers, 1997)*/
 
-        /* alpha_T is experimentally derived */
-
-        static const RealDouble k_a = 2.50E-02; /* [J / (m s K)] */
-        static const RealDouble alpha_T = 0.7;
-
-        return k_a \
-            / ( r / ( r + 2.16E-07 ) \
-              + k_a / ( alpha_T * r * physConst::CP_Air * rhoAir( T, P ) * thermalSpeed( T, MW_H2O / physConst::Na ) ) );
+        return physConst::K_AIR \
+            / ( r / ( r + physConst::L_T ) \
+              + physConst::K_AIR / ( physConst::ALPHA_T * r * physConst::CP_Air * rhoAir( T, P ) * thermalSpeed( T, MW_H2O / physConst::Na ) ) );
 
     } /* End of ThermalCond */
 